@@ -4,6 +4,7 @@
 SOURCES  += \
     $$PWD/main.cpp \
     $$PWD/tmainwindow.cpp \
+    $$PWD/tmeasurementsmodel.cpp \
     $$PWD/mapplication.cpp \
     $$PWD/dialogs/dialogabouttape.cpp \
     $$PWD/dialogs/dialognewmeasurements.cpp \
@@ -17,6 +18,7 @@ SOURCES  += \
 
 HEADERS  += \
     $$PWD/tmainwindow.h \
+    $$PWD/tmeasurementsmodel.h \
     $$PWD/stable.h \
     $$PWD/mapplication.h \
     $$PWD/dialogs/dialogabouttape.h \
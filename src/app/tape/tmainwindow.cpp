@@ -45,6 +45,7 @@
 #include "../vmisc/dialogs/dialogexporttocsv.h"
 #include "../vmisc/compatibility.h"
 #include "vlitepattern.h"
+#include "tmeasurementsmodel.h"
 #include "../qmuparser/qmudef.h"
 #include "../vtools/dialogs/support/dialogeditwrongformula.h"
 #include "version.h"
@@ -79,9 +80,6 @@ Q_LOGGING_CATEGORY(tMainWindow, "t.mainwindow")
 
 QT_WARNING_POP
 
-// We need this enum in case we will add or delete a column. And also make code more readable.
-enum {ColumnName = 0, ColumnFullName, ColumnCalcValue, ColumnFormula, ColumnBaseValue, ColumnInSizes, ColumnInHeights};
-
 //---------------------------------------------------------------------------------------------------------------------
 TMainWindow::TMainWindow(QWidget *parent)
     : VAbstractMainWindow(parent),
@@ -100,6 +98,7 @@ TMainWindow::TMainWindow(QWidget *parent)
       formulaBaseHeight(0),
       lock(nullptr),
       search(),
+      model(nullptr),
       labelGradationHeights(nullptr),
       labelGradationSizes(nullptr),
       labelPatternUnit(nullptr),
@@ -120,7 +119,10 @@ TMainWindow::TMainWindow(QWidget *parent)
     ui->lineEditFind->installEventFilter(this);
     ui->plainTextEditFormula->installEventFilter(this);
 
-    search = QSharedPointer<VTableSearch>(new VTableSearch(ui->tableWidget));
+    model = new TMeasurementsModel(this);
+    ui->tableView->setModel(model);
+
+    search = QSharedPointer<VTableSearch>(new VTableSearch(ui->tableView));
     ui->tabWidget->setVisible(false);
 
     ui->mainToolBar->setContextMenuPolicy(Qt::PreventContextMenu);
@@ -166,9 +168,9 @@ void TMainWindow::RetranslateTable()
 {
     if (m != nullptr)
     {
-        const int row = ui->tableWidget->currentRow();
+        const int row = CurrentRow();
         RefreshTable();
-        ui->tableWidget->selectRow(row);
+        SelectRow(row);
         search->RefreshList(ui->lineEditFind->text());
     }
 }
@@ -180,7 +182,7 @@ void TMainWindow::SetBaseMHeight(int height)
     {
         if (mType == MeasurementsType::Multisize)
         {
-            const int row = ui->tableWidget->currentRow();
+            const int row = CurrentRow();
             currentHeight = UnitConvertor(height, Unit::Cm, mUnit);
 
             gradationHeights->blockSignals(true);
@@ -189,7 +191,7 @@ void TMainWindow::SetBaseMHeight(int height)
 
             RefreshData();
             search->RefreshList(ui->lineEditFind->text());
-            ui->tableWidget->selectRow(row);
+            SelectRow(row);
         }
     }
 }
@@ -201,7 +203,7 @@ void TMainWindow::SetBaseMSize(int size)
     {
         if (mType == MeasurementsType::Multisize)
         {
-            const int row = ui->tableWidget->currentRow();
+            const int row = CurrentRow();
             currentSize = UnitConvertor(size, Unit::Cm, mUnit);
 
             gradationSizes->blockSignals(true);
@@ -210,7 +212,7 @@ void TMainWindow::SetBaseMSize(int size)
 
             RefreshData();
             search->RefreshList(ui->lineEditFind->text());
-            ui->tableWidget->selectRow(row);
+            SelectRow(row);
         }
     }
 }
@@ -313,9 +315,9 @@ bool TMainWindow::LoadFile(const QString &path)
             const bool freshCall = true;
             RefreshData(freshCall);
 
-            if (ui->tableWidget->rowCount() > 0)
+            if (model->rowCount() > 0)
             {
-                ui->tableWidget->selectRow(0);
+                SelectRow(0);
             }
 
             MeasurementGUI();
@@ -654,12 +656,12 @@ bool TMainWindow::eventFilter(QObject *object, QEvent *event)
 void TMainWindow::ExportToCSVData(const QString &fileName, bool withHeader, int mib, const QChar &separator)
 {
     QxtCsvModel csv;
-    const int columns = ui->tableWidget->columnCount();
+    const int columns = model->columnCount();
     {
         int colCount = 0;
         for (int column = 0; column < columns; ++column)
         {
-            if (not ui->tableWidget->isColumnHidden(column))
+            if (not ui->tableView->isColumnHidden(column))
             {
                 csv.insertColumn(colCount++);
             }
@@ -671,26 +673,24 @@ void TMainWindow::ExportToCSVData(const QString &fileName, bool withHeader, int
         int colCount = 0;
         for (int column = 0; column < columns; ++column)
         {
-            if (not ui->tableWidget->isColumnHidden(column))
+            if (not ui->tableView->isColumnHidden(column))
             {
-                QTableWidgetItem *header = ui->tableWidget->horizontalHeaderItem(column);
-                csv.setHeaderText(colCount, header->text());
+                csv.setHeaderText(colCount, model->headerData(column, Qt::Horizontal).toString());
                 ++colCount;
             }
         }
     }
 
-    const int rows = ui->tableWidget->rowCount();
+    const int rows = model->rowCount();
     for (int row = 0; row < rows; ++row)
     {
         csv.insertRow(row);
         int colCount = 0;
         for (int column = 0; column < columns; ++column)
         {
-            if (not ui->tableWidget->isColumnHidden(column))
+            if (not ui->tableView->isColumnHidden(column))
             {
-                QTableWidgetItem *item = ui->tableWidget->item(row, column);
-                csv.setText(row, colCount, item->text());
+                csv.setText(row, colCount, model->index(row, column).data().toString());
                 ++colCount;
             }
         }
@@ -1093,15 +1093,15 @@ void TMainWindow::SavePMSystem(int index)
 void TMainWindow::Remove()
 {
     ShowMDiagram(QString());
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
 
     if (row == -1)
     {
         return;
     }
 
-    const QTableWidgetItem *nameField = ui->tableWidget->item(ui->tableWidget->currentRow(), 0);
-    m->Remove(nameField->data(Qt::UserRole).toString());
+    const QModelIndex nameField = model->index(CurrentRow(), ColumnName);
+    m->Remove(nameField.data(Qt::UserRole).toString());
 
     MeasurementsWereSaved(false);
 
@@ -1109,9 +1109,9 @@ void TMainWindow::Remove()
     RefreshData();
     search->RefreshList(ui->lineEditFind->text());
 
-    if (ui->tableWidget->rowCount() > 0)
+    if (model->rowCount() > 0)
     {
-        ui->tableWidget->selectRow(row >= ui->tableWidget->rowCount() ? ui->tableWidget->rowCount() - 1 : row);
+        SelectRow(row >= model->rowCount() ? model->rowCount() - 1 : row);
     }
     else
     {
@@ -1160,108 +1160,108 @@ void TMainWindow::Remove()
         }
     }
 
-    ui->tableWidget->repaint(); // Force repain to fix paint artifacts on Mac OS X
+    ui->tableView->repaint(); // Force repain to fix paint artifacts on Mac OS X
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::MoveTop()
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
 
     if (row == -1)
     {
         return;
     }
 
-    const QTableWidgetItem *nameField = ui->tableWidget->item(row, ColumnName);
-    m->MoveTop(nameField->data(Qt::UserRole).toString());
+    const QModelIndex nameField = model->index(row, ColumnName);
+    m->MoveTop(nameField.data(Qt::UserRole).toString());
     MeasurementsWereSaved(false);
     RefreshData();
     search->RefreshList(ui->lineEditFind->text());
-    ui->tableWidget->selectRow(0);
-    ui->tableWidget->repaint(); // Force repain to fix paint artifacts on Mac OS X
+    SelectRow(0);
+    ui->tableView->repaint(); // Force repain to fix paint artifacts on Mac OS X
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::MoveUp()
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
 
     if (row == -1)
     {
         return;
     }
 
-    const QTableWidgetItem *nameField = ui->tableWidget->item(row, ColumnName);
-    m->MoveUp(nameField->data(Qt::UserRole).toString());
+    const QModelIndex nameField = model->index(row, ColumnName);
+    m->MoveUp(nameField.data(Qt::UserRole).toString());
     MeasurementsWereSaved(false);
     RefreshData();
     search->RefreshList(ui->lineEditFind->text());
-    ui->tableWidget->selectRow(row-1);
-    ui->tableWidget->repaint(); // Force repain to fix paint artifacts on Mac OS X
+    SelectRow(row-1);
+    ui->tableView->repaint(); // Force repain to fix paint artifacts on Mac OS X
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::MoveDown()
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
 
     if (row == -1)
     {
         return;
     }
 
-    const QTableWidgetItem *nameField = ui->tableWidget->item(row, ColumnName);
-    m->MoveDown(nameField->data(Qt::UserRole).toString());
+    const QModelIndex nameField = model->index(row, ColumnName);
+    m->MoveDown(nameField.data(Qt::UserRole).toString());
     MeasurementsWereSaved(false);
     RefreshData();
     search->RefreshList(ui->lineEditFind->text());
-    ui->tableWidget->selectRow(row+1);
-    ui->tableWidget->repaint(); // Force repain to fix paint artifacts on Mac OS X
+    SelectRow(row+1);
+    ui->tableView->repaint(); // Force repain to fix paint artifacts on Mac OS X
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::MoveBottom()
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
 
     if (row == -1)
     {
         return;
     }
 
-    const QTableWidgetItem *nameField = ui->tableWidget->item(row, ColumnName);
-    m->MoveBottom(nameField->data(Qt::UserRole).toString());
+    const QModelIndex nameField = model->index(row, ColumnName);
+    m->MoveBottom(nameField.data(Qt::UserRole).toString());
     MeasurementsWereSaved(false);
     RefreshData();
     search->RefreshList(ui->lineEditFind->text());
-    ui->tableWidget->selectRow(ui->tableWidget->rowCount()-1);
-    ui->tableWidget->repaint(); // Force repain to fix paint artifacts on Mac OS X
+    SelectRow(model->rowCount()-1);
+    ui->tableView->repaint(); // Force repain to fix paint artifacts on Mac OS X
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::Fx()
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
 
     if (row == -1)
     {
         return;
     }
 
-    const QTableWidgetItem *nameField = ui->tableWidget->item(row, ColumnName);
+    const QModelIndex nameField = model->index(row, ColumnName);
 
     QSharedPointer<VMeasurement> meash;
 
     try
     {
        // Translate to internal look.
-       meash = data->GetVariable<VMeasurement>(nameField->data(Qt::UserRole).toString());
+       meash = data->GetVariable<VMeasurement>(nameField.data(Qt::UserRole).toString());
     }
     catch(const VExceptionBadId & e)
     {
         qCCritical(tMainWindow, "%s\n\n%s\n\n%s",
-                   qUtf8Printable(tr("Can't find measurement '%1'.").arg(nameField->text())),
+                   qUtf8Printable(tr("Can't find measurement '%1'.").arg(nameField.data().toString())),
                    qUtf8Printable(e.ErrorMessage()), qUtf8Printable(e.DetailedInformation()));
         return;
     }
@@ -1275,10 +1275,7 @@ void TMainWindow::Fx()
 
     if (dialog->exec() == QDialog::Accepted)
     {
-        // Fix the bug #492. https://bitbucket.org/dismine/valentina/issues/492/valentina-crashes-when-add-an-increment
-        // Because of the bug need to take QTableWidgetItem twice time. Previous update "killed" the pointer.
-        nameField = ui->tableWidget->item(row, ColumnName);
-        m->SetMValue(nameField->data(Qt::UserRole).toString(), dialog->GetFormula());
+        m->SetMValue(nameField.data(Qt::UserRole).toString(), dialog->GetFormula());
 
         MeasurementsWereSaved(false);
 
@@ -1286,7 +1283,7 @@ void TMainWindow::Fx()
 
         search->RefreshList(ui->lineEditFind->text());
 
-        ui->tableWidget->selectRow(row);
+        SelectRow(row);
     }
     delete dialog;
 }
@@ -1297,28 +1294,28 @@ void TMainWindow::AddCustom()
     const QString name = GetCustomName();
     qint32 currentRow = -1;
 
-    if (ui->tableWidget->currentRow() == -1)
+    if (CurrentRow() == -1)
     {
-        currentRow  = ui->tableWidget->rowCount();
+        currentRow  = model->rowCount();
         m->AddEmpty(name);
     }
     else
     {
-        currentRow  = ui->tableWidget->currentRow()+1;
-        const QTableWidgetItem *nameField = ui->tableWidget->item(ui->tableWidget->currentRow(), ColumnName);
-        m->AddEmptyAfter(nameField->data(Qt::UserRole).toString(), name);
+        currentRow  = CurrentRow()+1;
+        const QModelIndex nameField = model->index(CurrentRow(), ColumnName);
+        m->AddEmptyAfter(nameField.data(Qt::UserRole).toString(), name);
     }
 
     search->AddRow(currentRow);
     RefreshData();
     search->RefreshList(ui->lineEditFind->text());
 
-    ui->tableWidget->selectRow(currentRow);
+    SelectRow(currentRow);
 
     ui->actionExportToCSV->setEnabled(true);
 
     MeasurementsWereSaved(false);
-    ui->tableWidget->repaint(); // Force repain to fix paint artifacts on Mac OS X
+    ui->tableView->repaint(); // Force repain to fix paint artifacts on Mac OS X
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1330,9 +1327,9 @@ void TMainWindow::AddKnown()
         qint32 currentRow;
 
         const QStringList list = dialog->GetNewNames();
-        if (ui->tableWidget->currentRow() == -1)
+        if (CurrentRow() == -1)
         {
-            currentRow  = ui->tableWidget->rowCount() + list.size() - 1;
+            currentRow  = model->rowCount() + list.size() - 1;
             for (auto &name : list)
             {
                 if (mType == MeasurementsType::Individual)
@@ -1349,9 +1346,9 @@ void TMainWindow::AddKnown()
         }
         else
         {
-            currentRow  = ui->tableWidget->currentRow() + list.size();
-            const QTableWidgetItem *nameField = ui->tableWidget->item(ui->tableWidget->currentRow(), ColumnName);
-            QString after = nameField->data(Qt::UserRole).toString();
+            currentRow  = CurrentRow() + list.size();
+            const QModelIndex nameField = model->index(CurrentRow(), ColumnName);
+            QString after = nameField.data(Qt::UserRole).toString();
             for (auto &name : list)
             {
                 if (mType == MeasurementsType::Individual)
@@ -1370,13 +1367,13 @@ void TMainWindow::AddKnown()
         RefreshData();
         search->RefreshList(ui->lineEditFind->text());
 
-        ui->tableWidget->selectRow(currentRow);
+        SelectRow(currentRow);
 
         ui->actionExportToCSV->setEnabled(true);
 
         MeasurementsWereSaved(false);
     }
-    ui->tableWidget->repaint(); // Force repain to fix paint artifacts on Mac OS X
+    ui->tableView->repaint(); // Force repain to fix paint artifacts on Mac OS X
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1423,9 +1420,9 @@ void TMainWindow::ImportFromPattern()
 
     qint32 currentRow;
 
-    if (ui->tableWidget->currentRow() == -1)
+    if (CurrentRow() == -1)
     {
-        currentRow  = ui->tableWidget->rowCount() + measurements.size() - 1;
+        currentRow  = model->rowCount() + measurements.size() - 1;
         for (auto &mName : measurements)
         {
             m->AddEmpty(mName);
@@ -1433,9 +1430,9 @@ void TMainWindow::ImportFromPattern()
     }
     else
     {
-        currentRow  = ui->tableWidget->currentRow() + measurements.size();
-        const QTableWidgetItem *nameField = ui->tableWidget->item(ui->tableWidget->currentRow(), ColumnName);
-        QString after = nameField->data(Qt::UserRole).toString();
+        currentRow  = CurrentRow() + measurements.size();
+        const QModelIndex nameField = model->index(CurrentRow(), ColumnName);
+        QString after = nameField.data(Qt::UserRole).toString();
         for (auto &mName : measurements)
         {
             m->AddEmptyAfter(after, mName);
@@ -1447,7 +1444,7 @@ void TMainWindow::ImportFromPattern()
 
     search->RefreshList(ui->lineEditFind->text());
 
-    ui->tableWidget->selectRow(currentRow);
+    SelectRow(currentRow);
 
     MeasurementsWereSaved(false);
 }
@@ -1455,21 +1452,21 @@ void TMainWindow::ImportFromPattern()
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::ChangedSize(const QString &text)
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
     currentSize = text.toInt();
     RefreshData();
     search->RefreshList(ui->lineEditFind->text());
-    ui->tableWidget->selectRow(row);
+    SelectRow(row);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::ChangedHeight(const QString &text)
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
     currentHeight = text.toInt();
     RefreshData();
     search->RefreshList(ui->lineEditFind->text());
-    ui->tableWidget->selectRow(row);
+    SelectRow(row);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1481,25 +1478,24 @@ void TMainWindow::ShowMData()
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::ShowNewMData(bool fresh)
 {
-    if (ui->tableWidget->rowCount() > 0)
+    if (model->rowCount() > 0)
     {
         MFields(true);
 
-        if (ui->tableWidget->currentRow() == -1)
+        if (CurrentRow() == -1)
         {
-            ui->tableWidget->blockSignals(true);
-            ui->tableWidget->selectRow(0);
-            ui->tableWidget->blockSignals(false);
+            ui->tableView->selectRow(0); // Selection will show the data
+            return;
         }
 
-        const QTableWidgetItem *nameField = ui->tableWidget->item(ui->tableWidget->currentRow(), ColumnName); // name
-        SCASSERT(nameField != nullptr)
+        const QModelIndex nameField = model->index(CurrentRow(), ColumnName); // name
+        SCASSERT(nameField.isValid())
         QSharedPointer<VMeasurement> meash;
 
         try
         {
             // Translate to internal look.
-            meash = data->GetVariable<VMeasurement>(nameField->data(Qt::UserRole).toString());
+            meash = data->GetVariable<VMeasurement>(nameField.data(Qt::UserRole).toString());
         }
         catch(const VExceptionBadId &e)
         {
@@ -1524,7 +1520,7 @@ void TMainWindow::ShowNewMData(bool fresh)
             //Show known
             ui->plainTextEditDescription->setPlainText(qApp->TrVars()->Description(meash->GetName()));
             ui->lineEditFullName->setText(qApp->TrVars()->GuiText(meash->GetName()));
-            ui->lineEditName->setText(nameField->text());
+            ui->lineEditName->setText(nameField.data().toString());
         }
         connect(ui->lineEditName, &QLineEdit::textEdited, this, &TMainWindow::SaveMName);
         ui->plainTextEditDescription->blockSignals(false);
@@ -1633,26 +1629,26 @@ void TMainWindow::DeployFormula()
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::SaveMName(const QString &text)
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
 
     if (row == -1)
     {
         return;
     }
 
-    const QTableWidgetItem *nameField = ui->tableWidget->item(ui->tableWidget->currentRow(), ColumnName);
+    const QModelIndex nameField = model->index(CurrentRow(), ColumnName);
 
     QSharedPointer<VMeasurement> meash;
 
     try
     {
         // Translate to internal look.
-        meash = data->GetVariable<VMeasurement>(nameField->data(Qt::UserRole).toString());
+        meash = data->GetVariable<VMeasurement>(nameField.data(Qt::UserRole).toString());
     }
     catch(const VExceptionBadId &e)
     {
         qCWarning(tMainWindow, "%s\n\n%s\n\n%s",
-                  qUtf8Printable(tr("Can't find measurement '%1'.").arg(nameField->text())),
+                  qUtf8Printable(tr("Can't find measurement '%1'.").arg(nameField.data().toString())),
                   qUtf8Printable(e.ErrorMessage()), qUtf8Printable(e.DetailedInformation()));
         return;
     }
@@ -1675,14 +1671,10 @@ void TMainWindow::SaveMName(const QString &text)
             newName = name;
         }
 
-        m->SetMName(nameField->text(), newName);
+        m->SetMName(nameField.data().toString(), newName);
         MeasurementsWereSaved(false);
         RefreshData();
         search->RefreshList(ui->lineEditFind->text());
-
-        ui->tableWidget->blockSignals(true);
-        ui->tableWidget->selectRow(row);
-        ui->tableWidget->blockSignals(false);
     }
     else
     {
@@ -1693,23 +1685,22 @@ void TMainWindow::SaveMName(const QString &text)
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::SaveMValue()
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
 
     if (row == -1)
     {
         return;
     }
 
-    const QTableWidgetItem *nameField = ui->tableWidget->item(row, ColumnName);
+    const QModelIndex nameField = model->index(row, ColumnName);
 
     QString text = ui->plainTextEditFormula->toPlainText();
 
-    QTableWidgetItem *formulaField = ui->tableWidget->item(row, ColumnFormula);
-    if (formulaField->text() == text)
+    if (model->index(row, ColumnFormula).data().toString() == text)
     {
-        QTableWidgetItem *result = ui->tableWidget->item(row, ColumnCalcValue);
+        const QString result = model->index(row, ColumnCalcValue).data().toString();
         const QString postfix = UnitsToStr(mUnit);//Show unit in dialog lable (cm, mm or inch)
-        ui->labelCalculatedValue->setText(result->text() + QChar(QChar::Space) +postfix);
+        ui->labelCalculatedValue->setText(result + QChar(QChar::Space) +postfix);
         return;
     }
 
@@ -1724,12 +1715,12 @@ void TMainWindow::SaveMValue()
     try
     {
         // Translate to internal look.
-        meash = data->GetVariable<VMeasurement>(nameField->data(Qt::UserRole).toString());
+        meash = data->GetVariable<VMeasurement>(nameField.data(Qt::UserRole).toString());
     }
     catch(const VExceptionBadId & e)
     {
         qCWarning(tMainWindow, "%s\n\n%s\n\n%s",
-                  qUtf8Printable(tr("Can't find measurement '%1'.").arg(nameField->text())),
+                  qUtf8Printable(tr("Can't find measurement '%1'.").arg(nameField.data().toString())),
                   qUtf8Printable(e.ErrorMessage()), qUtf8Printable(e.DetailedInformation()));
         return;
     }
@@ -1742,7 +1733,7 @@ void TMainWindow::SaveMValue()
     try
     {
         const QString formula = qApp->TrVars()->FormulaFromUser(text, qApp->Settings()->GetOsSeparator());
-        m->SetMValue(nameField->data(Qt::UserRole).toString(), formula);
+        m->SetMValue(nameField.data(Qt::UserRole).toString(), formula);
     }
     catch (qmu::QmuParserError &e) // Just in case something bad will happen
     {
@@ -1754,113 +1745,93 @@ void TMainWindow::SaveMValue()
 
     const QTextCursor cursor = ui->plainTextEditFormula->textCursor();
 
-    RefreshData();
+    RefreshMeasurement(nameField.data(Qt::UserRole).toString());
     search->RefreshList(ui->lineEditFind->text());
 
-    ui->tableWidget->blockSignals(true);
-    ui->tableWidget->selectRow(row);
-    ui->tableWidget->blockSignals(false);
-
     ui->plainTextEditFormula->setTextCursor(cursor);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::SaveMBaseValue(double value)
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
 
     if (row == -1)
     {
         return;
     }
 
-    const QTableWidgetItem *nameField = ui->tableWidget->item(ui->tableWidget->currentRow(), ColumnName);
-    m->SetMBaseValue(nameField->data(Qt::UserRole).toString(), value);
+    const QModelIndex nameField = model->index(CurrentRow(), ColumnName);
+    m->SetMBaseValue(nameField.data(Qt::UserRole).toString(), value);
 
     MeasurementsWereSaved(false);
 
-    RefreshData();
+    RefreshMeasurement(nameField.data(Qt::UserRole).toString());
     search->RefreshList(ui->lineEditFind->text());
 
-    ui->tableWidget->blockSignals(true);
-    ui->tableWidget->selectRow(row);
-    ui->tableWidget->blockSignals(false);
-
     ShowNewMData(false);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::SaveMSizeIncrease(double value)
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
 
     if (row == -1)
     {
         return;
     }
 
-    const QTableWidgetItem *nameField = ui->tableWidget->item(ui->tableWidget->currentRow(), ColumnName);
-    m->SetMSizeIncrease(nameField->data(Qt::UserRole).toString(), value);
+    const QModelIndex nameField = model->index(CurrentRow(), ColumnName);
+    m->SetMSizeIncrease(nameField.data(Qt::UserRole).toString(), value);
 
     MeasurementsWereSaved(false);
 
-    RefreshData();
+    RefreshMeasurement(nameField.data(Qt::UserRole).toString());
     search->RefreshList(ui->lineEditFind->text());
 
-    ui->tableWidget->blockSignals(true);
-    ui->tableWidget->selectRow(row);
-    ui->tableWidget->blockSignals(false);
-
     ShowNewMData(false);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::SaveMHeightIncrease(double value)
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
 
     if (row == -1)
     {
         return;
     }
 
-    const QTableWidgetItem *nameField = ui->tableWidget->item(ui->tableWidget->currentRow(), ColumnName);
-    m->SetMHeightIncrease(nameField->data(Qt::UserRole).toString(), value);
+    const QModelIndex nameField = model->index(CurrentRow(), ColumnName);
+    m->SetMHeightIncrease(nameField.data(Qt::UserRole).toString(), value);
 
     MeasurementsWereSaved(false);
 
-    RefreshData();
+    RefreshMeasurement(nameField.data(Qt::UserRole).toString());
     search->RefreshList(ui->lineEditFind->text());
 
-    ui->tableWidget->blockSignals(true);
-    ui->tableWidget->selectRow(row);
-    ui->tableWidget->blockSignals(false);
-
     ShowNewMData(false);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::SaveMDescription()
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
 
     if (row == -1)
     {
         return;
     }
 
-    const QTableWidgetItem *nameField = ui->tableWidget->item(ui->tableWidget->currentRow(), ColumnName);
-    m->SetMDescription(nameField->data(Qt::UserRole).toString(), ui->plainTextEditDescription->toPlainText());
+    const QModelIndex nameField = model->index(CurrentRow(), ColumnName);
+    m->SetMDescription(nameField.data(Qt::UserRole).toString(), ui->plainTextEditDescription->toPlainText());
 
     MeasurementsWereSaved(false);
 
     const QTextCursor cursor = ui->plainTextEditDescription->textCursor();
 
-    RefreshData();
-
-    ui->tableWidget->blockSignals(true);
-    ui->tableWidget->selectRow(row);
-    ui->tableWidget->blockSignals(false);
+    RefreshMeasurement(nameField.data(Qt::UserRole).toString());
 
     ui->plainTextEditDescription->setTextCursor(cursor);
 }
@@ -1869,41 +1840,37 @@ void TMainWindow::SaveMDescription()
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::SaveMFullName()
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
 
     if (row == -1)
     {
         return;
     }
 
-    const QTableWidgetItem *nameField = ui->tableWidget->item(ui->tableWidget->currentRow(), ColumnName);
+    const QModelIndex nameField = model->index(CurrentRow(), ColumnName);
 
     QSharedPointer<VMeasurement> meash;
 
     try
     {
         // Translate to internal look.
-        meash = data->GetVariable<VMeasurement>(nameField->data(Qt::UserRole).toString());
+        meash = data->GetVariable<VMeasurement>(nameField.data(Qt::UserRole).toString());
     }
     catch(const VExceptionBadId &e)
     {
         qCWarning(tMainWindow, "%s\n\n%s\n\n%s",
-                  qUtf8Printable(tr("Can't find measurement '%1'.").arg(nameField->text())),
+                  qUtf8Printable(tr("Can't find measurement '%1'.").arg(nameField.data().toString())),
                   qUtf8Printable(e.ErrorMessage()), qUtf8Printable(e.DetailedInformation()));
         return;
     }
 
     if (meash->IsCustom())
     {
-        m->SetMFullName(nameField->data(Qt::UserRole).toString(), ui->lineEditFullName->text());
+        m->SetMFullName(nameField.data(Qt::UserRole).toString(), ui->lineEditFullName->text());
 
         MeasurementsWereSaved(false);
 
-        RefreshData();
-
-        ui->tableWidget->blockSignals(true);
-        ui->tableWidget->selectRow(row);
-        ui->tableWidget->blockSignals(false);
+        RefreshMeasurement(nameField.data(Qt::UserRole).toString());
     }
     else
     {
@@ -2178,49 +2145,22 @@ void TMainWindow::InitTable()
 {
     if (mType == MeasurementsType::Multisize)
     {
-        ui->tableWidget->setColumnHidden( ColumnFormula, true );// formula
+        ui->tableView->setColumnHidden( ColumnFormula, true );// formula
     }
     else
     {
-        ui->tableWidget->setColumnHidden( ColumnBaseValue, true );// base value
-        ui->tableWidget->setColumnHidden( ColumnInSizes, true );// in sizes
-        ui->tableWidget->setColumnHidden( ColumnInHeights, true );// in heights
+        ui->tableView->setColumnHidden( ColumnBaseValue, true );// base value
+        ui->tableView->setColumnHidden( ColumnInSizes, true );// in sizes
+        ui->tableView->setColumnHidden( ColumnInHeights, true );// in heights
     }
 
-    connect(ui->tableWidget, &QTableWidget::itemSelectionChanged, this, &TMainWindow::ShowMData);
-
-    ShowUnits();
-
-    ui->tableWidget->resizeColumnsToContents();
-    ui->tableWidget->resizeRowsToContents();
-    ui->tableWidget->horizontalHeader()->setStretchLastSection(true);
-}
-
-//---------------------------------------------------------------------------------------------------------------------
-void TMainWindow::ShowUnits()
-{
-    const QString unit = UnitsToStr(mUnit);
-
-    ShowHeaderUnits(ui->tableWidget, ColumnCalcValue, UnitsToStr(pUnit));// calculated value
-    ShowHeaderUnits(ui->tableWidget, ColumnFormula, unit);// formula
-    ShowHeaderUnits(ui->tableWidget, ColumnBaseValue, unit);// base value
-    ShowHeaderUnits(ui->tableWidget, ColumnInSizes, unit);// in sizes
-    ShowHeaderUnits(ui->tableWidget, ColumnInHeights, unit);// in heights
-}
+    connect(ui->tableView->selectionModel(), &QItemSelectionModel::selectionChanged, this, &TMainWindow::ShowMData);
 
-//---------------------------------------------------------------------------------------------------------------------
-void TMainWindow::ShowHeaderUnits(QTableWidget *table, int column, const QString &unit)
-{
-    SCASSERT(table != nullptr)
+    model->SetContext(data, mType, mUnit, pUnit, locale());
 
-    QString header = table->horizontalHeaderItem(column)->text();
-    const int index = header.indexOf(QLatin1String("("));
-    if (index != -1)
-    {
-        header.remove(index-1, 100);
-    }
-    const QString unitHeader = QStringLiteral("%1 (%2)").arg(header, unit);
-    table->horizontalHeaderItem(column)->setText(unitHeader);
+    ui->tableView->resizeColumnsToContents();
+    ui->tableView->resizeRowsToContents();
+    ui->tableView->horizontalHeader()->setStretchLastSection(true);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2279,7 +2219,7 @@ bool TMainWindow::MaybeSave()
 {
     if (this->isWindowModified())
     {
-        if (curFile.isEmpty() && ui->tableWidget->rowCount() == 0)
+        if (curFile.isEmpty() && model->rowCount() == 0)
         {
             return true;// Don't ask if file was created without modifications.
         }
@@ -2321,30 +2261,6 @@ bool TMainWindow::MaybeSave()
     return true;
 }
 
-//---------------------------------------------------------------------------------------------------------------------
-QTableWidgetItem *TMainWindow::AddCell(const QString &text, int row, int column, int aligment, bool ok)
-{
-    auto *item = new QTableWidgetItem(text);
-    item->setTextAlignment(aligment);
-    item->setToolTip(text);
-
-    // set the item non-editable (view only), and non-selectable
-    Qt::ItemFlags flags = item->flags();
-    flags &= ~(Qt::ItemIsEditable); // reset/clear the flag
-    item->setFlags(flags);
-
-    if (not ok)
-    {
-        QBrush brush = item->foreground();
-        brush.setColor(Qt::red);
-        item->setForeground(brush);
-    }
-
-    ui->tableWidget->setItem(row, column, item);
-
-    return item;
-}
-
 //---------------------------------------------------------------------------------------------------------------------
 QComboBox *TMainWindow::SetGradationList(QLabel *label, const QStringList &list)
 {
@@ -2398,10 +2314,7 @@ void TMainWindow::RefreshData(bool freshCall)
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::RefreshTable(bool freshCall)
 {
-    ui->tableWidget->blockSignals(true);
-    ui->tableWidget->clearContents();
-
-    ShowUnits();
+    model->SetContext(data, mType, mUnit, pUnit, locale());
 
     const QMap<QString, QSharedPointer<VMeasurement> > table = data->DataMeasurements();
     QMap<int, QSharedPointer<VMeasurement> > orderedTable;
@@ -2412,77 +2325,65 @@ void TMainWindow::RefreshTable(bool freshCall)
         orderedTable.insert(meash->Index(), meash);
     }
 
-    qint32 currentRow = -1;
-    QMap<int, QSharedPointer<VMeasurement> >::const_iterator iMap;
-    ui->tableWidget->setRowCount ( orderedTable.size() );
-    for (iMap = orderedTable.constBegin(); iMap != orderedTable.constEnd(); ++iMap)
-    {
-        const QSharedPointer<VMeasurement> &meash = iMap.value();
-        currentRow++;
+    // Existing rows are kept and updated in place
+    model->SetMeasurements(orderedTable.values().toVector());
 
-        if (mType == MeasurementsType::Individual)
-        {
-            QTableWidgetItem *item = AddCell(qApp->TrVars()->MToUser(meash->GetName()), currentRow, ColumnName,
-                                             Qt::AlignVCenter); // name
-            item->setData(Qt::UserRole, meash->GetName());
-
-            if (meash->IsCustom())
-            {
-                AddCell(meash->GetGuiText(), currentRow, ColumnFullName, Qt::AlignVCenter);
-            }
-            else
-            {
-                AddCell(qApp->TrVars()->GuiText(meash->GetName()), currentRow, ColumnFullName, Qt::AlignVCenter);
-            }
+    if (freshCall)
+    {
+        ui->tableView->resizeColumnsToContents();
+        ui->tableView->resizeRowsToContents();
+    }
+    ui->tableView->horizontalHeader()->setStretchLastSection(true);
 
-            const qreal value = UnitConvertor(*meash->GetValue(), mUnit, pUnit);
-            AddCell(locale().toString(value), currentRow, ColumnCalcValue, Qt::AlignHCenter | Qt::AlignVCenter,
-                    meash->IsFormulaOk()); // calculated value
+    ui->actionExportToCSV->setEnabled(model->rowCount() > 0);
+}
 
-            QString formula = VTranslateVars::TryFormulaToUser(meash->GetFormula(), qApp->Settings()->GetOsSeparator());
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RefreshMeasurement update data and table after change of one measurement.
+ *
+ * Only the measurement itself and measurements depending on it will be evaluated and shown again.
+ * @param name measurement name in internal look.
+ */
+void TMainWindow::RefreshMeasurement(const QString &name)
+{
+    const QStringList updated = m->ReadMeasurement(name, currentHeight, currentSize);
 
-            AddCell(formula, currentRow, ColumnFormula, Qt::AlignVCenter); // formula
+    for (auto &mName : updated)
+    {
+        try
+        {
+            model->UpdateMeasurement(data->GetVariable<VMeasurement>(mName));
         }
-        else
+        catch(const VExceptionBadId &e)
         {
-            QTableWidgetItem *item = AddCell(qApp->TrVars()->MToUser(meash->GetName()), currentRow, 0,
-                                             Qt::AlignVCenter); // name
-            item->setData(Qt::UserRole, meash->GetName());
-
-            if (meash->IsCustom())
-            {
-                AddCell(meash->GetGuiText(), currentRow, ColumnFullName, Qt::AlignVCenter);
-            }
-            else
-            {
-                AddCell(qApp->TrVars()->GuiText(meash->GetName()), currentRow, ColumnFullName, Qt::AlignVCenter);
-            }
-
-            const qreal value = UnitConvertor(*data->DataVariables()->value(meash->GetName())->GetValue(), mUnit,
-                                              pUnit);
-            AddCell(locale().toString(value), currentRow, ColumnCalcValue,
-                    Qt::AlignHCenter | Qt::AlignVCenter, meash->IsFormulaOk()); // calculated value
-
-            AddCell(locale().toString(meash->GetBase()), currentRow, ColumnBaseValue,
-                    Qt::AlignHCenter | Qt::AlignVCenter); // base value
-
-            AddCell(locale().toString(meash->GetKsize()), currentRow, ColumnInSizes,
-                    Qt::AlignHCenter | Qt::AlignVCenter); // in sizes
-
-            AddCell(locale().toString(meash->GetKheight()), currentRow, ColumnInHeights,
-                    Qt::AlignHCenter | Qt::AlignVCenter); // in heights
+            Q_UNUSED(e)
         }
     }
+}
 
-    if (freshCall)
+//---------------------------------------------------------------------------------------------------------------------
+int TMainWindow::CurrentRow() const
+{
+    return ui->tableView->currentIndex().row();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SelectRow select a row and show its data.
+ *
+ * The model keeps selection while its data change, so data of already selected row must be shown explicitly.
+ */
+void TMainWindow::SelectRow(int row)
+{
+    if (row >= 0 && row == CurrentRow() && ui->tableView->selectionModel()->isRowSelected(row, QModelIndex()))
     {
-        ui->tableWidget->resizeColumnsToContents();
-        ui->tableWidget->resizeRowsToContents();
+        ShowMData();
+    }
+    else
+    {
+        ui->tableView->selectRow(row);
     }
-    ui->tableWidget->horizontalHeader()->setStretchLastSection(true);
-    ui->tableWidget->blockSignals(false);
-
-    ui->actionExportToCSV->setEnabled(ui->tableWidget->rowCount() > 0);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2502,7 +2403,7 @@ QString TMainWindow::GetCustomName() const
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::Controls()
 {
-    if (ui->tableWidget->rowCount() > 0)
+    if (model->rowCount() > 0)
     {
         ui->toolButtonRemove->setEnabled(true);
     }
@@ -2511,16 +2412,16 @@ void TMainWindow::Controls()
         ui->toolButtonRemove->setEnabled(false);
     }
 
-    if (ui->tableWidget->rowCount() >= 2)
+    if (model->rowCount() >= 2)
     {
-        if (ui->tableWidget->currentRow() == 0)
+        if (CurrentRow() == 0)
         {
             ui->toolButtonTop->setEnabled(false);
             ui->toolButtonUp->setEnabled(false);
             ui->toolButtonDown->setEnabled(true);
             ui->toolButtonBottom->setEnabled(true);
         }
-        else if (ui->tableWidget->currentRow() == ui->tableWidget->rowCount()-1)
+        else if (CurrentRow() == model->rowCount()-1)
         {
             ui->toolButtonTop->setEnabled(true);
             ui->toolButtonUp->setEnabled(true);
@@ -2726,9 +2627,10 @@ void TMainWindow::UpdatePadlock(bool ro)
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::MeasurementGUI()
 {
-    if (const QTableWidgetItem *nameField = ui->tableWidget->item(ui->tableWidget->currentRow(), ColumnName))
+    const QModelIndex nameField = model->index(CurrentRow(), ColumnName);
+    if (nameField.isValid())
     {
-        const bool isCustom = not (nameField->text().indexOf(CustomMSign) == 0);
+        const bool isCustom = not (nameField.data().toString().indexOf(CustomMSign) == 0);
         ui->lineEditName->setReadOnly(isCustom);
         ui->plainTextEditDescription->setReadOnly(isCustom);
         ui->lineEditFullName->setReadOnly(isCustom);
@@ -2789,7 +2691,7 @@ QStringList TMainWindow::FilterMeasurements(const QStringList &mNew, const QStri
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::UpdatePatternUnit()
 {
-    const int row = ui->tableWidget->currentRow();
+    const int row = CurrentRow();
 
     if (row == -1)
     {
@@ -2800,7 +2702,7 @@ void TMainWindow::UpdatePatternUnit()
 
     search->RefreshList(ui->lineEditFind->text());
 
-    ui->tableWidget->selectRow(row);
+    SelectRow(row);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2884,9 +2786,9 @@ bool TMainWindow::LoadFromExistingFile(const QString &path)
             const bool freshCall = true;
             RefreshData(freshCall);
 
-            if (ui->tableWidget->rowCount() > 0)
+            if (model->rowCount() > 0)
             {
-                ui->tableWidget->selectRow(0);
+                SelectRow(0);
             }
 
             lock.reset();// Now we can unlock the file
@@ -3080,12 +2982,12 @@ void TMainWindow::ShowError(const QString &text)
 //---------------------------------------------------------------------------------------------------------------------
 void TMainWindow::RefreshDataAfterImport()
 {
-    const int currentRow = ui->tableWidget->currentRow();
+    const int currentRow = CurrentRow();
     search->AddRow(currentRow);
     RefreshData();
     search->RefreshList(ui->lineEditFind->text());
 
-    ui->tableWidget->selectRow(currentRow);
+    SelectRow(currentRow);
     ui->actionExportToCSV->setEnabled(true);
     MeasurementsWereSaved(false);
 }
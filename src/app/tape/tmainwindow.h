@@ -29,7 +29,7 @@
 #ifndef TMAINWINDOW_H
 #define TMAINWINDOW_H
 
-#include <QTableWidget>
+#include <QTableView>
 
 #include "../vmisc/def.h"
 #include "../vmisc/vlockguard.h"
@@ -44,6 +44,7 @@ namespace Ui
 
 class QLabel;
 class QxtCsvModel;
+class TMeasurementsModel;
 
 class TMainWindow : public VAbstractMainWindow
 {
@@ -144,6 +145,7 @@ private:
     int              formulaBaseHeight;
     QSharedPointer<VLockGuard<char>> lock;
     QSharedPointer<VTableSearch> search;
+    TMeasurementsModel *model;
     QLabel *labelGradationHeights;
     QLabel *labelGradationSizes;
     QLabel *labelPatternUnit;
@@ -161,8 +163,6 @@ private:
     void InitGender(QComboBox *gender);
 
     void ShowNewMData(bool fresh);
-    void ShowUnits();
-    void ShowHeaderUnits(QTableWidget *table, int column, const QString &unit);
 
     void MeasurementsWereSaved(bool saved);
     void SetCurrentFile(const QString &fileName);
@@ -170,8 +170,6 @@ private:
 
     bool MaybeSave();
 
-    QTableWidgetItem *AddCell(const QString &text, int row, int column, int aligment, bool ok = true);
-
     Q_REQUIRED_RESULT QComboBox *SetGradationList(QLabel *label, const QStringList &list);
 
     void       SetDefaultHeight(int value);
@@ -179,6 +177,10 @@ private:
 
     void RefreshData(bool freshCall = false);
     void RefreshTable(bool freshCall = false);
+    void RefreshMeasurement(const QString &name);
+
+    int  CurrentRow() const;
+    void SelectRow(int row);
 
     QString GetCustomName() const;
     QString ClearCustomName(const QString &name) const;
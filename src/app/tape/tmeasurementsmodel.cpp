@@ -0,0 +1,301 @@
+/************************************************************************
+ **
+ **  @file   tmeasurementsmodel.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tmeasurementsmodel.h"
+#include "../vpatterndb/vcontainer.h"
+#include "../vpatterndb/variables/vmeasurement.h"
+#include "../vpatterndb/vtranslatevars.h"
+#include "mapplication.h" // Should be last because of definning qApp
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+QString HeaderWithUnits(const QString &header, Unit unit)
+{
+    return QStringLiteral("%1 (%2)").arg(header, UnitsToStr(unit));
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TMeasurementsModel::TMeasurementsModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+int TMeasurementsModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rows.size();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int TMeasurementsModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ColumnsCount;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVariant TMeasurementsModel::data(const QModelIndex &index, int role) const
+{
+    if (not index.isValid() || index.row() >= m_rows.size() || index.column() >= ColumnsCount)
+    {
+        return QVariant();
+    }
+
+    const Row &row = m_rows.at(index.row());
+    const int column = index.column();
+
+    switch (role)
+    {
+        case Qt::DisplayRole:
+        case Qt::ToolTipRole:
+            return row.cells.value(column);
+        case Qt::TextAlignmentRole:
+            if (column == ColumnName || column == ColumnFullName || column == ColumnFormula)
+            {
+                return static_cast<int>(Qt::AlignVCenter);
+            }
+            return static_cast<int>(Qt::AlignHCenter | Qt::AlignVCenter);
+        case Qt::ForegroundRole:
+            if (column == ColumnCalcValue && not row.ok)
+            {
+                return QBrush(Qt::red);
+            }
+            return QVariant();
+        case Qt::BackgroundRole:
+            return row.background.contains(column) ? QVariant(row.background.value(column)) : QVariant();
+        case Qt::UserRole:
+            return column == ColumnName ? QVariant(row.name) : QVariant();
+        default:
+            return QVariant();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief setData only background can be changed. Search uses it to highlight found cells.
+ */
+bool TMeasurementsModel::setData(const QModelIndex &index, const QVariant &value, int role)
+{
+    if (role != Qt::BackgroundRole || not index.isValid() || index.row() >= m_rows.size())
+    {
+        return false;
+    }
+
+    QMap<int, QBrush> &background = m_rows[index.row()].background;
+    if (value.isValid())
+    {
+        background.insert(index.column(), value.value<QBrush>());
+    }
+    else if (background.remove(index.column()) == 0)
+    {
+        return true;
+    }
+
+    emit dataChanged(index, index, {Qt::BackgroundRole});
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVariant TMeasurementsModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+    {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+
+    switch (section)
+    {
+        case ColumnName:
+            return tr("Name");
+        case ColumnFullName:
+            return tr("Full name");
+        case ColumnCalcValue:
+            return HeaderWithUnits(tr("Calculated value"), m_pUnit);
+        case ColumnFormula:
+            return HeaderWithUnits(tr("Formula"), m_mUnit);
+        case ColumnBaseValue:
+            return HeaderWithUnits(tr("Base value"), m_mUnit);
+        case ColumnInSizes:
+            return HeaderWithUnits(tr("In sizes"), m_mUnit);
+        case ColumnInHeights:
+            return HeaderWithUnits(tr("In heights"), m_mUnit);
+        default:
+            return QVariant();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+Qt::ItemFlags TMeasurementsModel::flags(const QModelIndex &index) const
+{
+    if (not index.isValid())
+    {
+        return Qt::NoItemFlags;
+    }
+
+    // View only
+    return Qt::ItemIsSelectable | Qt::ItemIsEnabled;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetContext set everything needed to show values. Call SetMeasurements() after to show values again.
+ * @param data container with measurement values in pattern unit. Used only for multisize measurements.
+ * @param type type of measurements file.
+ * @param mUnit unit of the measurements file.
+ * @param pUnit unit of shown calculated values.
+ * @param locale locale for numbers.
+ */
+void TMeasurementsModel::SetContext(const VContainer *data, MeasurementsType type, Unit mUnit, Unit pUnit,
+                                    const QLocale &locale)
+{
+    m_data = data;
+    m_type = type;
+    m_mUnit = mUnit;
+    m_pUnit = pUnit;
+    m_locale = locale;
+
+    emit headerDataChanged(Qt::Horizontal, 0, ColumnsCount - 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetMeasurements show measurements.
+ *
+ * Existing rows are kept. Rows are inserted or removed at the end, other rows report only changed cells.
+ * @param measurements measurements in file order.
+ */
+void TMeasurementsModel::SetMeasurements(const QVector<QSharedPointer<VMeasurement>> &measurements)
+{
+    const int oldCount = m_rows.size();
+    const int newCount = measurements.size();
+
+    if (newCount < oldCount)
+    {
+        beginRemoveRows(QModelIndex(), newCount, oldCount - 1);
+        m_rows.resize(newCount);
+        endRemoveRows();
+    }
+
+    for (int i = 0; i < qMin(oldCount, newCount); ++i)
+    {
+        UpdateRow(i, MakeRow(measurements.at(i)));
+    }
+
+    if (newCount > oldCount)
+    {
+        beginInsertRows(QModelIndex(), oldCount, newCount - 1);
+        m_rows.reserve(newCount);
+        for (int i = oldCount; i < newCount; ++i)
+        {
+            m_rows.append(MakeRow(measurements.at(i)));
+        }
+        endInsertRows();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief UpdateMeasurement show new values of one measurement. Row is defined by index of the measurement.
+ */
+void TMeasurementsModel::UpdateMeasurement(const QSharedPointer<VMeasurement> &meash)
+{
+    SCASSERT(not meash.isNull())
+
+    const int row = meash->Index();
+    if (row >= 0 && row < m_rows.size())
+    {
+        UpdateRow(row, MakeRow(meash));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TMeasurementsModel::Row TMeasurementsModel::MakeRow(const QSharedPointer<VMeasurement> &meash) const
+{
+    SCASSERT(not meash.isNull())
+
+    Row row;
+    row.name = meash->GetName();
+    row.ok = meash->IsFormulaOk();
+    row.cells.resize(ColumnsCount);
+
+    row.cells[ColumnName] = qApp->TrVars()->MToUser(meash->GetName());
+    row.cells[ColumnFullName] = meash->IsCustom() ? meash->GetGuiText() : qApp->TrVars()->GuiText(meash->GetName());
+
+    if (m_type == MeasurementsType::Individual)
+    {
+        const qreal value = UnitConvertor(*meash->GetValue(), m_mUnit, m_pUnit);
+        row.cells[ColumnCalcValue] = m_locale.toString(value);
+        row.cells[ColumnFormula] = VTranslateVars::TryFormulaToUser(meash->GetFormula(),
+                                                                     qApp->Settings()->GetOsSeparator());
+    }
+    else
+    {
+        SCASSERT(m_data != nullptr)
+        const qreal value = UnitConvertor(*m_data->DataVariables()->value(meash->GetName())->GetValue(), m_mUnit,
+                                          m_pUnit);
+        row.cells[ColumnCalcValue] = m_locale.toString(value);
+        row.cells[ColumnBaseValue] = m_locale.toString(meash->GetBase());
+        row.cells[ColumnInSizes] = m_locale.toString(meash->GetKsize());
+        row.cells[ColumnInHeights] = m_locale.toString(meash->GetKheight());
+    }
+
+    return row;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TMeasurementsModel::UpdateRow(int row, const Row &fresh)
+{
+    Row &old = m_rows[row];
+
+    QVector<bool> changed(ColumnsCount, false);
+    for (int column = 0; column < ColumnsCount; ++column)
+    {
+        changed[column] = old.cells.value(column) != fresh.cells.value(column);
+    }
+    changed[ColumnName] = changed.at(ColumnName) || old.name != fresh.name;
+    changed[ColumnCalcValue] = changed.at(ColumnCalcValue) || old.ok != fresh.ok;
+
+    // Search highlight stays only on cells with the same text
+    QMap<int, QBrush> background;
+    for (auto i = old.background.constBegin(); i != old.background.constEnd(); ++i)
+    {
+        if (not changed.at(i.key()))
+        {
+            background.insert(i.key(), i.value());
+        }
+    }
+
+    old = fresh;
+    old.background = background;
+
+    const int first = changed.indexOf(true);
+    if (first != -1)
+    {
+        emit dataChanged(index(row, first), index(row, changed.lastIndexOf(true)));
+    }
+}
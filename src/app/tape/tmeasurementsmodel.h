@@ -0,0 +1,98 @@
+/************************************************************************
+ **
+ **  @file   tmeasurementsmodel.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef TMEASUREMENTSMODEL_H
+#define TMEASUREMENTSMODEL_H
+
+#include <QAbstractTableModel>
+#include <QBrush>
+#include <QLocale>
+#include <QMap>
+#include <QSharedPointer>
+#include <QVector>
+
+#include "../vmisc/def.h"
+
+class VContainer;
+class VMeasurement;
+
+// We need this enum in case we will add or delete a column. And also make code more readable.
+enum {ColumnName = 0, ColumnFullName, ColumnCalcValue, ColumnFormula, ColumnBaseValue, ColumnInSizes, ColumnInHeights,
+      ColumnsCount};
+
+/**
+ * @brief The TMeasurementsModel class shows measurements of a file in a table.
+ *
+ * The model keeps text of all cells. Updating a measurement reports only cells whose text changed, so views don't
+ * repaint or resize the whole table after each edit. Name in internal look is available through Qt::UserRole of the
+ * name column.
+ */
+class TMeasurementsModel : public QAbstractTableModel
+{
+    Q_OBJECT
+public:
+    explicit TMeasurementsModel(QObject *parent = nullptr);
+    virtual ~TMeasurementsModel() = default;
+
+    virtual int           rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    virtual int           columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    virtual QVariant      data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    virtual bool          setData(const QModelIndex &index, const QVariant &value, int role = Qt::EditRole) override;
+    virtual QVariant      headerData(int section, Qt::Orientation orientation,
+                                     int role = Qt::DisplayRole) const override;
+    virtual Qt::ItemFlags flags(const QModelIndex &index) const override;
+
+    void SetContext(const VContainer *data, MeasurementsType type, Unit mUnit, Unit pUnit, const QLocale &locale);
+
+    void SetMeasurements(const QVector<QSharedPointer<VMeasurement>> &measurements);
+    void UpdateMeasurement(const QSharedPointer<VMeasurement> &meash);
+
+private:
+    Q_DISABLE_COPY(TMeasurementsModel)
+
+    struct Row
+    {
+        QString          name{};
+        QVector<QString> cells{};
+        bool             ok{true};
+        /** @brief background cells highlighted by search. */
+        QMap<int, QBrush> background{};
+    };
+
+    const VContainer *m_data{nullptr};
+    MeasurementsType  m_type{MeasurementsType::Individual};
+    Unit              m_mUnit{Unit::Cm};
+    Unit              m_pUnit{Unit::Cm};
+    QLocale           m_locale{};
+    QVector<Row>      m_rows{};
+
+    Row  MakeRow(const QSharedPointer<VMeasurement> &meash) const;
+    void UpdateRow(int row, const Row &fresh);
+};
+
+#endif // TMEASUREMENTSMODEL_H
@@ -39,6 +39,8 @@
 #include "../qmuparser/qmuparsererror.h"
 #include "../mainwindow.h"
 #include "../vmisc/qt_dispatch/qt_dispatch.h"
+#include "../vmisc/vtrace.h"
+#include "../vlayout/vlayoutprogresslog.h"
 
 #include <QtDebug>
 #include <QDir>
@@ -156,12 +158,15 @@ inline void noisyFailureMsgHandler(QtMsgType type, const QMessageLogContext &con
     {
         QString debugdate = "[" + QDateTime::currentDateTime().toString(QStringLiteral("yyyy.MM.dd hh:mm:ss"));
 
+        // Progress events of nesting own standard output
+        QTextStream &out = VLayoutProgressLog::IsStandardOutput() ? vStdErr() : vStdOut();
+
         switch (type)
         {
             case QtDebugMsg:
                 debugdate += QStringLiteral(":DEBUG:%1(%2)] %3: %4: %5").arg(context.file).arg(context.line)
                              .arg(context.function, context.category, logMsg);
-                vStdOut() << QApplication::translate("vNoisyHandler", "DEBUG:") << logMsg << "\n";
+                out << QApplication::translate("vNoisyHandler", "DEBUG:") << logMsg << "\n";
                 break;
             case QtWarningMsg:
                 if (isPatternMessage)
@@ -194,7 +199,7 @@ inline void noisyFailureMsgHandler(QtMsgType type, const QMessageLogContext &con
                 }
                 debugdate += QStringLiteral(":INFO:%1(%2)] %3: %4: %5").arg(context.file).arg(context.line)
                              .arg(context.function, context.category, logMsg);
-                vStdOut() << QApplication::translate("vNoisyHandler", "INFO:") << logMsg << "\n";
+                out << QApplication::translate("vNoisyHandler", "INFO:") << logMsg << "\n";
                 break;
             #endif
             default:
@@ -307,6 +312,7 @@ VApplication::VApplication(int &argc, char **argv)
 VApplication::~VApplication()
 {
     qCDebug(vApp, "Application closing.");
+    VTrace::Flush();
     qInstallMessageHandler(nullptr); // Resore the message handler
     delete trVars;
     VCommandLine::Reset();
@@ -626,6 +632,7 @@ void VApplication::InitOptions()
 
     // Create command line parser after loading translations to show localized version.
     VCommandLine::Get(*this);
+    VTrace::Enable(CommandLine()->OptTracePath());
 
     if (VApplication::IsGUIMode())// By default console version uses system locale
     {
@@ -740,6 +747,7 @@ void VApplication::AboutToQuit()
     // instance. Solution is to call sync() before quit.
     // Connect this slot with VApplication::aboutToQuit.
     Settings()->sync();
+    VTrace::Flush();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
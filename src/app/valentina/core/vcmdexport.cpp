@@ -243,6 +243,12 @@ VLayoutGeneratorPtr VCommandLine::DefaultGenerator() const
 
     diag.DialogAccepted(); // filling VLayoutGenerator
 
+    res->SetOptimizer(IsOptionSet(LONG_OPTION_NEST_OPTIMIZER));
+    res->SetSeed(OptNestSeed());
+    res->SetUseCache(not IsOptionSet(LONG_OPTION_NO_LAYOUT_CACHE));
+    res->SetCheckpointPath(OptionValue(LONG_OPTION_NEST_CHECKPOINT));
+    res->SetProgressPath(OptionValue(LONG_OPTION_NEST_PROGRESS));
+
     return res;
 }
 
@@ -462,6 +468,12 @@ QString VCommandLine::OptExportFMTo() const
     return OptionValue(LONG_OPTION_CSVEXPORTFM);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+QString VCommandLine::OptTracePath() const
+{
+    return OptionValue(LONG_OPTION_TRACE);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QMap<int, QString> VCommandLine::OptUserMaterials() const
 {
@@ -709,6 +721,25 @@ void VCommandLine::InitCommandLineOptions()
          "supports only a maximum of 32768x32768 px images.")},
         {LONG_OPTION_PREFER_ONE_SHEET_SOLUTION,
          translate("VCommandLine", "Prefer one sheet layout solution (export mode).")},
+        {LONG_OPTION_NEST_OPTIMIZER,
+         translate("VCommandLine", "Search for better order and orientation of pieces by simulated annealing instead "
+         "of arranging them from biggest to smallest (export mode). Slower, but often gives shorter layouts.")},
+        {LONG_OPTION_NEST_SEED,
+         translate("VCommandLine", "Seed for the layout optimizer (export mode). The same seed gives the same layout. "
+         "Default value 0."),
+         translate("VCommandLine", "Seed")},
+        {LONG_OPTION_NO_LAYOUT_CACHE,
+         translate("VCommandLine", "Don't use saved layouts and don't save the new one (export mode). Use to measure "
+         "nesting.")},
+        {LONG_OPTION_NEST_CHECKPOINT,
+         translate("VCommandLine", "Keep the best layout found so far in this file and resume from it if the file "
+         "exists (export mode). Lets an interrupted nesting continue where it stopped."),
+         translate("VCommandLine", "The checkpoint file")},
+        {LONG_OPTION_NEST_PROGRESS,
+         translate("VCommandLine", "Write nesting progress as JSON Lines to this file, \"-\" means standard output "
+         "and moves all other messages to standard error (export mode). Events: start, resume, progress, attempt, "
+         "checkpoint, finish."),
+         translate("VCommandLine", "The progress file")},
     //=================================================================================================================
         {{SINGLE_OPTION_SAVELENGTH, LONG_OPTION_SAVELENGTH},
          translate("VCommandLine", "Save length of the sheet if set (export mode). The option tells the program to use "
@@ -735,6 +766,10 @@ void VCommandLine::InitCommandLineOptions()
          translate("VCommandLine", "Disable high dpi scaling. Call this option if has problem with scaling (by default "
          "scaling enabled). Alternatively you can use the %1 environment variable.")
          .arg(QStringLiteral("QT_AUTO_SCREEN_SCALE_FACTOR=0"))},
+        {LONG_OPTION_TRACE,
+         translate("VCommandLine", "Record timings of pattern parsing, layout nesting and export and save them in "
+         "Chrome trace event format. Open the file in chrome://tracing or Perfetto to inspect it."),
+         translate("VCommandLine", "Path to trace file")},
     //=================================================================================================================
         {LONG_OPTION_CSVWITHHEADER,
          translate("VCommandLine", "Export to csv with header. By default disabled.")},
@@ -838,4 +873,24 @@ qreal VCommandLine::OptEfficiencyCoefficient() const
     return coefficient;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+quint32 VCommandLine::OptNestSeed() const
+{
+    quint32 seed = 0;
+    if (IsOptionSet(LONG_OPTION_NEST_SEED))
+    {
+        bool ok = false;
+        seed = OptionValue(LONG_OPTION_NEST_SEED).toUInt(&ok);
+
+        if (not ok)
+        {
+            qCritical() << translate("VCommandLine", "Seed must be a non-negative integer.")
+                        << "\n";
+            const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+        }
+    }
+
+    return seed;
+}
+
 #undef translate
@@ -103,6 +103,9 @@ public:
     //@brief returns the destination path for export final measurements or empty string if not set
     QString OptExportFMTo() const;
 
+    //@brief returns the path to a trace file or empty string if tracing was not requested
+    QString OptTracePath() const;
+
     //@brief returns list of user defined materials
     QMap<int, QString> OptUserMaterials() const;
 
@@ -156,6 +159,7 @@ private:
 
     int   OptNestingTime() const;
     qreal OptEfficiencyCoefficient() const;
+    quint32 OptNestSeed() const;
 };
 
 #endif // VCMDEXPORT_H
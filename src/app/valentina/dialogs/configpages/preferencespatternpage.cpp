@@ -30,6 +30,7 @@
 #include "ui_preferencespatternpage.h"
 #include "../../core/vapplication.h"
 #include "../ifc/xml/vabstractpattern.h"
+#include "../vtools/undocommands/vundopayload.h"
 #include "../dialogdatetimeformats.h"
 #include "../dialogknownmaterials.h"
 
@@ -71,6 +72,7 @@ PreferencesPatternPage::PreferencesPatternPage(QWidget *parent)
     ui->doubleSpinBoxCurveApproximation->setMinimum(minCurveApproximationScale);
     ui->doubleSpinBoxCurveApproximation->setMaximum(maxCurveApproximationScale);
     ui->undoCount->setValue(settings->GetUndoCount());
+    ui->spinBoxUndoMemory->setValue(settings->GetUndoMemory());
 
     //----------------------- Unit setup
     // set default unit
@@ -153,6 +155,10 @@ QStringList PreferencesPatternPage::Apply()
      * prints a warning and does nothing.*/
     settings->SetUndoCount(ui->undoCount->value());
 
+    // Unlike the count the memory limit can be changed at any time
+    settings->SetUndoMemory(ui->spinBoxUndoMemory->value());
+    VUndoPayload::SetBudget(static_cast<qint64>(ui->spinBoxUndoMemory->value()) * 1024 * 1024);
+
     settings->SetDefaultSeamAllowance(ui->defaultSeamAllowance->value());
 
     settings->SetForbidWorkpieceFlipping(ui->forbidFlippingCheck->isChecked());
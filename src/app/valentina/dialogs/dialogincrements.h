@@ -34,6 +34,7 @@
 #include "../vmisc/vtablesearch.h"
 
 #include <QPair>
+#include <QTableWidget>
 
 class VIndividualMeasurements;
 
@@ -376,6 +376,30 @@ void DialogLayoutSettings::SetNestQuantity(bool state)
     ui->checkBoxNestQuantity->setChecked(state);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+bool DialogLayoutSettings::IsRepairLayout() const
+{
+    return ui->checkBoxRepairLayout->isChecked();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void DialogLayoutSettings::SetRepairLayout(bool state)
+{
+    ui->checkBoxRepairLayout->setChecked(state);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool DialogLayoutSettings::IsUseLayoutCache() const
+{
+    return ui->checkBoxLayoutCache->isChecked();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void DialogLayoutSettings::SetUseLayoutCache(bool state)
+{
+    ui->checkBoxLayoutCache->setChecked(state);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QString DialogLayoutSettings::SelectedPrinter() const
 {
@@ -618,6 +642,8 @@ void DialogLayoutSettings::DialogAccepted()
     generator->SetMultiplier(GetMultiplier());
     generator->SetTextAsPaths(IsTextAsPaths());
     generator->SetNestQuantity(IsNestQuantity());
+    generator->SetRepairLayout(IsRepairLayout());
+    generator->SetUseCache(IsUseLayoutCache());
 
     if (IsIgnoreAllFields())
     {
@@ -708,6 +734,8 @@ void DialogLayoutSettings::RestoreDefaults()
     SetNestingTime(VSettings::GetDefNestingTime());
     SetEfficiencyCoefficient(VSettings::GetDefEfficiencyCoefficient());
     SetNestQuantity(VSettings::GetDefLayoutNestQuantity());
+    SetRepairLayout(VSettings::GetDefLayoutRepair());
+    SetUseLayoutCache(VSettings::GetDefLayoutCache());
     SetPreferOneSheetSolution(VSettings::GetDefLayoutPreferOneSheetSolution());
 
     CorrectMaxFileds();
@@ -1041,6 +1069,8 @@ void DialogLayoutSettings::ReadSettings()
     SetMultiplier(settings->GetMultiplier());
     SetTextAsPaths(settings->GetTextAsPaths());
     SetNestQuantity(settings->GetLayoutNestQuantity());
+    SetRepairLayout(settings->GetLayoutRepair());
+    SetUseLayoutCache(settings->GetLayoutCache());
 
     FindTemplate();
 
@@ -1071,6 +1101,8 @@ void DialogLayoutSettings::WriteSettings() const
     settings->SetNestingTime(GetNestingTime());
     settings->SetEfficiencyCoefficient(GetEfficiencyCoefficient());
     settings->SetLayoutNestQuantity(IsNestQuantity());
+    settings->SetLayoutRepair(IsRepairLayout());
+    settings->SetLayoutCache(IsUseLayoutCache());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
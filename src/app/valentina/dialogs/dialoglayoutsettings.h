@@ -106,6 +106,12 @@ public:
     bool IsNestQuantity() const;
     void SetNestQuantity(bool state);
 
+    bool IsRepairLayout() const;
+    void SetRepairLayout(bool state);
+
+    bool IsUseLayoutCache() const;
+    void SetUseLayoutCache(bool state);
+
     QString SelectedPrinter() const;
 
     void EnableLandscapeOrientation();
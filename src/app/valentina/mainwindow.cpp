@@ -47,6 +47,7 @@
 #include "../vformat/vmeasurements.h"
 #include "../ifc/xml/vvstconverter.h"
 #include "../ifc/xml/vvitconverter.h"
+#include "../ifc/xml/vautosavejournal.h"
 #include "../vwidgets/vwidgetpopup.h"
 #include "../vwidgets/vmaingraphicsscene.h"
 #include "tools/drawTools/drawtools.h"
@@ -59,6 +60,8 @@
 #include "dialogs/dialogs.h"
 #include "dialogs/vwidgetgroups.h"
 #include "../vtools/undocommands/undogroup.h"
+#include "../vtools/undocommands/vundocommand.h"
+#include "../vtools/undocommands/vundopayload.h"
 #include "dialogs/vwidgetdetails.h"
 #include "../vpatterndb/vpiecepath.h"
 #include "../qmuparser/qmuparsererror.h"
@@ -120,6 +123,41 @@ namespace
 {
 Q_GLOBAL_STATIC_WITH_ARGS(const QString, autosavePrefix, (QLatin1String(".autosave")))
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CollectElementIds collect ids of pattern file elements changed by the command.
+ * @return false if the command changes something the autosave journal can't describe.
+ */
+bool CollectElementIds(const QUndoCommand *command, QVector<quint32> &ids)
+{
+    if (command == nullptr)
+    {
+        return false;
+    }
+
+    if (auto *undoCommand = dynamic_cast<const VUndoCommand *>(command))
+    {
+        if (undoCommand->ElementId() == NULL_ID)
+        {
+            return false;
+        }
+        ids.append(undoCommand->ElementId());
+    }
+    else if (command->childCount() == 0)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < command->childCount(); ++i)
+    {
+        if (not CollectElementIds(command->child(i), ids))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QVector<DetailForLayout> SortDetailsForLayout(const QHash<quint32, VPiece> *allDetails,
                                               const QString &nameRegex = QString())
@@ -188,7 +226,8 @@ MainWindow::MainWindow(QWidget *parent)
       lock(nullptr),
       toolButtonPointerList(),
       m_progressBar(new QProgressBar(this)),
-      m_statusLabel(new QLabel(this))
+      m_statusLabel(new QLabel(this)),
+      m_autosaveJournal(new VAutoSaveJournal(this))
 {
     CreateActions();
     InitScenes();
@@ -229,6 +268,14 @@ MainWindow::MainWindow(QWidget *parent)
     ToolBarTools();
 
     connect(qApp->getUndoStack(), &QUndoStack::cleanChanged, this, &MainWindow::PatternChangesWereSaved);
+    connect(qApp->getUndoStack(), &QUndoStack::indexChanged, this, &MainWindow::UndoIndexChanged);
+    connect(doc, &VPattern::patternChanged, this, [this](bool saved)
+    {
+        if (not saved)
+        {
+            m_autosaveJournal->Invalidate(); // Changed without undo command
+        }
+    });
 
     InitAutoSave();
 
@@ -2200,12 +2247,12 @@ void MainWindow::ToolBarTools()
         settings->SetLabelFontSize(settings->GetLabelFontSize() + 1);
         if (sceneDraw)
         {
-            sceneDraw->update();
+            sceneDraw->UpdateRenderSettings();
         }
 
         if (sceneDetails)
         {
-            sceneDetails->update();
+            sceneDetails->UpdateRenderSettings();
         }
     });
 
@@ -2216,12 +2263,12 @@ void MainWindow::ToolBarTools()
         settings->SetLabelFontSize(settings->GetLabelFontSize() - 1);
         if (sceneDraw)
         {
-            sceneDraw->update();
+            sceneDraw->UpdateRenderSettings();
         }
 
         if (sceneDetails)
         {
-            sceneDetails->update();
+            sceneDetails->UpdateRenderSettings();
         }
     });
 
@@ -2232,12 +2279,12 @@ void MainWindow::ToolBarTools()
         settings->SetLabelFontSize(settings->GetDefLabelFontSize());
         if (sceneDraw)
         {
-            sceneDraw->update();
+            sceneDraw->UpdateRenderSettings();
         }
 
         if (sceneDetails)
         {
-            sceneDetails->update();
+            sceneDetails->UpdateRenderSettings();
         }
     });
 
@@ -2247,12 +2294,12 @@ void MainWindow::ToolBarTools()
         qApp->ValentinaSettings()->SetHideLabels(checked);
         if (sceneDraw)
         {
-            sceneDraw->update();
+            sceneDraw->UpdateRenderSettings();
         }
 
         if (sceneDetails)
         {
-            sceneDetails->update();
+            sceneDetails->UpdateRenderSettings();
         }
     });
 }
@@ -2651,6 +2698,7 @@ void MainWindow::RestoreCurrentScene()
 
     /*Set transform for current scene*/
     ui->view->setTransform(scene->transform());
+    scene->UpdateRenderSettings();
     /*Set value for current scene scroll bar.*/
     QScrollBar *horScrollBar = ui->view->horizontalScrollBar();
     horScrollBar->setValue(scene->getHorScrollBar());
@@ -3003,7 +3051,7 @@ bool MainWindow::on_actionSaveAs_triggered()
         QStringList restoreFiles = qApp->ValentinaSettings()->GetRestoreFileList();
         restoreFiles.removeAll(oldFilePath);
         qApp->ValentinaSettings()->SetRestoreFileList(restoreFiles);
-        QFile::remove(oldFilePath + *autosavePrefix);
+        RemoveAutoSave(oldFilePath);
     }
 
     patternReadOnly = false;
@@ -3093,7 +3141,7 @@ bool MainWindow::on_actionSave_triggered()
         bool result = SavePattern(qApp->GetPatternPath(), error);
         if (result)
         {
-            QFile::remove(qApp->GetPatternPath() + *autosavePrefix);
+            RemoveAutoSave(qApp->GetPatternPath());
             m_curFileFormatVersion = VPatternConverter::PatternMaxVer;
             m_curFileFormatVersionStr = VPatternConverter::PatternMaxVerStr;
         }
@@ -3237,11 +3285,8 @@ void MainWindow::FileClosedCorrect()
     qApp->ValentinaSettings()->SetRestoreFileList(restoreFiles);
 
     // Remove autosave file
-    QFile autofile(qApp->GetPatternPath() + *autosavePrefix);
-    if (autofile.exists())
-    {
-        autofile.remove();
-    }
+    m_autosaveJournal->Stop();
+    VAutoSaveJournal::Remove(qApp->GetPatternPath() + *autosavePrefix);
     qCDebug(vMainWindow, "File %s closed correct.", qUtf8Printable(qApp->GetPatternPath()));
 }
 
@@ -3795,6 +3840,33 @@ void MainWindow::ClearPatternMessages()
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief UndoIndexChanged write elements touched by done or undone commands to the autosave journal.
+ * @param index new undo stack index.
+ */
+void MainWindow::UndoIndexChanged(int index)
+{
+    int from = qMin(index, m_undoIndex);
+    const int to = qMax(index, m_undoIndex);
+    if (from == to)
+    {
+        from = index - 1; // The last command was merged with a new one
+    }
+    m_undoIndex = index;
+
+    QVector<quint32> ids;
+    for (int i = qMax(from, 0); i < to; ++i)
+    {
+        if (not CollectElementIds(qApp->getUndoStack()->command(i), ids))
+        {
+            m_autosaveJournal->Invalidate();
+            return;
+        }
+    }
+    m_autosaveJournal->Record(ids);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void MainWindow::SetDefaultHeight()
 {
@@ -3989,21 +4061,50 @@ bool MainWindow::SavePattern(const QString &fileName, QString &error)
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
- * @brief AutoSavePattern start safe saving.
+ * @brief AutoSavePattern start safe saving. Only a copy of the document is made here, the file is written in
+ * background. Changes made by undo commands are already in the autosave journal and don't need a new copy.
  */
 void MainWindow::AutoSavePattern()
 {
     if (not qApp->GetPatternPath().isEmpty() && isWindowModified() && isNeedAutosave)
     {
+        if (not m_autosaveJournal->NeedSnapshot())
+        {
+            isNeedAutosave = false;
+            return;
+        }
+
         qCDebug(vMainWindow, "Autosaving pattern.");
-        QString error;
-        if (SavePattern(qApp->GetPatternPath() + *autosavePrefix, error))
+        if (m_autosaveJournal->Snapshot())
         {
             isNeedAutosave = false;
         }
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RemoveAutoSave remove autosave files of a pattern that was just saved. Removing files of the current pattern
+ * also restarts the journal session, otherwise the session would keep appending to a deleted journal.
+ * @param patternPath path to the pattern file.
+ */
+void MainWindow::RemoveAutoSave(const QString &patternPath)
+{
+    const bool current = (patternPath == qApp->GetPatternPath());
+    if (current)
+    {
+        m_autosaveJournal->Stop(); // Wait for a snapshot that is still being written
+    }
+
+    VAutoSaveJournal::Remove(patternPath + *autosavePrefix);
+
+    if (current)
+    {
+        m_autosaveJournal->Start(doc, patternPath + *autosavePrefix);
+        m_undoIndex = qApp->getUndoStack()->index();
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief setCurrentFile the function is called to reset the state of a few variables when a file
@@ -4018,6 +4119,17 @@ void MainWindow::setCurrentFile(const QString &fileName)
     emit doc->UpdatePatternLabel();
     qApp->getUndoStack()->setClean();
 
+    // The file on disk is the new base for autosave
+    if (fileName.isEmpty())
+    {
+        m_autosaveJournal->Stop();
+    }
+    else
+    {
+        m_autosaveJournal->Start(doc, fileName + *autosavePrefix);
+    }
+    m_undoIndex = qApp->getUndoStack()->index();
+
     if (not qApp->GetPatternPath().isEmpty() && VApplication::IsGUIMode())
     {
         qCDebug(vMainWindow, "Updating recent file list.");
@@ -4067,6 +4179,7 @@ void MainWindow::ReadSettings()
 
         // Stack limit
         qApp->getUndoStack()->setUndoLimit(settings->GetUndoCount());
+        VUndoPayload::SetBudget(static_cast<qint64>(settings->GetUndoMemory()) * 1024 * 1024);
 
         // Text under tool buton icon
         ToolBarStyles();
@@ -5122,6 +5235,10 @@ void MainWindow::Preferences()
         connect(dlg.data(), &DialogPreferences::UpdateProperties, this, &MainWindow::ToolBarStyles);
         connect(dlg.data(), &DialogPreferences::UpdateProperties, this, &MainWindow::ToolBoxSizePolicy);
         connect(dlg.data(), &DialogPreferences::UpdateProperties, this, [this](){emit doc->FullUpdateFromFile();});
+        connect(dlg.data(), &DialogPreferences::UpdateProperties, sceneDraw,
+                &VMainGraphicsScene::UpdateRenderSettings);
+        connect(dlg.data(), &DialogPreferences::UpdateProperties, sceneDetails,
+                &VMainGraphicsScene::UpdateRenderSettings);
         connect(dlg.data(), &DialogPreferences::UpdateProperties, ui->view,
                 &VMainGraphicsView::ResetScrollingAnimation);
         QGuiApplication::restoreOverrideCursor();
@@ -5269,10 +5386,9 @@ void MainWindow::ReopenFilesAfterCrash(QStringList &args)
                 for (auto &file : restoreFiles)
                 {
                     QString error;
-                    if (VDomDocument::SafeCopy(file + *autosavePrefix, file, error))
+                    if (VAutoSaveJournal::Restore(file + *autosavePrefix, file, error))
                     {
-                        QFile autoFile(file + *autosavePrefix);
-                        autoFile.remove();
+                        VAutoSaveJournal::Remove(file + *autosavePrefix);
                         LoadPattern(file);
                         args.removeAll(file);// Do not open file twice after we restore him.
                     }
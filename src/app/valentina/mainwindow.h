@@ -54,6 +54,7 @@ class QToolButton;
 class QDoubleSpinBox;
 class QProgressBar;
 class WatermarkWindow;
+class VAutoSaveJournal;
 
 /**
  * @brief The MainWindow class main windows.
@@ -214,6 +215,8 @@ private slots:
     void ShowProgress();
     void ClearPatternMessages();
 
+    void UndoIndexChanged(int index);
+
 private:
     Q_DISABLE_COPY(MainWindow)
     /** @brief ui keeps information about user interface */
@@ -283,6 +286,10 @@ private:
     QProgressBar *m_progressBar;
     QLabel       *m_statusLabel;
 
+    VAutoSaveJournal *m_autosaveJournal;
+    /** @brief m_undoIndex undo stack index the autosave journal has seen. */
+    int               m_undoIndex{0};
+
     QList<QPointer<WatermarkWindow>> m_watermarkEditors{};
 
     void               SetDefaultHeight();
@@ -327,6 +334,7 @@ private:
 
     bool               SavePattern(const QString &fileName, QString &error);
     void               AutoSavePattern();
+    void               RemoveAutoSave(const QString &patternPath);
     void               setCurrentFile(const QString &fileName);
 
     void               ReadSettings();
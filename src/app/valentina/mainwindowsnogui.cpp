@@ -36,9 +36,12 @@
 #include "../vmisc/dialogs/dialogexporttocsv.h"
 #include "../vmisc/qxtcsvmodel.h"
 #include "../vmisc/compatibility.h"
+#include "../vmisc/vtrace.h"
 #include "../vformat/vmeasurements.h"
 #include "../vformat/vwatermark.h"
+#include "../vlayout/vlayoutcache.h"
 #include "../vlayout/vlayoutgenerator.h"
+#include "../vlayout/vlayoutprogresslog.h"
 #include "dialogs/dialoglayoutprogress.h"
 #include "dialogs/dialogsavelayout.h"
 #include "dialogs/dialoglayoutscale.h"
@@ -128,6 +131,28 @@ void InsertGlobalContours(const QList<QGraphicsScene *> &scenes, const QList<QGr
         scenes.at(i)->addItem(gcontours.at(i));
     }
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+QString LayoutStateName(LayoutErrors state)
+{
+    switch (state)
+    {
+        case LayoutErrors::NoError:
+            return QStringLiteral("noError");
+        case LayoutErrors::PrepareLayoutError:
+            return QStringLiteral("prepareLayoutError");
+        case LayoutErrors::ProcessStoped:
+            return QStringLiteral("processStopped");
+        case LayoutErrors::EmptyPaperError:
+            return QStringLiteral("emptyPaperError");
+        case LayoutErrors::Timeout:
+            return QStringLiteral("timeout");
+        case LayoutErrors::TerminatedByException:
+            return QStringLiteral("terminatedByException");
+        default:
+            return QString();
+    }
+}
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -218,9 +243,22 @@ bool MainWindowsNoGUI::GenerateLayout(VLayoutGenerator& lGenerator)
     QElapsedTimer timer;
     timer.start();
 
+    int papersCount = INT_MAX;
+    qreal efficiency = 0;
+    bool hasResult = false;
+
+    VLayoutProgressLog progressLog(lGenerator.GetProgressPath(), timer);
+    progressLog.Event(QStringLiteral("start"), QJsonObject
+    {
+        {QStringLiteral("pieces"), lGenerator.DetailsCount()},
+        {QStringLiteral("nestingTimeMs"), lGenerator.GetNestingTimeMSecs()},
+        {QStringLiteral("optimizer"), lGenerator.IsOptimizer()}
+    });
+
 #if defined(Q_OS_WIN32) && QT_VERSION >= QT_VERSION_CHECK(5, 7, 0)
     QTimer *progressTimer = nullptr;
 #endif
+    QScopedPointer<QTimer> nestingTimer;
 
     QSharedPointer<DialogLayoutProgress> progress;
     if (VApplication::IsGUIMode())
@@ -247,20 +285,27 @@ bool MainWindowsNoGUI::GenerateLayout(VLayoutGenerator& lGenerator)
     }
     else
     {
-        // Because the progress bar dialog will not terminate nesting we must create separate timer for this
-        auto *progressTimer = new QTimer(this);
-        connect(progressTimer, &QTimer::timeout, this, [timer, &lGenerator, progressTimer]()
+        // Because the progress bar dialog will not terminate nesting we must create separate timer for this.
+        // The timer must not outlive the generator, nesting can finish long before the timeout.
+        nestingTimer.reset(new QTimer());
+        QTimer *timeoutTimer = nestingTimer.data();
+        connect(timeoutTimer, &QTimer::timeout, this, [timer, &lGenerator, &progressLog, &efficiency, timeoutTimer]()
         {
+            progressLog.Event(QStringLiteral("progress"), QJsonObject
+            {
+                {QStringLiteral("placed"), lGenerator.ArrangedCount()},
+                {QStringLiteral("bestEfficiency"), efficiency}
+            });
+
             const int timeout = static_cast<int>(lGenerator.GetNestingTimeMSecs() - timer.elapsed());
 
             if (timeout <= 1000)
             {
                 lGenerator.Timeout();
-                progressTimer->stop();
-                progressTimer->deleteLater();
+                timeoutTimer->stop();
             }
         });
-        progressTimer->start(1000);
+        timeoutTimer->start(1000);
     }
 
     LayoutErrors nestingState = LayoutErrors::NoError;
@@ -287,13 +332,108 @@ bool MainWindowsNoGUI::GenerateLayout(VLayoutGenerator& lGenerator)
     int rotatate = 1;
     lGenerator.SetShift(-1); // Trigger first shift calulation
     lGenerator.SetRotate(false);
-    int papersCount = INT_MAX;
-    qreal efficiency = 0;
-    bool hasResult = false;
+
+    auto TakeResult = [this, &lGenerator, &progress, &efficiency, &papersCount, &hasResult](qreal layoutEfficiency)
+    {
+        efficiency = layoutEfficiency;
+        if (VApplication::IsGUIMode())
+        {
+            progress->Efficiency(efficiency);
+        }
+
+        CleanLayout();
+        papers = lGenerator.GetPapersItems();// Blank sheets
+        details = lGenerator.GetAllDetailsItems();// All details items
+        detailsOnLayout = lGenerator.GetAllDetails();// All details items
+        shadows = CreateShadows(papers);
+        isLayoutPortrait = lGenerator.IsPortrait();
+        scenes = CreateScenes(papers, shadows, details);
+#if !defined(V_NO_ASSERT)
+       //Uncomment to debug, shows global contour
+//        gcontours = lGenerator.GetGlobalContours(); // uncomment for debugging
+//        InsertGlobalContours(scenes, gcontours); // uncomment for debugging
+#endif
+        if (VApplication::IsGUIMode())
+        {
+            PrepareSceneList(PreviewQuatilty::Fast);
+        }
+        ignorePrinterFields = not lGenerator.IsUsePrinterFields();
+        margins = lGenerator.GetPrinterFields();
+        paperSize = QSizeF(lGenerator.GetPaperWidth(), lGenerator.GetPaperHeight());
+        layoutSettingsHash = lGenerator.SettingsHash();
+        isAutoCropLength = lGenerator.GetAutoCropLength();
+        isAutoCropWidth = lGenerator.GetAutoCropWidth();
+        isUnitePages = lGenerator.IsUnitePages();
+        isLayoutStale = false;
+        papersCount = lGenerator.PapersCount();
+        hasResult = true;
+        qCDebug(vMainNoGUIWindow, "Layout efficiency: %f", efficiency);
+    };
+
+    // The same pieces with the same settings were nested before. An exact match is the answer, otherwise the saved
+    // layout is the one to beat and the search continues from where it stopped. A checkpoint of an interrupted run
+    // takes precedence over the cache.
+    QByteArray cachedResult;
+    bool exactCacheMatch = false;
+    const QString checkpointPath = lGenerator.GetCheckpointPath();
+    QString resumedFrom;
+    if (not checkpointPath.isEmpty() && VLayoutCache::LoadCheckpoint(lGenerator, cachedResult, checkpointPath))
+    {
+        resumedFrom = QStringLiteral("checkpoint");
+    }
+    else if (lGenerator.IsUseCache() && VLayoutCache::Load(lGenerator, cachedResult, exactCacheMatch))
+    {
+        resumedFrom = QStringLiteral("cache");
+    }
+
+    if (not resumedFrom.isEmpty())
+    {
+        TakeResult(lGenerator.LayoutEfficiency());
+        rotatate = lGenerator.GetRotationNumber();
+        rotationUsed = lGenerator.GetRotate();
+        if (exactCacheMatch)
+        {
+            qCDebug(lLayoutCache, "Layout loaded from cache");
+        }
+        else
+        {
+            qCDebug(lLayoutCache, "Layout search warm-started from %s", qUtf8Printable(resumedFrom));
+        }
+        progressLog.Event(QStringLiteral("resume"), QJsonObject
+        {
+            {QStringLiteral("source"), resumedFrom},
+            {QStringLiteral("efficiency"), efficiency},
+            {QStringLiteral("papers"), papersCount},
+            {QStringLiteral("final"), exactCacheMatch}
+        });
+    }
+
+    // After a small change of the pattern most of the old layout is still valid. Unchanged pieces keep their places
+    // and only changed ones are arranged again. Full nesting runs only if the repaired layout is not good enough.
+    bool repaired = false;
+    if (resumedFrom.isEmpty() && isLayoutStale && lGenerator.IsRepairLayout() && not detailsOnLayout.isEmpty()
+            && layoutSettingsHash == lGenerator.SettingsHash())
+    {
+        lGenerator.SetPreviousLayout(detailsOnLayout);
+        repaired = lGenerator.Repair(timer, lGenerator.GetNestingTimeMSecs());
+        if (repaired)
+        {
+            TakeResult(lGenerator.LayoutEfficiency());
+            qCDebug(vMainNoGUIWindow, "Previous layout repaired");
+        }
+
+        progressLog.Event(QStringLiteral("repair"), QJsonObject
+        {
+            {QStringLiteral("accepted"), repaired},
+            {QStringLiteral("efficiency"), repaired ? efficiency : 0}
+        });
+    }
+
+    int attempt = 0;
 
     QCoreApplication::processEvents();
 
-    forever
+    while (not exactCacheMatch && not repaired)
     {
         if (IsTimeout())
         {
@@ -307,6 +447,9 @@ bool MainWindowsNoGUI::GenerateLayout(VLayoutGenerator& lGenerator)
             break;
         }
 
+        ++attempt;
+        bool improved = false;
+
         switch (lGenerator.State())
         {
             case LayoutErrors::NoError:
@@ -315,38 +458,19 @@ bool MainWindowsNoGUI::GenerateLayout(VLayoutGenerator& lGenerator)
                     const qreal layoutEfficiency = lGenerator.LayoutEfficiency();
                     if (efficiency < layoutEfficiency || lGenerator.PapersCount() < papersCount)
                     {
-                        efficiency = layoutEfficiency;
-                        if (VApplication::IsGUIMode())
-                        {
-                            progress->Efficiency(efficiency);
-                        }
+                        TakeResult(layoutEfficiency);
+                        cachedResult = lGenerator.SerializeResult();
+                        improved = true;
 
-                        CleanLayout();
-                        papers = lGenerator.GetPapersItems();// Blank sheets
-                        details = lGenerator.GetAllDetailsItems();// All details items
-                        detailsOnLayout = lGenerator.GetAllDetails();// All details items
-                        shadows = CreateShadows(papers);
-                        isLayoutPortrait = lGenerator.IsPortrait();
-                        scenes = CreateScenes(papers, shadows, details);
-#if !defined(V_NO_ASSERT)
-                       //Uncomment to debug, shows global contour
-//                        gcontours = lGenerator.GetGlobalContours(); // uncomment for debugging
-//                        InsertGlobalContours(scenes, gcontours); // uncomment for debugging
-#endif
-                        if (VApplication::IsGUIMode())
+                        if (not checkpointPath.isEmpty()
+                                && VLayoutCache::SaveCheckpoint(lGenerator, cachedResult, checkpointPath))
                         {
-                            PrepareSceneList(PreviewQuatilty::Fast);
+                            progressLog.Event(QStringLiteral("checkpoint"), QJsonObject
+                            {
+                                {QStringLiteral("path"), checkpointPath},
+                                {QStringLiteral("efficiency"), efficiency}
+                            });
                         }
-                        ignorePrinterFields = not lGenerator.IsUsePrinterFields();
-                        margins = lGenerator.GetPrinterFields();
-                        paperSize = QSizeF(lGenerator.GetPaperWidth(), lGenerator.GetPaperHeight());
-                        isAutoCropLength = lGenerator.GetAutoCropLength();
-                        isAutoCropWidth = lGenerator.GetAutoCropWidth();
-                        isUnitePages = lGenerator.IsUnitePages();
-                        isLayoutStale = false;
-                        papersCount = lGenerator.PapersCount();
-                        hasResult = true;
-                        qDebug() << "Layout efficiency: " << efficiency;
                     }
                     else
                     {
@@ -399,6 +523,17 @@ bool MainWindowsNoGUI::GenerateLayout(VLayoutGenerator& lGenerator)
 
         nestingState = lGenerator.State();
 
+        progressLog.Event(QStringLiteral("attempt"), QJsonObject
+        {
+            {QStringLiteral("attempt"), attempt},
+            {QStringLiteral("state"), LayoutStateName(nestingState)},
+            {QStringLiteral("papers"), lGenerator.PapersCount()},
+            {QStringLiteral("efficiency"), nestingState == LayoutErrors::NoError ? lGenerator.LayoutEfficiency() : 0},
+            {QStringLiteral("placed"), lGenerator.ArrangedCount()},
+            {QStringLiteral("improved"), improved},
+            {QStringLiteral("bestEfficiency"), efficiency}
+        });
+
         if (nestingState == LayoutErrors::PrepareLayoutError || nestingState == LayoutErrors::ProcessStoped
                 || nestingState == LayoutErrors::TerminatedByException
                 || (nestingState == LayoutErrors::NoError && not qFuzzyIsNull(lGenerator.GetEfficiencyCoefficient())
@@ -435,8 +570,21 @@ bool MainWindowsNoGUI::GenerateLayout(VLayoutGenerator& lGenerator)
         QApplication::alert(this);
     }
 
+    progressLog.Event(QStringLiteral("finish"), QJsonObject
+    {
+        {QStringLiteral("state"), LayoutStateName(nestingState)},
+        {QStringLiteral("attempts"), attempt},
+        {QStringLiteral("papers"), hasResult ? papersCount : 0},
+        {QStringLiteral("efficiency"), efficiency},
+        {QStringLiteral("hasResult"), hasResult}
+    });
+
     if (hasResult && nestingState != LayoutErrors::ProcessStoped)
     {
+        if (lGenerator.IsUseCache() && not exactCacheMatch && not repaired)
+        {
+            VLayoutCache::Save(lGenerator, cachedResult);
+        }
         return true;
     }
     else
@@ -504,6 +652,9 @@ void MainWindowsNoGUI::ExportFMeasurementsToCSV()
 //---------------------------------------------------------------------------------------------------------------------
 void MainWindowsNoGUI::ExportData(const QVector<VLayoutPiece> &listDetails)
 {
+    VTraceScope trace("Export data", "export");
+    trace.AddArg("pieces", listDetails.size());
+
     const LayoutExportFormats format = m_dialogSaveLayout->Format();
 
     if (format == LayoutExportFormats::DXF_AC1006_AAMA ||
@@ -640,7 +791,8 @@ void MainWindowsNoGUI::ExportDetailsAsFlatLayout(const QVector<VLayoutPiece> &li
         item->setTransform(matrix);
     }
 
-    rect = scene->itemsBoundingRect().toRect();
+    // All items were moved by the same offset, no need to walk them again
+    rect.translate(-mx, -my);
 
     QGraphicsRectItem *paper = new QGraphicsRectItem(rect);
     paper->setPen(QPen(Qt::black, 1));
@@ -796,7 +948,8 @@ void MainWindowsNoGUI::ExportDetailsAsApparelLayout(QVector<VLayoutPiece> listDe
         item->setTransform(matrix);
     }
 
-    rect = scene->itemsBoundingRect().toRect();
+    // All items were moved by the same offset, no need to walk them again
+    rect.translate(-mx, -my);
 
     for (int i=0; i < listDetails.count(); ++i)
     {
@@ -1949,6 +2102,13 @@ void MainWindowsNoGUI::ExportScene(const QList<QGraphicsScene *> &scenes,
         {
             const QString name = m_dialogSaveLayout->Path() + '/' + m_dialogSaveLayout->FileName() +
                     QString::number(i+1) + DialogSaveLayout::ExportFormatSuffix(m_dialogSaveLayout->Format());
+
+            VTraceScope trace("Export sheet", "export");
+            if (VTrace::IsEnabled())
+            {
+                trace.AddArg("file", name);
+                trace.AddArg("pieces", details.at(i).size());
+            }
             QBrush *brush = new QBrush();
             brush->setColor( QColor( Qt::white ) );
             QGraphicsScene *scene = scenes.at(i);
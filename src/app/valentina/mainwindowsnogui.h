@@ -118,6 +118,7 @@ protected:
     bool isLayoutPortrait{true};
     QMarginsF margins;
     QSizeF paperSize;
+    QByteArray layoutSettingsHash{};
 
     QSharedPointer<DialogSaveLayout> m_dialogSaveLayout;
 
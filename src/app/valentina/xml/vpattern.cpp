@@ -44,6 +44,7 @@
 #include "../vmisc/vmath.h"
 #include "../vmisc/projectversion.h"
 #include "../vmisc/compatibility.h"
+#include "../vmisc/vtrace.h"
 #include "../qmuparser/qmuparsererror.h"
 #include "../qmuparser/qmutokenparser.h"
 #include "../vgeometry/varc.h"
@@ -149,6 +150,9 @@ void VPattern::CreateEmptyFile()
  */
 void VPattern::Parse(const Document &parse)
 {
+    VTraceScope trace("Parse pattern", "parse");
+    trace.AddArg("mode", static_cast<qint64>(parse));
+
     qCDebug(vXML, "Parsing pattern.");
     switch (parse)
     {
@@ -533,6 +537,8 @@ int VPattern::ElementsToParse() const
  */
 void VPattern::LiteParseTree(const Document &parse)
 {
+    LiteParseStarted(parse);
+
     // Save name current pattern piece
     QString namePP = nameActivPP;
 
@@ -768,6 +774,14 @@ void VPattern::ParseDrawMode(const QDomNode &node, const Document &parse, const
         QDomElement domElement = nodeList.at(i).toElement();
         if (domElement.isNull() == false)
         {
+            VTraceScope trace("Parse tool", "parse");
+            if (VTrace::IsEnabled())
+            {
+                trace.AddArg("tag", domElement.tagName());
+                trace.AddArg("type", domElement.attribute(AttrType, QString()));
+                trace.AddArg("id", domElement.attribute(AttrId, QString()));
+            }
+
             switch (tags.indexOf(domElement.tagName()))
             {
                 case 0: // TagPoint
@@ -824,6 +838,12 @@ void VPattern::ParseDrawMode(const QDomNode &node, const Document &parse, const
 void VPattern::ParseDetailElement(QDomElement &domElement, const Document &parse)
 {
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
+    VTraceScope trace("Parse piece", "parse");
+    if (VTrace::IsEnabled())
+    {
+        trace.AddArg("id", domElement.attribute(AttrId, QString()));
+        trace.AddArg("name", domElement.attribute(AttrName, QString()));
+    }
     try
     {
         VToolSeamAllowanceInitData initData;
@@ -1168,15 +1188,15 @@ void VPattern::PointsCommonAttributes(const QDomElement &domElement, VToolSingle
 {
     PointsCommonAttributes(domElement, initData.id, initData.mx, initData.my);
     initData.name = GetParametrString(domElement, AttrName, QChar('A'));
-    initData.showLabel = GetParametrBool(domElement, AttrShowLabel, trueStr);
+    initData.showLabel = AttributeBool(domElement, AttrShowLabel, true);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::PointsCommonAttributes(const QDomElement &domElement, quint32 &id, qreal &mx, qreal &my)
 {
     ToolsCommonAttributes(domElement, id);
-    mx = qApp->toPixel(GetParametrDouble(domElement, AttrMx, QStringLiteral("10.0")));
-    my = qApp->toPixel(GetParametrDouble(domElement, AttrMy, QStringLiteral("15.0")));
+    mx = qApp->toPixel(AttributeDouble(domElement, AttrMx, 10.0));
+    my = qApp->toPixel(AttributeDouble(domElement, AttrMy, 15.0));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -3599,6 +3619,9 @@ quint32 VPattern::LastToolId() const
 //---------------------------------------------------------------------------------------------------------------------
 void VPattern::RefreshPieceGeometry()
 {
+    VTraceScope trace("Refresh piece geometry", "parse");
+    trace.AddArg("pieces", updatePieces.size());
+
     auto CleanRefreshList = qScopeGuard([this]()
     {
         updatePieces.clear();
@@ -3621,6 +3644,8 @@ void VPattern::RefreshPieceGeometry()
         {
             if (VToolSeamAllowance *piece = qobject_cast<VToolSeamAllowance *>(VAbstractPattern::getTool(pieceId)))
             {
+                VTraceScope pieceTrace("Refresh piece", "parse");
+                pieceTrace.AddArg("id", static_cast<qint64>(pieceId));
                 piece->RefreshGeometry();
             }
         }
@@ -4429,9 +4454,12 @@ void VPattern::PrepareForParse(const Document &parse)
         tools.clear();
         cursor = 0;
         history.clear();
+        ClearGroupIndex();
     }
     else if (parse == Document::LiteParse || parse == Document::FullLiteParse)
     {
+        ClearGroupIndex();
+
         Q_STATIC_ASSERT_X(static_cast<int>(VarType::Unknown) == 9, "Check that you used all types");
         QVector<VarType> types({VarType::LineAngle,
                                 VarType::LineLength,
@@ -51,6 +51,7 @@
 #include "../exception/vexception.h"
 #include "../exception/vexceptionwrongid.h"
 #include "vdomdocument.h"
+#include "../vmisc/vtrace.h"
 
 //This class need for validation pattern file using XSD shema
 class MessageHandler : public QAbstractMessageHandler
@@ -143,6 +144,13 @@ QString VAbstractConverter::Convert()
         throw VException(tr("Error openning a temp file: %1.").arg(m_tmpFile.errorString()));
     }
 
+    VTraceScope trace("Convert file", "parse");
+    if (VTrace::IsEnabled())
+    {
+        trace.AddArg("from", GetFormatVersionStr());
+        trace.AddArg("to", QString::number(MaxVer(), 16));
+    }
+
     m_ver < MaxVer() ? ApplyPatches() : DowngradeToCurrentMaxVersion();
 
     return m_convertedFileName;
@@ -220,6 +228,9 @@ void VAbstractConverter::BiasTokens(int position, int bias, QMap<int, QString> &
  */
 void VAbstractConverter::ValidateXML(const QString &schema) const
 {
+    VTraceScope trace("Validate file", "parse");
+    trace.AddArg("schema", schema);
+
     qCDebug(vXML, "Validation xml file %s.", qUtf8Printable(m_convertedFileName));
     QFile pattern(m_convertedFileName);
     if (not pattern.open(QIODevice::ReadOnly))
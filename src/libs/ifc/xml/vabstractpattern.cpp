@@ -37,6 +37,7 @@
 #include <QStaticStringData>
 #include <QStringData>
 #include <QStringDataPtr>
+#include <QTimer>
 #include <QtDebug>
 #include <QtConcurrentMap>
 #include <QFuture>
@@ -223,6 +224,19 @@ Q_GLOBAL_STATIC_WITH_ARGS(QString, MPathCached, (unknownCharacter))
 Q_GLOBAL_STATIC_WITH_ARGS(QString, WatermarkPathCached, (unknownCharacter))
 Q_GLOBAL_STATIC_WITH_ARGS(QString, companyNameCached, (unknownCharacter))
 
+// One display frame. Interactive edits are coalesced to one lite parsing per frame.
+const int liteParseInterval = 16; // ms
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LiteParseCovers return true if parsing of type what also updates everything parsing of type covered does.
+ */
+bool LiteParseCovers(Document what, Document covered)
+{
+    // Document values go from the widest lite parsing to the narrowest
+    return static_cast<int>(what) <= static_cast<int>(covered);
+}
+
 void ReadExpressionAttribute(QVector<VFormulaField> &expressions, const QDomElement &element, const QString &attribute)
 {
     VFormulaField formula;
@@ -305,8 +319,13 @@ VAbstractPattern::VAbstractPattern(QObject *parent)
       toolsOnRemove(QVector<VDataTool*>()),
       history(QVector<VToolRecord>()),
       patternPieces(),
-      modified(false)
-{}
+      modified(false),
+      m_liteParseTimer(new QTimer(this))
+{
+    m_liteParseTimer->setSingleShot(true);
+    m_liteParseTimer->setInterval(liteParseInterval);
+    connect(m_liteParseTimer, &QTimer::timeout, this, &VAbstractPattern::FlushLiteParse);
+}
 
 //---------------------------------------------------------------------------------------------------------------------
 VAbstractPattern::~VAbstractPattern()
@@ -474,8 +493,10 @@ void VAbstractPattern::ParseGroups(const QDomElement &domElement)
 {
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
-    QMap<quint32, quint32> itemTool;
-    QMap<quint32, bool> itemVisibility;
+    const QString draw = domElement.parentNode().toElement().attribute(AttrName);
+    m_groupIndex.ClearDraw(draw);
+
+    QSet<VGroupIndex::Item> items;
 
     QDomNode domNode = domElement.firstChild();
     while (domNode.isNull() == false)
@@ -487,38 +508,55 @@ void VAbstractPattern::ParseGroups(const QDomElement &domElement)
             {
                 if (domElement.tagName() == TagGroup)
                 {
-                    VContainer::UpdateId(GetParametrUInt(domElement, AttrId, NULL_ID_STR), valentinaNamespace);
+                    const quint32 id = GetParametrUInt(domElement, AttrId, NULL_ID_STR);
+                    VContainer::UpdateId(id, valentinaNamespace);
 
-                    const QPair<bool, QMap<quint32, quint32> > groupData = ParseItemElement(domElement);
-                    const QMap<quint32, quint32> group = groupData.second;
-                    auto i = group.constBegin();
-                    while (i != group.constEnd())
-                    {
-                        if (not itemTool.contains(i.key()))
-                        {
-                            itemTool.insert(i.key(), i.value());
-                        }
-
-                        const bool previous = itemVisibility.value(i.key(), false);
-                        itemVisibility.insert(i.key(), previous || groupData.first);
-                        ++i;
-                    }
+                    VGroupIndex::Group group = ParseGroupElement(domElement);
+                    group.draw = draw;
+                    items.unite(group.items);
+                    m_groupIndex.Insert(id, group);
                 }
             }
         }
         domNode = domNode.nextSibling();
     }
 
-    auto i = itemTool.constBegin();
-    while (i != itemTool.constEnd())
-    {
-        if (tools.contains(i.value()))
-        {
-            VDataTool* tool = tools.value(i.value());
-            tool->GroupVisibility(i.key(), itemVisibility.value(i.key(), true));
-        }
-        ++i;
-    }
+    UpdateItemsVisibility(items);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IndexGroup read one group element into the group index and update visibility of its items.
+ *
+ * Group undo commands call it after they change a group in the document, instead of parsing all groups again.
+ * @param group group element, must be a part of the document.
+ */
+void VAbstractPattern::IndexGroup(const QDomElement &group)
+{
+    Q_ASSERT_X(not group.isNull(), Q_FUNC_INFO, "group is null");
+
+    const quint32 id = GetParametrUInt(group, AttrId, NULL_ID_STR);
+
+    QSet<VGroupIndex::Item> items = m_groupIndex.Value(id).items;
+
+    VGroupIndex::Group data = ParseGroupElement(group);
+    data.draw = group.parentNode().parentNode().toElement().attribute(AttrName);
+    items.unite(data.items);
+    m_groupIndex.Insert(id, data);
+
+    UpdateItemsVisibility(items);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief UnindexGroup remove a group from the group index. Items that are left without a group become visible.
+ * @param id group id.
+ */
+void VAbstractPattern::UnindexGroup(quint32 id)
+{
+    const QSet<VGroupIndex::Item> items = m_groupIndex.Value(id).items;
+    m_groupIndex.Remove(id);
+    UpdateItemsVisibility(items);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -590,6 +628,7 @@ bool VAbstractPattern::ChangeNamePP(const QString &oldName, const QString &newNa
             nameActivPP = newName;
         }
         ppElement.setAttribute(AttrName, newName);
+        m_groupIndex.RenameDraw(oldName, newName);
         emit patternChanged(false);//For situation when we change name directly, without undocommands.
         emit ChangedNameDraw(oldName, newName);
         return true;
@@ -652,6 +691,7 @@ void VAbstractPattern::setXMLContent(const QString &fileName)
 void VAbstractPattern::Clear()
 {
     clear();
+    m_groupIndex.Clear();
     *patternNumberCached = unknownCharacter;
     *labelDateFormatCached = unknownCharacter;
     *patternNameCached = unknownCharacter;
@@ -774,17 +814,16 @@ QVector<quint32> VAbstractPattern::ParsePiecePointRecords(const QDomElement &dom
 VPieceNode VAbstractPattern::ParseSANode(const QDomElement &domElement)
 {
     const quint32 id = VDomDocument::GetParametrUInt(domElement, AttrIdObject, NULL_ID_STR);
-    const bool reverse = VDomDocument::GetParametrUInt(domElement, VAbstractPattern::AttrNodeReverse, QChar('0'));
-    const bool excluded = VDomDocument::GetParametrBool(domElement, VAbstractPattern::AttrNodeExcluded, falseStr);
-    const bool uniqeness = VDomDocument::GetParametrBool(domElement, VAbstractPattern::AttrCheckUniqueness, trueStr);
+    const bool reverse = VDomDocument::AttributeUInt(domElement, VAbstractPattern::AttrNodeReverse, 0);
+    const bool excluded = VDomDocument::AttributeBool(domElement, VAbstractPattern::AttrNodeExcluded, false);
+    const bool uniqeness = VDomDocument::AttributeBool(domElement, VAbstractPattern::AttrCheckUniqueness, true);
     const QString saBefore = VDomDocument::GetParametrString(domElement, VAbstractPattern::AttrSABefore,
                                                              currentSeamAllowance);
     const QString saAfter = VDomDocument::GetParametrString(domElement, VAbstractPattern::AttrSAAfter,
                                                             currentSeamAllowance);
-    const PieceNodeAngle angle = static_cast<PieceNodeAngle>(VDomDocument::GetParametrUInt(domElement, AttrAngle,
-                                                                                           QChar('0')));
+    const PieceNodeAngle angle = static_cast<PieceNodeAngle>(VDomDocument::AttributeUInt(domElement, AttrAngle, 0));
 
-    const bool passmark = VDomDocument::GetParametrBool(domElement, VAbstractPattern::AttrNodePassmark, falseStr);
+    const bool passmark = VDomDocument::AttributeBool(domElement, VAbstractPattern::AttrNodePassmark, false);
     const PassmarkLineType passmarkLine = StringToPassmarkLineType(VDomDocument::GetParametrString(domElement,
                                                                                  VAbstractPattern::AttrNodePassmarkLine,
                                                                                                    strOne));
@@ -792,10 +831,10 @@ VPieceNode VAbstractPattern::ParseSANode(const QDomElement &domElement)
                                                                                 VAbstractPattern::AttrNodePassmarkAngle,
                                                                                                    strStraightforward));
 
-    const bool showSecond = VDomDocument::GetParametrBool(domElement, VAbstractPattern::AttrNodeShowSecondPassmark,
-                                                          trueStr);
+    const bool showSecond = VDomDocument::AttributeBool(domElement, VAbstractPattern::AttrNodeShowSecondPassmark,
+                                                        true);
     const bool manualPassmarkLength =
-            VDomDocument::GetParametrBool(domElement, VAbstractPattern::AttrManualPassmarkLength, falseStr);
+            VDomDocument::AttributeBool(domElement, VAbstractPattern::AttrManualPassmarkLength, false);
     const QString passmarkLength =
             VDomDocument::GetParametrEmptyString(domElement, VAbstractPattern::AttrPassmarkLength);
 
@@ -1718,6 +1757,71 @@ void VAbstractPattern::haveLiteChange()
     emit patternChanged(false);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ScheduleLiteParse request lite parsing for an interactive edit, like dragging a point.
+ *
+ * The document is already changed, only the parsing is postponed to the end of the current frame. All requests that
+ * come during the frame are served by one parsing of the latest document state. Call FlushLiteParse() when the edit
+ * is finished.
+ */
+void VAbstractPattern::ScheduleLiteParse(const Document &parse)
+{
+    if (parse == Document::FullParse)
+    {
+        return;
+    }
+
+    if (not m_liteParsePending || LiteParseCovers(parse, m_pendingLiteParse))
+    {
+        m_pendingLiteParse = parse;
+    }
+    m_liteParsePending = true;
+
+    if (not m_liteParseTimer->isActive())
+    {
+        m_liteParseTimer->start();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FlushLiteParse run postponed lite parsing now.
+ */
+void VAbstractPattern::FlushLiteParse()
+{
+    if (not m_liteParsePending)
+    {
+        return;
+    }
+
+    m_liteParseTimer->stop();
+    m_liteParsePending = false;
+    LiteParseTree(m_pendingLiteParse);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LiteParseStarted must be called by each lite parsing. Postponed parsing that it covers is not needed anymore.
+ */
+void VAbstractPattern::LiteParseStarted(const Document &parse)
+{
+    if (m_liteParsePending && LiteParseCovers(parse, m_pendingLiteParse))
+    {
+        m_liteParseTimer->stop();
+        m_liteParsePending = false;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ClearGroupIndex must be called before parsing groups of all pattern pieces.
+ */
+void VAbstractPattern::ClearGroupIndex()
+{
+    m_groupIndex.Clear();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VAbstractPattern::NeedFullParsing()
 {
@@ -2256,15 +2360,17 @@ bool VAbstractPattern::IsFunction(const QString &token) const
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-QPair<bool, QMap<quint32, quint32> > VAbstractPattern::ParseItemElement(const QDomElement &domElement)
+VGroupIndex::Group VAbstractPattern::ParseGroupElement(const QDomElement &domElement) const
 {
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
     try
     {
-        const bool visible = GetParametrBool(domElement, AttrVisible, trueStr);
-
-        QMap<quint32, quint32> items;
+        VGroupIndex::Group group;
+        group.name = GetParametrString(domElement, AttrName, tr("New group"));
+        group.visible = GetParametrBool(domElement, AttrVisible, trueStr);
+        group.tags = FilterGroupTags(GetParametrEmptyString(domElement, AttrTags));
+        group.tool = GetParametrUInt(domElement, AttrTool, NULL_ID_STR);
 
         const QDomNodeList nodeList = domElement.childNodes();
         const qint32 num = nodeList.size();
@@ -2275,14 +2381,10 @@ QPair<bool, QMap<quint32, quint32> > VAbstractPattern::ParseItemElement(const QD
             {
                 const quint32 object = GetParametrUInt(element, AttrObject, NULL_ID_STR);
                 const quint32 tool = GetParametrUInt(element, AttrTool, NULL_ID_STR);
-                items.insert(object, tool);
+                group.items.insert(VGroupIndex::Item(tool, object));
             }
         }
 
-        QPair<bool, QMap<quint32, quint32> > group;
-        group.first = visible;
-        group.second = items;
-
         return group;
     }
     catch (const VExceptionBadId &e)
@@ -2293,6 +2395,22 @@ QPair<bool, QMap<quint32, quint32> > VAbstractPattern::ParseItemElement(const QD
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief UpdateItemsVisibility show or hide items according to visibility of their groups.
+ */
+void VAbstractPattern::UpdateItemsVisibility(const QSet<VGroupIndex::Item> &items) const
+{
+    for (auto &item : items)
+    {
+        VDataTool* tool = tools.value(item.first, nullptr);
+        if (tool != nullptr)
+        {
+            tool->GroupVisibility(item.second, m_groupIndex.IsItemVisible(item));
+        }
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QMap<int, QString> VAbstractPattern::GetMaterials(const QDomElement &element) const
 {
@@ -2472,36 +2590,18 @@ QDomElement VAbstractPattern::CreateGroup(quint32 id, const QString &name, const
 //---------------------------------------------------------------------------------------------------------------------
 vidtype VAbstractPattern::GroupLinkedToTool(vidtype toolId) const
 {
-    const QDomNodeList groups = elementsByTagName(TagGroup);
-    for (int i=0; i < groups.size(); ++i)
-    {
-        const QDomElement group = groups.at(i).toElement();
-        if (not group.isNull() && group.hasAttribute(AttrTool))
-        {
-            const quint32 id = GetParametrUInt(group, AttrTool, NULL_ID_STR);
-
-            if (toolId == id)
-            {
-                return GetParametrUInt(group, AttrId, NULL_ID_STR);
-            }
-        }
-    }
-
-    return null_id;
+    return m_groupIndex.LinkedGroup(toolId);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VAbstractPattern::GetGroupName(quint32 id)
 {
-    QString name = tr("New group");
-    QDomElement group = elementById(id, TagGroup);
-    if (group.isElement())
+    if (m_groupIndex.Contains(id))
     {
-        name = GetParametrString(group, AttrName, name);
-
+        return m_groupIndex.Value(id).name;
     }
 
-    return name;
+    return tr("New group");
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2511,6 +2611,7 @@ void VAbstractPattern::SetGroupName(quint32 id, const QString &name)
     if (group.isElement())
     {
         group.setAttribute(AttrName, name);
+        m_groupIndex.SetName(id, name);
         modified = true;
         emit patternChanged(false);
     }
@@ -2519,14 +2620,7 @@ void VAbstractPattern::SetGroupName(quint32 id, const QString &name)
 //---------------------------------------------------------------------------------------------------------------------
 QStringList VAbstractPattern::GetGroupTags(vidtype id)
 {
-    QStringList tags;
-    QDomElement group = elementById(id, TagGroup);
-    if (group.isElement())
-    {
-        tags = FilterGroupTags(GetParametrEmptyString(group, AttrTags));
-    }
-
-    return tags;
+    return m_groupIndex.Value(id).tags;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2537,6 +2631,7 @@ void VAbstractPattern::SetGroupTags(quint32 id, const QStringList &tags)
     {
         const QString rawTags = tags.join(',');
         SetAttributeOrRemoveIf(group, AttrTags, rawTags, rawTags.isEmpty());
+        m_groupIndex.SetTags(id, FilterGroupTags(rawTags));
         modified = true;
         emit patternChanged(false);
     }
@@ -2545,20 +2640,7 @@ void VAbstractPattern::SetGroupTags(quint32 id, const QStringList &tags)
 //---------------------------------------------------------------------------------------------------------------------
 QStringList VAbstractPattern::GetGroupCategories() const
 {
-    QSet<QString> categories;
-
-    const QDomNodeList groups = elementsByTagName(TagGroup);
-    for (int i=0; i < groups.size(); ++i)
-    {
-        const QDomElement group = groups.at(i).toElement();
-        if (not group.isNull() && group.hasAttribute(AttrTags))
-        {
-            QStringList groupTags = VAbstractPattern::FilterGroupTags(GetParametrEmptyString(group, AttrTags));
-            categories.unite(ConvertToSet<QString>(groupTags));
-        }
-    }
-
-    return ConvertToList(categories);
+    return m_groupIndex.Categories();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2566,42 +2648,17 @@ QMap<quint32, VGroupData> VAbstractPattern::GetGroups()
 {
     QMap<quint32, VGroupData> data;
 
-    try
+    const QList<vidtype> groups = m_groupIndex.DrawGroups(nameActivPP);
+    for (auto id : groups)
     {
-        QDomElement groups = CreateGroups();
-        if (not groups.isNull())
-        {
-            QDomNode domNode = groups.firstChild();
-            while (domNode.isNull() == false)
-            {
-                if (domNode.isElement())
-                {
-                    const QDomElement group = domNode.toElement();
-                    if (group.isNull() == false)
-                    {
-                        if (group.tagName() == TagGroup)
-                        {
-                            VGroupData groupData;
-                            const quint32 id = GetParametrUInt(group, AttrId, QChar('0'));
-                            groupData.visible = GetParametrBool(group, AttrVisible, trueStr);
-                            groupData.name = GetParametrString(group, AttrName, tr("New group"));
-                            groupData.tags = FilterGroupTags(GetParametrEmptyString(group, AttrTags));
+        const VGroupIndex::Group group = m_groupIndex.Value(id);
 
-                            data.insert(id, groupData);
-                        }
-                    }
-                }
-                domNode = domNode.nextSibling();
-            }
-        }
-        else
-        {
-            qDebug("Can't get tag Groups.");
-        }
-    }
-    catch (const VExceptionConversionError &)
-    {
-        return QMap<quint32, VGroupData>();
+        VGroupData groupData;
+        groupData.visible = group.visible;
+        groupData.name = group.name;
+        groupData.tags = group.tags;
+
+        data.insert(id, groupData);
     }
 
     return data;
@@ -2626,74 +2683,18 @@ QMap<quint32, QString> VAbstractPattern::GetGroupsContainingItem(quint32 toolId,
 
     // TODO : order in alphabetical order
 
-    QDomElement groups = CreateGroups();
-    if (not groups.isNull())
+    const QList<vidtype> groups = m_groupIndex.DrawGroups(nameActivPP);
+    for (auto groupId : groups)
     {
-        QDomNode domNode = groups.firstChild();
-        while (domNode.isNull() == false) // iterate through the groups
+        const bool groupHasItem = m_groupIndex.HasItem(groupId, toolId, objectId);
+        if((containItem && groupHasItem) || (not containItem && not groupHasItem))
         {
-            if (domNode.isElement())
-            {
-                const QDomElement group = domNode.toElement();
-                if (group.isNull() == false)
-                {
-                    if (group.tagName() == TagGroup)
-                    {
-                        bool groupHasItem = GroupHasItem(group, toolId, objectId);
-                        if((containItem && groupHasItem) || (not containItem && not groupHasItem))
-                        {
-                            const quint32 groupId = GetParametrUInt(group, AttrId, QChar('0'));
-                            const QString name = GetParametrString(group, AttrName, tr("New group"));
-                            data.insert(groupId, name);
-                        }
-                    }
-                }
-            }
-            domNode = domNode.nextSibling();
+            data.insert(groupId, m_groupIndex.Value(groupId).name);
         }
     }
-    else
-    {
-        qDebug("Can't get tag Groups.");
-    }
 
     return data;
 }
-//---------------------------------------------------------------------------------------------------------------------
-/**
- * @brief Checks if the given group has the item with the given toolId and objectId
- * @param groupDomElement group dom element
- * @param toolId tool id
- * @param objectId object id
- * @return true if the given group has the item with the given toolId and objectId
- */
-bool VAbstractPattern::GroupHasItem(const QDomElement &groupDomElement, quint32 toolId, quint32 objectId)
-{
-    bool result = false;
-
-    QDomNode itemNode = groupDomElement.firstChild();
-    while (itemNode.isNull() == false) // iterate through the items of the group
-    {
-        if (itemNode.isElement())
-        {
-            const QDomElement item = itemNode.toElement();
-            if (item.isNull() == false)
-            {
-                quint32 toolIdIterate= GetParametrUInt(item, AttrTool, QChar('0'));
-                quint32 objectIdIterate= GetParametrUInt(item, AttrObject, QChar('0'));
-
-                if(toolIdIterate == toolId && objectIdIterate == objectId)
-                {
-                    result = true;
-                    break;
-                }
-            }
-        }
-        itemNode = itemNode.nextSibling();
-    }
-    return result;
-}
-
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief Adds an item to the given group with the given toolId and objectId
@@ -2717,6 +2718,7 @@ QDomElement VAbstractPattern::AddItemToGroup(quint32 toolId, quint32 objectId, q
         item.setAttribute(AttrTool, toolId);
         item.setAttribute(AttrObject, objectId);
         group.appendChild(item);
+        m_groupIndex.AddItem(groupId, toolId, objectId);
 
         // to signalised that the pattern was changed and need to be saved
         modified = true;
@@ -2725,12 +2727,8 @@ QDomElement VAbstractPattern::AddItemToGroup(quint32 toolId, quint32 objectId, q
         // to update the group table of the gui
         emit UpdateGroups();
 
-        // parse the groups to update the drawing, in case the item was added to an invisible group
-        QDomElement groups = CreateGroups();
-        if (not groups.isNull())
-        {
-            ParseGroups(groups);
-        }
+        // update the drawing, in case the item was added to an invisible group
+        UpdateItemsVisibility({VGroupIndex::Item(toolId, objectId)});
 
         return item;
     }
@@ -2775,6 +2773,7 @@ QDomElement VAbstractPattern::RemoveItemFromGroup(quint32 toolId, quint32 object
                     if(toolIdIterate == toolId && objectIdIterate == objectId)
                     {
                         group.removeChild(itemNode);
+                        m_groupIndex.RemoveItem(groupId, toolId, objectId);
 
                         // to signalised that the pattern was changed and need to be saved
                         modified = true;
@@ -2783,12 +2782,8 @@ QDomElement VAbstractPattern::RemoveItemFromGroup(quint32 toolId, quint32 object
                         // to update the group table of the gui
                         emit UpdateGroups();
 
-                        // parse the groups to update the drawing, in case the item was removed from an invisible group
-                        QDomElement groups = CreateGroups();
-                        if (not groups.isNull())
-                        {
-                            ParseGroups(groups);
-                        }
+                        // update the drawing, in case the item was removed from an invisible group
+                        UpdateItemsVisibility({VGroupIndex::Item(toolId, objectId)});
 
                         return item;
                     }
@@ -2813,11 +2808,9 @@ QDomElement VAbstractPattern::RemoveItemFromGroup(quint32 toolId, quint32 object
  */
 bool VAbstractPattern::GroupIsEmpty(quint32 id)
 {
-    QDomElement group = elementById(id, TagGroup);
-
-    if (group.isNull() == false)
+    if (m_groupIndex.Contains(id))
     {
-        return not group.hasChildNodes();
+        return m_groupIndex.Value(id).items.isEmpty();
     }
     else
     {
@@ -2829,10 +2822,9 @@ bool VAbstractPattern::GroupIsEmpty(quint32 id)
 //---------------------------------------------------------------------------------------------------------------------
 bool VAbstractPattern::GetGroupVisibility(quint32 id)
 {
-    QDomElement group = elementById(id, TagGroup);
-    if (group.isElement())
+    if (m_groupIndex.Contains(id))
     {
-        return GetParametrBool(group, AttrVisible, trueStr);
+        return m_groupIndex.Value(id).visible;
     }
     else
     {
@@ -2841,6 +2833,39 @@ bool VAbstractPattern::GetGroupVisibility(quint32 id)
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetGroupsVisibility change visibility of several groups and update their items once.
+ * @param groups new visibility by group id.
+ * @return new visibility of groups that were found.
+ */
+QMap<vidtype, bool> VAbstractPattern::SetGroupsVisibility(const QMap<vidtype, bool> &groups)
+{
+    QMap<vidtype, bool> changed;
+    QSet<VGroupIndex::Item> items;
+
+    auto i = groups.constBegin();
+    while (i != groups.constEnd())
+    {
+        QDomElement group = elementById(i.key(), TagGroup);
+        if (group.isElement())
+        {
+            SetAttribute(group, AttrVisible, i.value());
+            m_groupIndex.SetVisible(i.key(), i.value());
+            items.unite(m_groupIndex.Value(i.key()).items);
+            changed.insert(i.key(), i.value());
+        }
+        else
+        {
+            qDebug("Can't get group by id = %u.", i.key());
+        }
+        ++i;
+    }
+
+    UpdateItemsVisibility(items);
+    return changed;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QString VAbstractPattern::PieceDrawName(quint32 id)
 {
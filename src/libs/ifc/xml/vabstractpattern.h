@@ -42,6 +42,7 @@
 
 #include "../vmisc/def.h"
 #include "vdomdocument.h"
+#include "vgroupindex.h"
 #include "vtoolrecord.h"
 #include "../vlayout/vtextmanager.h"
 
@@ -87,6 +88,8 @@ struct VGroupData
 
 QT_WARNING_POP
 
+class QTimer;
+
 class VAbstractPattern : public VDomDocument
 {
     Q_OBJECT
@@ -206,6 +209,8 @@ public:
     QDomElement    GetDraw(const QString &name) const;
 
     void           ParseGroups(const QDomElement &domElement);
+    void           IndexGroup(const QDomElement &group);
+    void           UnindexGroup(quint32 id);
     QDomElement    CreateGroups();
     QDomElement    CreateGroup(quint32 id, const QString &name, const QStringList &tags,
                                const QMap<quint32, quint32> &groupData, vidtype tool=null_id);
@@ -225,6 +230,7 @@ public:
     QDomElement           RemoveItemFromGroup(quint32 toolId, quint32 objectId, quint32 groupId);
     bool           GroupIsEmpty(quint32 id);
     bool           GetGroupVisibility(quint32 id);
+    QMap<vidtype, bool> SetGroupsVisibility(const QMap<vidtype, bool> &groups);
 
     static QStringList FilterGroupTags(const QString &tags);
 
@@ -428,6 +434,8 @@ signals:
 
 public slots:
     virtual void   LiteParseTree(const Document &parse)=0;
+    void           ScheduleLiteParse(const Document &parse);
+    void           FlushLiteParse();
     void           haveLiteChange();
     void           NeedFullParsing();
     void           ClearScene();
@@ -477,10 +485,20 @@ protected:
 
     QVector<VToolRecord> getLocalHistory(const QString &draw) const;
 
-   bool GroupHasItem(const QDomElement &groupDomElement, quint32 toolId, quint32 objectId);
+    void LiteParseStarted(const Document &parse);
+
+    void ClearGroupIndex();
 private:
     Q_DISABLE_COPY(VAbstractPattern)
 
+    /** @brief m_liteParseTimer fires once per frame while an interactive edit waits for lite parsing. */
+    QTimer *m_liteParseTimer;
+    bool m_liteParsePending{false};
+    Document m_pendingLiteParse{Document::LitePPParse};
+
+    /** @brief m_groupIndex membership of visibility groups, mirrors the groups subtrees of all pattern pieces. */
+    VGroupIndex m_groupIndex{};
+
     QStringList ListIncrements() const;
     QVector<VFormulaField> ListPointExpressions() const;
     QVector<VFormulaField> ListArcExpressions() const;
@@ -497,7 +515,8 @@ private:
     bool IsVariable(const QString& token) const;
     bool IsFunction(const QString& token) const;
 
-    QPair<bool, QMap<quint32, quint32> > ParseItemElement(const QDomElement &domElement);
+    VGroupIndex::Group ParseGroupElement(const QDomElement &domElement) const;
+    void               UpdateItemsVisibility(const QSet<VGroupIndex::Item> &items) const;
 
     QMap<int, QString> GetMaterials(const QDomElement &element) const;
     void               SetMaterials(QDomElement &element, const QMap<int, QString> &materials);
@@ -0,0 +1,565 @@
+/************************************************************************
+ **
+ **  @file   vautosavejournal.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "vautosavejournal.h"
+
+#include <algorithm>
+#include <QDomDocument>
+#include <QFutureWatcher>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QStringList>
+#include <QTextStream>
+#include <QUuid>
+#include <QtConcurrentRun>
+#include <QtDebug>
+
+#include "vdomdocument.h"
+
+namespace
+{
+// Journal bigger than this is folded into a new snapshot on the next autosave.
+const qint64 journalSnapshotLimit = 1024 * 1024;
+const int snapshotIndent = 4;
+
+//---------------------------------------------------------------------------------------------------------------------
+QString SnapshotMark()
+{
+    return QStringLiteral("autosave");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool WriteDocument(const QDomDocument &document, const QString &fileName, QString &error)
+{
+    QSaveFile file(fileName);
+    if (not file.open(QIODevice::WriteOnly))
+    {
+        error = file.errorString();
+        return false;
+    }
+
+    if (not VDomDocument::SaveCanonicalXML(document, &file, snapshotIndent, error))
+    {
+        return false;
+    }
+
+    if (not file.commit())
+    {
+        error = file.errorString();
+        return false;
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ElementPath indexes of child elements that lead from root to element.
+ * @return false if element is not part of the tree anymore.
+ */
+bool ElementPath(const QDomElement &element, const QDomElement &root, QVector<int> &path)
+{
+    path.clear();
+    QDomElement e = element;
+    while (e != root)
+    {
+        if (e.isNull())
+        {
+            return false;
+        }
+
+        int index = 0;
+        for (QDomElement sibling = e.previousSiblingElement(); not sibling.isNull();
+             sibling = sibling.previousSiblingElement())
+        {
+            ++index;
+        }
+        path.prepend(index);
+        e = e.parentNode().toElement();
+    }
+    return not path.isEmpty();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QDomElement FindById(const QDomElement &node, const QString &id)
+{
+    for (QDomElement child = node.firstChildElement(); not child.isNull(); child = child.nextSiblingElement())
+    {
+        if (child.attribute(VDomDocument::AttrId) == id)
+        {
+            return child;
+        }
+
+        const QDomElement found = FindById(child, id);
+        if (not found.isNull())
+        {
+            return found;
+        }
+    }
+    return QDomElement();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QDomElement ChildElement(const QDomElement &parent, int index)
+{
+    QDomElement child = parent.firstChildElement();
+    while (not child.isNull() && index > 0)
+    {
+        child = child.nextSiblingElement();
+        --index;
+    }
+    return child;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void RemoveById(const QDomElement &root, const QString &id)
+{
+    QDomElement element = FindById(root, id);
+    if (not element.isNull())
+    {
+        element.parentNode().removeChild(element);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool ApplyRecord(QDomDocument &document, const QJsonObject &record)
+{
+    const QDomElement root = document.documentElement();
+    const QJsonArray removed = record.value(QLatin1String("removed")).toArray();
+    const QJsonArray changed = record.value(QLatin1String("changed")).toArray();
+
+    // Take out old copies first. Paths describe the tree after the change, so they are valid only when every touched
+    // element is out of the tree.
+    for (auto id : removed)
+    {
+        RemoveById(root, id.toString());
+    }
+
+    for (auto item : changed)
+    {
+        RemoveById(root, item.toObject().value(QLatin1String("id")).toString());
+    }
+
+    for (auto item : changed)
+    {
+        const QJsonObject object = item.toObject();
+        const QJsonArray path = object.value(QLatin1String("path")).toArray();
+        if (path.isEmpty())
+        {
+            return false;
+        }
+
+        QDomElement parent = root;
+        for (int i = 0; i < path.size() - 1 && not parent.isNull(); ++i)
+        {
+            parent = ChildElement(parent, path.at(i).toInt());
+        }
+
+        QDomDocument fragment;
+        if (parent.isNull() || not fragment.setContent(object.value(QLatin1String("xml")).toString()))
+        {
+            return false;
+        }
+
+        const QDomNode element = document.importNode(fragment.documentElement(), true);
+        const QDomElement before = ChildElement(parent, path.last().toInt());
+        if (before.isNull())
+        {
+            parent.appendChild(element);
+        }
+        else
+        {
+            parent.insertBefore(element, before);
+        }
+    }
+    return true;
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+VAutoSaveJournal::VAutoSaveJournal(QObject *parent)
+    : QObject(parent),
+      m_watcher(new QFutureWatcher<QString>(this))
+{
+    connect(m_watcher, &QFutureWatcher<QString>::finished, this, &VAutoSaveJournal::SnapshotWritten);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VAutoSaveJournal::~VAutoSaveJournal()
+{
+    // A snapshot can't be interrupted, let it reach the disk
+    m_watcher->waitForFinished();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Start begin a new journal session for the document. Nothing is written until the first snapshot.
+ * @param doc document to follow.
+ * @param snapshotPath path to the autosave file.
+ */
+void VAutoSaveJournal::Start(VDomDocument *doc, const QString &snapshotPath)
+{
+    Stop();
+
+    m_doc = doc;
+    m_snapshotPath = snapshotPath;
+    m_session = QUuid::createUuid().toString();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VAutoSaveJournal::Stop()
+{
+    m_watcher->waitForFinished();
+    m_pendingSeq = -1;
+
+    m_journal.close();
+    m_doc = nullptr;
+    m_snapshotPath.clear();
+    m_session.clear();
+    m_seq = 0;
+    m_valid = false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Invalidate tell the journal that the document was changed in a way that can't be recorded. Replay will stop
+ * here and the next autosave must take a snapshot.
+ */
+void VAutoSaveJournal::Invalidate()
+{
+    if (m_valid)
+    {
+        QJsonObject record;
+        record[QLatin1String("seq")] = ++m_seq;
+        record[QLatin1String("gap")] = true;
+        Append(QJsonDocument(record).toJson(QJsonDocument::Compact));
+    }
+    m_valid = false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Record append current state of elements touched by a change. Missing elements are recorded as removed.
+ * @param ids ids of touched elements.
+ */
+void VAutoSaveJournal::Record(const QVector<quint32> &ids)
+{
+    if (m_doc == nullptr || not m_valid || ids.isEmpty())
+    {
+        return;
+    }
+
+    struct Changed
+    {
+        QVector<int> path{};
+        QDomElement  element{};
+    };
+
+    const QDomElement root = m_doc->documentElement();
+    QVector<Changed> changed;
+    QJsonArray removed;
+
+    for (auto id : ids)
+    {
+        Changed item;
+        item.element = m_doc->elementById(id, QString(), false);
+        if (ElementPath(item.element, root, item.path))
+        {
+            changed.append(item);
+        }
+        else
+        {
+            removed.append(QString::number(id));
+        }
+    }
+
+    // Replay inserts in document order, so earlier siblings are in place before later ones
+    std::sort(changed.begin(), changed.end(), [](const Changed &a, const Changed &b) {return a.path < b.path;});
+
+    QJsonArray changedArray;
+    QVector<int> lastPath;
+    for (auto &item : changed)
+    {
+        if (not lastPath.isEmpty() && item.path.size() >= lastPath.size()
+                && std::equal(lastPath.cbegin(), lastPath.cend(), item.path.cbegin()))
+        {
+            continue; // Already stored as part of a parent
+        }
+        lastPath = item.path;
+
+        QString xml;
+        QTextStream stream(&xml);
+        item.element.save(stream, -1);
+        stream.flush();
+
+        QJsonArray path;
+        for (auto index : qAsConst(item.path))
+        {
+            path.append(index);
+        }
+
+        QJsonObject object;
+        object[QLatin1String("id")] = item.element.attribute(VDomDocument::AttrId);
+        object[QLatin1String("path")] = path;
+        object[QLatin1String("xml")] = xml;
+        changedArray.append(object);
+    }
+
+    QJsonObject record;
+    record[QLatin1String("seq")] = ++m_seq;
+    if (not removed.isEmpty())
+    {
+        record[QLatin1String("removed")] = removed;
+    }
+    if (not changedArray.isEmpty())
+    {
+        record[QLatin1String("changed")] = changedArray;
+    }
+    Append(QJsonDocument(record).toJson(QJsonDocument::Compact));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VAutoSaveJournal::NeedSnapshot() const
+{
+    return m_doc != nullptr && (not m_valid || m_journal.size() > journalSnapshotLimit);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Snapshot copy the document and write the copy to the autosave file in background.
+ * @return false if there is no document or the previous snapshot is still being written.
+ */
+bool VAutoSaveJournal::Snapshot()
+{
+    if (m_doc == nullptr || m_watcher->isRunning())
+    {
+        return false;
+    }
+
+    if (not m_journal.isOpen())
+    {
+        m_journal.setFileName(JournalPath(m_snapshotPath));
+        if (m_journal.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            QJsonObject header;
+            header[QLatin1String("session")] = m_session;
+            Append(QJsonDocument(header).toJson(QJsonDocument::Compact));
+        }
+        else
+        {
+            qWarning() << tr("Can't open autosave journal %1. Error: %2.")
+                          .arg(m_journal.fileName(), m_journal.errorString());
+        }
+    }
+
+    // Deep copy, the worker thread must not share nodes with the document that is being edited
+    QDomDocument copy = m_doc->cloneNode(true).toDocument();
+    copy.appendChild(copy.createComment(QStringLiteral("%1 %2 %3").arg(SnapshotMark(), m_session).arg(m_seq)));
+
+    m_pendingSeq = m_seq;
+    m_valid = m_journal.isOpen();
+
+    const QString path = m_snapshotPath;
+    m_watcher->setFuture(QtConcurrent::run([copy, path]()
+    {
+        QString error;
+        WriteDocument(copy, path, error);
+        return error;
+    }));
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString VAutoSaveJournal::JournalPath(const QString &snapshotPath)
+{
+    return snapshotPath + QLatin1String(".journal");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Restore write snapshot with replayed journal to destination. Replay stops at the first record that can't be
+ * applied, everything before it is kept.
+ * @param snapshotPath path to the autosave file.
+ * @param destination path to the restored file.
+ * @param error error message.
+ * @return true if all is good.
+ */
+bool VAutoSaveJournal::Restore(const QString &snapshotPath, const QString &destination, QString &error)
+{
+    QDomDocument snapshot;
+    QFile snapshotFile(snapshotPath);
+    if (not snapshotFile.open(QIODevice::ReadOnly) || not snapshot.setContent(&snapshotFile))
+    {
+        return VDomDocument::SafeCopy(snapshotPath, destination, error);
+    }
+    snapshotFile.close();
+
+    QString session;
+    qint64 snapshotSeq = -1;
+    const QDomNode mark = snapshot.lastChild();
+    if (mark.isComment())
+    {
+        const QStringList parts = mark.nodeValue().split(QChar(' '));
+        if (parts.size() == 3 && parts.at(0) == SnapshotMark())
+        {
+            session = parts.at(1);
+            snapshotSeq = parts.at(2).toLongLong();
+            snapshot.removeChild(mark);
+        }
+    }
+
+    QFile journal(JournalPath(snapshotPath));
+    if (not session.isEmpty() && journal.open(QIODevice::ReadOnly))
+    {
+        const QJsonObject header = QJsonDocument::fromJson(journal.readLine()).object();
+        if (header.value(QLatin1String("session")).toString() == session)
+        {
+            int replayed = 0;
+            while (not journal.atEnd())
+            {
+                // The last line can be torn by a crash
+                const QJsonObject record = QJsonDocument::fromJson(journal.readLine()).object();
+                if (record.isEmpty())
+                {
+                    break;
+                }
+
+                // Already part of the snapshot, a gap here is covered too. Old records stay when the journal wasn't
+                // truncated after the snapshot.
+                if (static_cast<qint64>(record.value(QLatin1String("seq")).toDouble()) <= snapshotSeq)
+                {
+                    continue;
+                }
+
+                if (record.value(QLatin1String("gap")).toBool())
+                {
+                    break;
+                }
+
+                if (not ApplyRecord(snapshot, record))
+                {
+                    qWarning() << tr("Autosave journal record %1 can't be applied.")
+                                  .arg(record.value(QLatin1String("seq")).toDouble());
+                    break;
+                }
+                ++replayed;
+            }
+            qDebug("Replayed %d autosave journal records.", replayed);
+        }
+    }
+
+    return WriteDocument(snapshot, destination, error);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VAutoSaveJournal::Remove(const QString &snapshotPath)
+{
+    QFile::remove(snapshotPath);
+    QFile::remove(JournalPath(snapshotPath));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VAutoSaveJournal::SnapshotWritten()
+{
+    if (m_pendingSeq < 0)
+    {
+        return; // Session was stopped
+    }
+
+    const QString error = m_watcher->result();
+    const qint64 seq = m_pendingSeq;
+    m_pendingSeq = -1;
+
+    if (not error.isEmpty())
+    {
+        qWarning() << tr("Can't write autosave %1. Error: %2.").arg(m_snapshotPath, error);
+        // Records are still valid over the previous snapshot, but the next autosave must try again
+        Invalidate();
+        return;
+    }
+
+    Truncate(seq);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VAutoSaveJournal::Append(const QByteArray &record)
+{
+    if (m_journal.isOpen())
+    {
+        m_journal.write(record);
+        m_journal.write("\n");
+        m_journal.flush();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Truncate drop records that are already part of the snapshot.
+ * @param seq sequence number of the last record in the snapshot.
+ */
+void VAutoSaveJournal::Truncate(qint64 seq)
+{
+    if (not m_journal.isOpen())
+    {
+        return;
+    }
+
+    const QString path = m_journal.fileName();
+    m_journal.close();
+
+    QByteArray kept;
+    QFile source(path);
+    if (source.open(QIODevice::ReadOnly))
+    {
+        kept = source.readLine(); // header
+        while (not source.atEnd())
+        {
+            const QByteArray line = source.readLine();
+            const QJsonObject record = QJsonDocument::fromJson(line).object();
+            if (static_cast<qint64>(record.value(QLatin1String("seq")).toDouble()) > seq)
+            {
+                kept.append(line);
+            }
+        }
+        source.close();
+
+        QSaveFile file(path);
+        if (file.open(QIODevice::WriteOnly))
+        {
+            file.write(kept);
+            file.commit();
+        }
+    }
+
+    if (not m_journal.open(QIODevice::WriteOnly | QIODevice::Append))
+    {
+        qWarning() << tr("Can't open autosave journal %1. Error: %2.").arg(path, m_journal.errorString());
+        m_valid = false;
+    }
+}
@@ -0,0 +1,88 @@
+/************************************************************************
+ **
+ **  @file   vautosavejournal.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VAUTOSAVEJOURNAL_H
+#define VAUTOSAVEJOURNAL_H
+
+#include <QFile>
+#include <QObject>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+class VDomDocument;
+template <typename T> class QFutureWatcher;
+
+/**
+ * @brief The VAutoSaveJournal class keeps an autosave copy of a document without blocking the GUI thread.
+ *
+ * A snapshot is a deep copy of the document taken on the GUI thread, serialization and writing happen on a worker
+ * thread. Between snapshots each change appends a compact record with the current state of touched elements to the
+ * journal file. Restore() replays the journal over the snapshot.
+ */
+class VAutoSaveJournal : public QObject
+{
+    Q_OBJECT
+public:
+    explicit VAutoSaveJournal(QObject *parent = nullptr);
+    virtual ~VAutoSaveJournal();
+
+    void Start(VDomDocument *doc, const QString &snapshotPath);
+    void Stop();
+
+    void Invalidate();
+    void Record(const QVector<quint32> &ids);
+
+    bool NeedSnapshot() const;
+    bool Snapshot();
+
+    static QString JournalPath(const QString &snapshotPath);
+    static bool    Restore(const QString &snapshotPath, const QString &destination, QString &error);
+    static void    Remove(const QString &snapshotPath);
+
+private slots:
+    void SnapshotWritten();
+
+private:
+    Q_DISABLE_COPY(VAutoSaveJournal)
+
+    VDomDocument *m_doc{nullptr};
+    QString       m_snapshotPath{};
+    QString       m_session{};
+    QFile         m_journal{};
+    qint64        m_seq{0};
+    qint64        m_pendingSeq{-1};
+    /** @brief m_valid true if records can be replayed over the last snapshot. */
+    bool          m_valid{false};
+    QFutureWatcher<QString> *m_watcher;
+
+    void Append(const QByteArray &record);
+    void Truncate(qint64 seq);
+};
+
+#endif // VAUTOSAVEJOURNAL_H
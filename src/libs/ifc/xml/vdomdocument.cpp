@@ -232,6 +232,78 @@ bool LessThen(const QDomNode &element1, const QDomNode &element2)
     }
     return false;
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+bool ParseBool(const QString &value, bool &result)
+{
+    if (value == trueStr || value == QLatin1String("1"))
+    {
+        result = true;
+        return true;
+    }
+
+    if (value == falseStr || value == QLatin1String("0"))
+    {
+        result = false;
+        return true;
+    }
+
+    return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+qreal ParseDouble(const QString &value, bool *ok)
+{
+    // QString::toDouble always uses C locale and doesn't copy the string
+    const qreal result = value.toDouble(ok);
+    if (not *ok && value.contains(QChar(',')))
+    {// Old files can contain comma as decimal separator
+        return QString(value).replace(QChar(','), QChar('.')).toDouble(ok);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename T, typename Parse>
+T ReadAttribute(const QDomElement &domElement, const QString &name, T defValue, bool *ok, Parse parse)
+{
+    Q_ASSERT_X(not name.isEmpty(), Q_FUNC_INFO, "name of parametr is empty");
+    Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
+
+    const QString value = domElement.attribute(name);
+    bool converted = true;
+    T result = defValue;
+    if (not value.isEmpty())
+    {
+        result = parse(value, &converted);
+        if (not converted)
+        {
+            result = defValue;
+        }
+    }
+
+    if (ok != nullptr)
+    {
+        *ok = converted;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ThrowConversionError slow path of GetParametr* functions. Builds the same exception as old try/catch blocks.
+ */
+Q_NORETURN void ThrowConversionError(const QDomElement &domElement, const QString &name, const QString &defValue,
+                                     const QString &message)
+{
+    VExceptionConversionError excep(message, name);
+    if (domElement.attribute(name).isEmpty() && defValue.isEmpty())
+    {
+        excep.AddMoreInformation(
+                    VExceptionEmptyParameter(QObject::tr("Got empty parameter"), name, domElement).ErrorMessage());
+    }
+    throw excep;
+}
 }
 
 Q_LOGGING_CATEGORY(vXML, "v.xml")
@@ -375,7 +447,11 @@ QHash<quint32, QDomElement> VDomDocument::RefreshCache(const QDomElement &root)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-bool VDomDocument::SaveCanonicalXML(QIODevice *file, int indent, QString &error) const
+/**
+ * @brief SaveCanonicalXML write document with sorted attributes. Does not touch any VDomDocument state, so can be
+ * used from a worker thread with a detached copy of a document.
+ */
+bool VDomDocument::SaveCanonicalXML(const QDomDocument &document, QIODevice *file, int indent, QString &error)
 {
     SCASSERT(file != nullptr)
 
@@ -384,7 +460,7 @@ bool VDomDocument::SaveCanonicalXML(QIODevice *file, int indent, QString &error)
     stream.setAutoFormattingIndent(indent);
     stream.writeStartDocument();
 
-    QDomNode root = documentElement();
+    QDomNode root = document.documentElement();
     while (not root.isNull())
     {
         SaveNodeCanonically(stream, root);
@@ -417,26 +493,13 @@ quint32 VDomDocument::GetParametrUInt(const QDomElement &domElement, const QStri
     Q_ASSERT_X(not name.isEmpty(), Q_FUNC_INFO, "name of parametr is empty");
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null"); //-V591
 
+    const QString parametr = domElement.attribute(name);
     bool ok = false;
-    QString parametr;
-    quint32 id = 0;
-
-    try
-    {
-        parametr = GetParametrString(domElement, name, defValue);
-        id = parametr.toUInt(&ok);
-        if (ok == false)
-        {
-            throw VExceptionConversionError(QObject::tr("Can't convert toUInt parameter"), name);
-        }
-    }
-    catch (const VExceptionEmptyParameter &e)
+    const quint32 id = (parametr.isEmpty() ? defValue : parametr).toUInt(&ok);
+    if (not ok)
     {
-        VExceptionConversionError excep(QObject::tr("Can't convert toUInt parameter"), name);
-        excep.AddMoreInformation(e.ErrorMessage());
-        throw excep;
+        ThrowConversionError(domElement, name, defValue, QObject::tr("Can't convert toUInt parameter"));
     }
-
     return id;
 }
 
@@ -446,26 +509,13 @@ int VDomDocument::GetParametrInt(const QDomElement &domElement, const QString &n
     Q_ASSERT_X(not name.isEmpty(), Q_FUNC_INFO, "name of parametr is empty");
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null"); //-V591
 
+    const QString parametr = domElement.attribute(name);
     bool ok = false;
-    QString parametr;
-    int value = 0;
-
-    try
-    {
-        parametr = GetParametrString(domElement, name, defValue);
-        value = parametr.toInt(&ok);
-        if (ok == false)
-        {
-            throw VExceptionConversionError(QObject::tr("Can't convert toInt parameter"), name);
-        }
-    }
-    catch (const VExceptionEmptyParameter &e)
+    const int value = (parametr.isEmpty() ? defValue : parametr).toInt(&ok);
+    if (not ok)
     {
-        VExceptionConversionError excep(QObject::tr("Can't convert toInt parameter"), name);
-        excep.AddMoreInformation(e.ErrorMessage());
-        throw excep;
+        ThrowConversionError(domElement, name, defValue, QObject::tr("Can't convert toInt parameter"));
     }
-
     return value;
 }
 
@@ -475,36 +525,12 @@ bool VDomDocument::GetParametrBool(const QDomElement &domElement, const QString
     Q_ASSERT_X(not name.isEmpty(), Q_FUNC_INFO, "name of parametr is empty");
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
-    QString parametr;
+    const QString parametr = domElement.attribute(name);
     bool val = true;
-
-    const QString message = QObject::tr("Can't convert toBool parameter");
-    try
+    if (not ParseBool(parametr.isEmpty() ? defValue : parametr, val))
     {
-        parametr = GetParametrString(domElement, name, defValue);
-
-        const QStringList bools {trueStr, falseStr, QChar('1'), QChar('0')};
-        switch (bools.indexOf(parametr))
-        {
-            case 0: // true
-            case 2: // 1
-                val = true;
-                break;
-            case 1: // false
-            case 3: // 0
-                val = false;
-                break;
-            default:// others
-                throw VExceptionConversionError(message, name);
-        }
-    }
-    catch (const VExceptionEmptyParameter &e)
-    {
-        VExceptionConversionError excep(message, name);
-        excep.AddMoreInformation(e.ErrorMessage());
-        throw excep;
+        ThrowConversionError(domElement, name, defValue, QObject::tr("Can't convert toBool parameter"));
     }
-
     return val;
 }
 
@@ -583,28 +609,65 @@ qreal VDomDocument::GetParametrDouble(const QDomElement &domElement, const QStri
     Q_ASSERT_X(not name.isEmpty(), Q_FUNC_INFO, "name of parametr is empty");
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
+    const QString parametr = domElement.attribute(name);
     bool ok = false;
-    qreal param = 0;
-
-    const QString message = QObject::tr("Can't convert toDouble parameter");
-    try
+    const qreal param = ParseDouble(parametr.isEmpty() ? defValue : parametr, &ok);
+    if (not ok)
     {
-        QString parametr = GetParametrString(domElement, name, defValue);
-        param = parametr.replace(QChar(','), QChar('.')).toDouble(&ok);
-        if (ok == false)
-        {
-            throw VExceptionConversionError(message, name);
-        }
-    }
-    catch (const VExceptionEmptyParameter &e)
-    {
-        VExceptionConversionError excep(message, name);
-        excep.AddMoreInformation(e.ErrorMessage());
-        throw excep;
+        ThrowConversionError(domElement, name, defValue, QObject::tr("Can't convert toDouble parameter"));
     }
     return param;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AttributeUInt read unsigned integer attribute. Unlike GetParametrUInt never throws and doesn't allocate.
+ * @param domElement tag in xml tree.
+ * @param name attribute name.
+ * @param defValue value for missing, empty or broken attribute.
+ * @param ok if not null, set to false when the attribute can't be converted. Missing attribute is not an error.
+ * @return attribute value.
+ */
+quint32 VDomDocument::AttributeUInt(const QDomElement &domElement, const QString &name, quint32 defValue,
+                                    bool *ok) Q_DECL_NOTHROW
+{
+    return ReadAttribute(domElement, name, defValue, ok,
+                         [](const QString &value, bool *converted) {return value.toUInt(converted);});
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VDomDocument::AttributeInt(const QDomElement &domElement, const QString &name, int defValue,
+                               bool *ok) Q_DECL_NOTHROW
+{
+    return ReadAttribute(domElement, name, defValue, ok,
+                         [](const QString &value, bool *converted) {return value.toInt(converted);});
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AttributeDouble read floating point attribute. Parsing doesn't depend on current locale.
+ */
+qreal VDomDocument::AttributeDouble(const QDomElement &domElement, const QString &name, qreal defValue,
+                                    bool *ok) Q_DECL_NOTHROW
+{
+    return ReadAttribute(domElement, name, defValue, ok, ParseDouble);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AttributeBool read boolean attribute. Accepts "true", "false", "1" and "0".
+ */
+bool VDomDocument::AttributeBool(const QDomElement &domElement, const QString &name, bool defValue,
+                                 bool *ok) Q_DECL_NOTHROW
+{
+    return ReadAttribute(domElement, name, defValue, ok, [](const QString &value, bool *converted)
+    {
+        bool result = false;
+        *converted = ParseBool(value, result);
+        return result;
+    });
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief GetParametrId return value id attribute.
@@ -615,21 +678,16 @@ quint32 VDomDocument::GetParametrId(const QDomElement &domElement)
 {
     Q_ASSERT_X(not domElement.isNull(), Q_FUNC_INFO, "domElement is null");
 
-    quint32 id = NULL_ID;
-
-    const QString message = QObject::tr("Got wrong parameter id. Need only id > 0.");
-    try
+    bool ok = false;
+    const quint32 id = AttributeUInt(domElement, VDomDocument::AttrId, NULL_ID, &ok);
+    if (not ok || id == NULL_ID)
     {
-        id = GetParametrUInt(domElement, VDomDocument::AttrId, NULL_ID_STR);
-        if (id == NULL_ID)
+        const QString message = QObject::tr("Got wrong parameter id. Need only id > 0.");
+        VExceptionWrongId excep(message, domElement);
+        if (not ok)
         {
-            throw VExceptionWrongId(message, domElement);
+            excep.AddMoreInformation(QObject::tr("Can't convert toUInt parameter"));
         }
-    }
-    catch (const VExceptionConversionError &e)
-    {
-        VExceptionWrongId excep(message, domElement);
-        excep.AddMoreInformation(e.ErrorMessage());
         throw excep;
     }
     return id;
@@ -798,7 +856,7 @@ bool VDomDocument::SaveDocument(const QString &fileName, QString &error)
     {
         // See issue #666. QDomDocument produces random attribute order.
         const int indent = 4;
-        if (not SaveCanonicalXML(&file, indent, error))
+        if (not SaveCanonicalXML(*this, &file, indent, error))
         {
             return false;
         }
@@ -118,6 +118,15 @@ public:
     static qreal   GetParametrDouble(const QDomElement& domElement, const QString &name, const QString &defValue);
     static quint32 GetParametrId(const QDomElement& domElement);
 
+    static quint32 AttributeUInt(const QDomElement &domElement, const QString &name, quint32 defValue,
+                                 bool *ok = nullptr) Q_DECL_NOTHROW;
+    static int     AttributeInt(const QDomElement &domElement, const QString &name, int defValue,
+                                bool *ok = nullptr) Q_DECL_NOTHROW;
+    static qreal   AttributeDouble(const QDomElement &domElement, const QString &name, qreal defValue,
+                                   bool *ok = nullptr) Q_DECL_NOTHROW;
+    static bool    AttributeBool(const QDomElement &domElement, const QString &name, bool defValue,
+                                 bool *ok = nullptr) Q_DECL_NOTHROW;
+
     Unit           MUnit() const;
 
     virtual void   setXMLContent(const QString &fileName);
@@ -138,6 +147,7 @@ public:
     QDomElement    NodeById(const quint32 &nodeId, const QString &tagName = QString());
 
     static bool    SafeCopy(const QString &source, const QString &destination, QString &error);
+    static bool    SaveCanonicalXML(const QDomDocument &document, QIODevice *file, int indent, QString &error);
 
     QVector<VLabelTemplateLine> GetLabelTemplate(const QDomElement &element) const;
     void                        SetLabelTemplate(QDomElement &element, const QVector<VLabelTemplateLine> &lines);
@@ -167,8 +177,6 @@ private:
 
     static bool find(QHash<quint32, QDomElement> &cache, const QDomElement &node, quint32 id);
     QHash<quint32, QDomElement> RefreshCache(const QDomElement &root) const;
-
-    bool SaveCanonicalXML(QIODevice *file, int indent, QString &error) const;
 };
 
 //---------------------------------------------------------------------------------------------------------------------
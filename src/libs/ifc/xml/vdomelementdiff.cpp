@@ -0,0 +1,294 @@
+/************************************************************************
+ **
+ **  @file   vdomelementdiff.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "vdomelementdiff.h"
+
+#include <QDataStream>
+#include <QDomDocument>
+#include <QDomNamedNodeMap>
+#include <QDomNodeList>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+bool SameChildren(const QDomNodeList &oldChildren, const QDomNodeList &newChildren)
+{
+    if (oldChildren.size() != newChildren.size())
+    {
+        return false;
+    }
+
+    for (int i = 0; i < oldChildren.size(); ++i)
+    {
+        const QDomNode oldChild = oldChildren.at(i);
+        const QDomNode newChild = newChildren.at(i);
+
+        if (oldChild.nodeType() != newChild.nodeType())
+        {
+            return false;
+        }
+
+        if (oldChild.isElement())
+        {
+            if (oldChild.toElement().tagName() != newChild.toElement().tagName())
+            {
+                return false;
+            }
+        }
+        else if (oldChild.nodeValue() != newChild.nodeValue())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString SaveChildren(const QDomElement &element)
+{
+    if (not element.hasChildNodes())
+    {
+        return QString();
+    }
+
+    QDomDocument tmp;
+    QDomElement wrapper = tmp.createElement(QStringLiteral("children"));
+    tmp.appendChild(wrapper);
+
+    const QDomNodeList children = element.childNodes();
+    for (int i = 0; i < children.size(); ++i)
+    {
+        wrapper.appendChild(tmp.importNode(children.at(i), true));
+    }
+
+    return tmp.toString(-1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void RestoreChildren(QDomElement &element, const QString &children)
+{
+    while (element.hasChildNodes())
+    {
+        element.removeChild(element.firstChild());
+    }
+
+    if (children.isEmpty())
+    {
+        return;
+    }
+
+    QDomDocument tmp;
+    if (not tmp.setContent(children))
+    {
+        return;
+    }
+
+    QDomDocument owner = element.ownerDocument();
+    const QDomNodeList nodes = tmp.documentElement().childNodes();
+    for (int i = 0; i < nodes.size(); ++i)
+    {
+        element.appendChild(owner.importNode(nodes.at(i), true));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QDomElement ElementByPath(const QDomElement &root, const QVector<int> &path)
+{
+    QDomNode node = root;
+    for (auto index : path)
+    {
+        node = node.childNodes().at(index);
+    }
+    return node.toElement();
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+VDomElementDiff::VDomElementDiff(const QDomElement &oldElement, const QDomElement &newElement)
+{
+    Compare(oldElement, newElement, QVector<int>());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VDomElementDiff VDomElementDiff::FromData(const QByteArray &data)
+{
+    VDomElementDiff diff;
+
+    QDataStream stream(data);
+    quint32 count = 0;
+
+    stream >> count;
+    diff.m_attributes.reserve(static_cast<int>(count));
+    for (quint32 i = 0; i < count; ++i)
+    {
+        AttributeChange change;
+        stream >> change.path >> change.name >> change.hadOld >> change.oldValue >> change.hasNew >> change.newValue;
+        diff.m_attributes.append(change);
+    }
+
+    stream >> count;
+    diff.m_children.reserve(static_cast<int>(count));
+    for (quint32 i = 0; i < count; ++i)
+    {
+        ChildrenChange change;
+        stream >> change.path >> change.oldChildren >> change.newChildren;
+        diff.m_children.append(change);
+    }
+
+    return diff;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QByteArray VDomElementDiff::Data() const
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+
+    stream << static_cast<quint32>(m_attributes.size());
+    for (auto &change : m_attributes)
+    {
+        stream << change.path << change.name << change.hadOld << change.oldValue << change.hasNew << change.newValue;
+    }
+
+    stream << static_cast<quint32>(m_children.size());
+    for (auto &change : m_children)
+    {
+        stream << change.path << change.oldChildren << change.newChildren;
+    }
+
+    return data;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VDomElementDiff::IsEmpty() const
+{
+    return m_attributes.isEmpty() && m_children.isEmpty();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Undo turn element from the new state back to the old one.
+ */
+void VDomElementDiff::Undo(QDomElement &element) const
+{
+    Apply(element, false);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Redo turn element from the old state to the new one.
+ */
+void VDomElementDiff::Redo(QDomElement &element) const
+{
+    Apply(element, true);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDomElementDiff::Compare(const QDomElement &oldElement, const QDomElement &newElement, const QVector<int> &path)
+{
+    const QDomNamedNodeMap oldAttributes = oldElement.attributes();
+    for (int i = 0; i < oldAttributes.size(); ++i)
+    {
+        const QDomAttr attribute = oldAttributes.item(i).toAttr();
+        AttributeChange change;
+        change.path = path;
+        change.name = attribute.name();
+        change.hadOld = true;
+        change.oldValue = attribute.value();
+        change.hasNew = newElement.hasAttribute(change.name);
+        change.newValue = newElement.attribute(change.name);
+
+        if (not change.hasNew || change.oldValue != change.newValue)
+        {
+            m_attributes.append(change);
+        }
+    }
+
+    const QDomNamedNodeMap newAttributes = newElement.attributes();
+    for (int i = 0; i < newAttributes.size(); ++i)
+    {
+        const QDomAttr attribute = newAttributes.item(i).toAttr();
+        if (not oldElement.hasAttribute(attribute.name()))
+        {
+            AttributeChange change;
+            change.path = path;
+            change.name = attribute.name();
+            change.hasNew = true;
+            change.newValue = attribute.value();
+            m_attributes.append(change);
+        }
+    }
+
+    const QDomNodeList oldChildren = oldElement.childNodes();
+    const QDomNodeList newChildren = newElement.childNodes();
+
+    if (not SameChildren(oldChildren, newChildren))
+    {
+        ChildrenChange change;
+        change.path = path;
+        change.oldChildren = SaveChildren(oldElement);
+        change.newChildren = SaveChildren(newElement);
+        m_children.append(change);
+        return;
+    }
+
+    for (int i = 0; i < oldChildren.size(); ++i)
+    {
+        if (oldChildren.at(i).isElement())
+        {
+            QVector<int> childPath = path;
+            childPath.append(i);
+            Compare(oldChildren.at(i).toElement(), newChildren.at(i).toElement(), childPath);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDomElementDiff::Apply(QDomElement &element, bool forward) const
+{
+    // Changed children never contain changed attributes, the order doesn't matter
+    for (auto &change : m_children)
+    {
+        QDomElement target = ElementByPath(element, change.path);
+        RestoreChildren(target, forward ? change.newChildren : change.oldChildren);
+    }
+
+    for (auto &change : m_attributes)
+    {
+        QDomElement target = ElementByPath(element, change.path);
+        if (forward ? change.hasNew : change.hadOld)
+        {
+            target.setAttribute(change.name, forward ? change.newValue : change.oldValue);
+        }
+        else
+        {
+            target.removeAttribute(change.name);
+        }
+    }
+}
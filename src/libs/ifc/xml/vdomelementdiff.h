@@ -0,0 +1,84 @@
+/************************************************************************
+ **
+ **  @file   vdomelementdiff.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VDOMELEMENTDIFF_H
+#define VDOMELEMENTDIFF_H
+
+#include <QByteArray>
+#include <QDomElement>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief The VDomElementDiff class difference between two states of the same element.
+ *
+ * Attributes are compared one by one down the whole subtree. Only when the list of children differs (a child was
+ * added, removed or changed its tag) the children of that element are stored completely. Applying the diff changes
+ * the element in place, so references to the element and its unchanged children stay valid.
+ */
+class VDomElementDiff
+{
+public:
+    VDomElementDiff() = default;
+    VDomElementDiff(const QDomElement &oldElement, const QDomElement &newElement);
+
+    static VDomElementDiff FromData(const QByteArray &data);
+    QByteArray             Data() const;
+
+    bool IsEmpty() const;
+
+    void Undo(QDomElement &element) const;
+    void Redo(QDomElement &element) const;
+
+private:
+    struct AttributeChange
+    {
+        QVector<int> path{};
+        QString      name{};
+        bool         hadOld{false};
+        QString      oldValue{};
+        bool         hasNew{false};
+        QString      newValue{};
+    };
+
+    struct ChildrenChange
+    {
+        QVector<int> path{};
+        QString      oldChildren{};
+        QString      newChildren{};
+    };
+
+    QVector<AttributeChange> m_attributes{};
+    QVector<ChildrenChange>  m_children{};
+
+    void Compare(const QDomElement &oldElement, const QDomElement &newElement, const QVector<int> &path);
+    void Apply(QDomElement &element, bool forward) const;
+};
+
+#endif // VDOMELEMENTDIFF_H
@@ -0,0 +1,266 @@
+/************************************************************************
+ **
+ **  @file   vgroupindex.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "vgroupindex.h"
+
+//---------------------------------------------------------------------------------------------------------------------
+void VGroupIndex::Clear()
+{
+    m_groups.clear();
+    m_itemGroups.clear();
+    m_linkedGroups.clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ClearDraw remove all groups of a pattern piece.
+ */
+void VGroupIndex::ClearDraw(const QString &draw)
+{
+    const QList<vidtype> groups = DrawGroups(draw);
+    for (auto id : groups)
+    {
+        Remove(id);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VGroupIndex::RenameDraw(const QString &oldName, const QString &newName)
+{
+    for (auto &group : m_groups)
+    {
+        if (group.draw == oldName)
+        {
+            group.draw = newName;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Insert add a group or replace the group with the same id.
+ */
+void VGroupIndex::Insert(vidtype id, const Group &group)
+{
+    Remove(id);
+
+    m_groups.insert(id, group);
+
+    for (auto &item : group.items)
+    {
+        m_itemGroups[item].insert(id);
+    }
+
+    if (group.tool != null_id)
+    {
+        m_linkedGroups.insert(group.tool, id);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VGroupIndex::Remove(vidtype id)
+{
+    auto group = m_groups.find(id);
+    if (group == m_groups.end())
+    {
+        return;
+    }
+
+    for (auto &item : qAsConst(group->items))
+    {
+        auto groups = m_itemGroups.find(item);
+        if (groups != m_itemGroups.end())
+        {
+            groups->remove(id);
+            if (groups->isEmpty())
+            {
+                m_itemGroups.erase(groups);
+            }
+        }
+    }
+
+    if (group->tool != null_id && m_linkedGroups.value(group->tool, null_id) == id)
+    {
+        m_linkedGroups.remove(group->tool);
+    }
+
+    m_groups.erase(group);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VGroupIndex::Contains(vidtype id) const
+{
+    return m_groups.contains(id);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VGroupIndex::Group VGroupIndex::Value(vidtype id) const
+{
+    return m_groups.value(id);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief DrawGroups return ids of groups that belong to a pattern piece in ascending order.
+ */
+QList<vidtype> VGroupIndex::DrawGroups(const QString &draw) const
+{
+    QList<vidtype> groups;
+    for (auto i = m_groups.constBegin(); i != m_groups.constEnd(); ++i)
+    {
+        if (i->draw == draw)
+        {
+            groups.append(i.key());
+        }
+    }
+    return groups;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VGroupIndex::SetName(vidtype id, const QString &name)
+{
+    auto group = m_groups.find(id);
+    if (group != m_groups.end())
+    {
+        group->name = name;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VGroupIndex::SetTags(vidtype id, const QStringList &tags)
+{
+    auto group = m_groups.find(id);
+    if (group != m_groups.end())
+    {
+        group->tags = tags;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VGroupIndex::SetVisible(vidtype id, bool visible)
+{
+    auto group = m_groups.find(id);
+    if (group != m_groups.end())
+    {
+        group->visible = visible;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AddItem add an item to a group.
+ * @return false if the group doesn't exist or already contains the item.
+ */
+bool VGroupIndex::AddItem(vidtype id, quint32 toolId, quint32 objectId)
+{
+    auto group = m_groups.find(id);
+    const Item item(toolId, objectId);
+    if (group == m_groups.end() || group->items.contains(item))
+    {
+        return false;
+    }
+
+    group->items.insert(item);
+    m_itemGroups[item].insert(id);
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RemoveItem remove an item from a group.
+ * @return false if the group doesn't contain the item.
+ */
+bool VGroupIndex::RemoveItem(vidtype id, quint32 toolId, quint32 objectId)
+{
+    auto group = m_groups.find(id);
+    const Item item(toolId, objectId);
+    if (group == m_groups.end() || not group->items.remove(item))
+    {
+        return false;
+    }
+
+    auto groups = m_itemGroups.find(item);
+    if (groups != m_itemGroups.end())
+    {
+        groups->remove(id);
+        if (groups->isEmpty())
+        {
+            m_itemGroups.erase(groups);
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VGroupIndex::HasItem(vidtype id, quint32 toolId, quint32 objectId) const
+{
+    return m_itemGroups.value(Item(toolId, objectId)).contains(id);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsItemVisible an item is visible if at least one of its groups is visible or if it belongs to no group.
+ */
+bool VGroupIndex::IsItemVisible(const Item &item) const
+{
+    const auto groups = m_itemGroups.constFind(item);
+    if (groups == m_itemGroups.constEnd())
+    {
+        return true;
+    }
+
+    for (auto id : *groups)
+    {
+        const auto group = m_groups.constFind(id);
+        if (group != m_groups.constEnd() && group->visible)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+vidtype VGroupIndex::LinkedGroup(vidtype toolId) const
+{
+    return m_linkedGroups.value(toolId, null_id);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QStringList VGroupIndex::Categories() const
+{
+    QSet<QString> categories;
+    for (auto &group : m_groups)
+    {
+        for (auto &tag : group.tags)
+        {
+            categories.insert(tag);
+        }
+    }
+    return categories.values();
+}
@@ -0,0 +1,96 @@
+/************************************************************************
+ **
+ **  @file   vgroupindex.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VGROUPINDEX_H
+#define VGROUPINDEX_H
+
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QPair>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QtGlobal>
+
+#include "../vmisc/typedef.h"
+
+/**
+ * @brief The VGroupIndex class keeps visibility groups of a pattern in memory.
+ *
+ * Each group knows its items (pairs of tool id and object id), each item knows the groups that contain it. Group
+ * queries and visibility updates use the index instead of walking the groups subtree of the document. The document
+ * stays the source of truth, whoever changes groups in the document must update the index too.
+ */
+class VGroupIndex
+{
+public:
+    using Item = QPair<quint32, quint32>;
+
+    struct Group
+    {
+        QString     draw{};
+        QString     name{};
+        QStringList tags{};
+        bool        visible{true};
+        vidtype     tool{null_id};
+        QSet<Item>  items{};
+    };
+
+    void Clear();
+    void ClearDraw(const QString &draw);
+    void RenameDraw(const QString &oldName, const QString &newName);
+
+    void Insert(vidtype id, const Group &group);
+    void Remove(vidtype id);
+
+    bool  Contains(vidtype id) const;
+    Group Value(vidtype id) const;
+
+    QList<vidtype> DrawGroups(const QString &draw) const;
+
+    void SetName(vidtype id, const QString &name);
+    void SetTags(vidtype id, const QStringList &tags);
+    void SetVisible(vidtype id, bool visible);
+
+    bool AddItem(vidtype id, quint32 toolId, quint32 objectId);
+    bool RemoveItem(vidtype id, quint32 toolId, quint32 objectId);
+
+    bool HasItem(vidtype id, quint32 toolId, quint32 objectId) const;
+    bool IsItemVisible(const Item &item) const;
+
+    vidtype     LinkedGroup(vidtype toolId) const;
+    QStringList Categories() const;
+
+private:
+    QMap<vidtype, Group>       m_groups{};
+    QHash<Item, QSet<vidtype>> m_itemGroups{};
+    QHash<vidtype, vidtype>    m_linkedGroups{};
+};
+
+#endif // VGROUPINDEX_H
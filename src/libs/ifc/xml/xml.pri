@@ -11,7 +11,10 @@ HEADERS += \
     $$PWD//vvitconverter.h \
     $$PWD//vabstractmconverter.h \
     $$PWD/vlabeltemplateconverter.h \
-    $$PWD/vwatermarkconverter.h
+    $$PWD/vwatermarkconverter.h \
+    $$PWD/vautosavejournal.h \
+    $$PWD/vdomelementdiff.h \
+    $$PWD/vgroupindex.h
 
 SOURCES += \
     $$PWD/vabstractconverter.cpp \
@@ -23,4 +26,7 @@ SOURCES += \
     $$PWD//vvitconverter.cpp \
     $$PWD//vabstractmconverter.cpp \
     $$PWD/vlabeltemplateconverter.cpp \
-    $$PWD/vwatermarkconverter.cpp
+    $$PWD/vwatermarkconverter.cpp \
+    $$PWD/vautosavejournal.cpp \
+    $$PWD/vdomelementdiff.cpp \
+    $$PWD/vgroupindex.cpp
@@ -21,7 +21,11 @@
 
 #include "qmutokenparser.h"
 
+#include <QCache>
 #include <QMap>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QScopedPointer>
 #include <QStaticStringData>
 #include <QStringData>
 #include <QStringDataPtr>
@@ -31,6 +35,31 @@
 namespace qmu
 {
 
+namespace
+{
+struct QmuInternalTokens
+{
+    QMap<int, QString> tokens{};
+    QMap<int, QString> numbers{};
+};
+
+// Tokens of expressions in internal look do not depend on locale. That is why one cache can serve translation for all
+// languages.
+const int internalTokensCacheSize = 4096;
+
+QMutex *InternalTokensMutex()
+{
+    static QMutex mutex;
+    return &mutex;
+}
+
+QCache<QString, QmuInternalTokens> *InternalTokensCache()
+{
+    static QCache<QString, QmuInternalTokens> cache(internalTokensCacheSize);
+    return &cache;
+}
+} // anonymous namespace
+
 //---------------------------------------------------------------------------------------------------------------------
 QmuTokenParser::QmuTokenParser()
 {
@@ -100,4 +129,50 @@ bool QmuTokenParser::IsSingle(const QString &formula)
     return ok;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TokenizeInternal get tokens and numbers from expression in internal look.
+ *
+ * Result is cached, the cache is filled on the first translation of a formula. Evaluation doesn't touch it.
+ * @param formula expression in internal look.
+ * @param tokens [out] tokens (variables, measurements, functions).
+ * @param numbers [out] all numbers in expression.
+ * @throw qmu::QmuParserError in case of a wrong expression
+ */
+void QmuTokenParser::TokenizeInternal(const QString &formula, QMap<int, QString> &tokens, QMap<int, QString> &numbers)
+{
+    {
+        QMutexLocker locker(InternalTokensMutex());
+        if (const QmuInternalTokens *cached = InternalTokensCache()->object(formula))
+        {
+            tokens = cached->tokens;
+            numbers = cached->numbers;
+            return;
+        }
+    }
+
+    QScopedPointer<QmuTokenParser> cal(new QmuTokenParser(formula, false, false));
+    tokens = cal->GetTokens();
+    numbers = cal->GetNumbers();
+
+    if (formula.isEmpty())
+    {
+        return;
+    }
+
+    QmuInternalTokens *item = new QmuInternalTokens;
+    item->tokens = tokens;
+    item->numbers = numbers;
+
+    QMutexLocker locker(InternalTokensMutex());
+    InternalTokensCache()->insert(formula, item);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void QmuTokenParser::ClearTokensCache()
+{
+    QMutexLocker locker(InternalTokensMutex());
+    InternalTokensCache()->clear();
+}
+
 }// namespace qmu
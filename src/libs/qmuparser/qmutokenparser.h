@@ -42,6 +42,9 @@ public:
 
     static bool IsSingle(const QString &formula);
 
+    static void TokenizeInternal(const QString &formula, QMap<int, QString> &tokens, QMap<int, QString> &numbers);
+    static void ClearTokensCache();
+
 private:
     Q_DISABLE_COPY(QmuTokenParser)
     QmuTokenParser();
@@ -41,6 +41,7 @@
 #include <QStringData>
 #include <QStringDataPtr>
 #include <QtDebug>
+#include <algorithm>
 #include <QGlobalStatic>
 
 #include "../ifc/exception/vexceptionemptyparameter.h"
@@ -131,6 +132,7 @@ void VMeasurements::setXMLContent(const QString &fileName)
 {
     VDomDocument::setXMLContent(fileName);
     type = ReadType();
+    m_graphValid = false;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -150,6 +152,8 @@ bool VMeasurements::SaveDocument(const QString &fileName, QString &error)
 //---------------------------------------------------------------------------------------------------------------------
 void VMeasurements::AddEmpty(const QString &name, const QString &formula)
 {
+    m_graphValid = false;
+
     const QDomElement element = MakeEmpty(name, formula);
 
     const QDomNodeList list = elementsByTagName(TagBodyMeasurements);
@@ -159,6 +163,8 @@ void VMeasurements::AddEmpty(const QString &name, const QString &formula)
 //---------------------------------------------------------------------------------------------------------------------
 void VMeasurements::AddEmptyAfter(const QString &after, const QString &name, const QString &formula)
 {
+    m_graphValid = false;
+
     const QDomElement element = MakeEmpty(name, formula);
     const QDomElement sibling = FindM(after);
 
@@ -177,6 +183,8 @@ void VMeasurements::AddEmptyAfter(const QString &after, const QString &name, con
 //---------------------------------------------------------------------------------------------------------------------
 void VMeasurements::Remove(const QString &name)
 {
+    m_graphValid = false;
+
     const QDomNodeList list = elementsByTagName(TagBodyMeasurements);
     list.at(0).removeChild(FindM(name));
 }
@@ -184,6 +192,8 @@ void VMeasurements::Remove(const QString &name)
 //---------------------------------------------------------------------------------------------------------------------
 void VMeasurements::MoveTop(const QString &name)
 {
+    m_graphValid = false;
+
     const QDomElement node = FindM(name);
     if (not node.isNull())
     {
@@ -203,6 +213,8 @@ void VMeasurements::MoveTop(const QString &name)
 //---------------------------------------------------------------------------------------------------------------------
 void VMeasurements::MoveUp(const QString &name)
 {
+    m_graphValid = false;
+
     const QDomElement node = FindM(name);
     if (not node.isNull())
     {
@@ -218,6 +230,8 @@ void VMeasurements::MoveUp(const QString &name)
 //---------------------------------------------------------------------------------------------------------------------
 void VMeasurements::MoveDown(const QString &name)
 {
+    m_graphValid = false;
+
     const QDomElement node = FindM(name);
     if (not node.isNull())
     {
@@ -233,6 +247,8 @@ void VMeasurements::MoveDown(const QString &name)
 //---------------------------------------------------------------------------------------------------------------------
 void VMeasurements::MoveBottom(const QString &name)
 {
+    m_graphValid = false;
+
     const QDomElement node = FindM(name);
     if (not node.isNull())
     {
@@ -262,69 +278,292 @@ void VMeasurements::ReadMeasurements(qreal height, qreal size) const
     // That's why we need two containers: one for converted values, second for real data.
 
     // Container for values in measurement file's unit
-    QScopedPointer<VContainer> tempData(new VContainer(data->GetTrVars(), data->GetPatternUnit(),
-                                                       VContainer::UniqueNamespace()));
+    m_tempData = QSharedPointer<VContainer>(new VContainer(data->GetTrVars(), data->GetPatternUnit(),
+                                                           VContainer::UniqueNamespace()));
+
+    BuildGraph();
+
+    const QDomNodeList list = elementsByTagName(TagMeasurement);
+    if (m_duplicateNames)
+    {// A name doesn't identify a measurement, read every element in file order
+        for (int i=0; i < list.size(); ++i)
+        {
+            ReadMeasurement(list.at(i).toElement(), i, height, size);
+        }
+        return;
+    }
+
+    // Evaluate in order of dependencies. Allows a formula to reference measurements defined below it.
+    for (auto &name : qAsConst(m_order))
+    {
+        const int i = m_indexes.value(name);
+        ReadMeasurement(list.at(i).toElement(), i, height, size);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReadMeasurement update data after change of one measurement.
+ *
+ * Only measurements those formulas reference changed value will be evaluated again. Falls back to full read if
+ * measurements were never read before.
+ * @param name measurement name.
+ * @return list of updated measurements.
+ */
+QStringList VMeasurements::ReadMeasurement(const QString &name, qreal height, qreal size) const
+{
+    if (m_tempData.isNull())
+    {
+        ReadMeasurements(height, size);
+        return ListAll();
+    }
+
+    if (not m_graphValid)
+    {
+        BuildGraph();
+    }
+
+    if (m_duplicateNames)
+    {// Without graph every measurement can be affected
+        ReadMeasurements(height, size);
+        return ListAll();
+    }
+
+    if (not m_indexes.contains(name))
+    {
+        return QStringList();
+    }
+
+    // Collect all measurements that can be affected by the change
+    QSet<QString> dirty;
+    QStringList queue{name};
+    while (not queue.isEmpty())
+    {
+        const QString current = queue.takeFirst();
+        if (not dirty.contains(current))
+        {
+            dirty.insert(current);
+            queue.append(m_dependents.value(current));
+        }
+    }
+
+    QStringList updated;
+    QSet<QString> changed;
+
+    const QDomNodeList list = elementsByTagName(TagMeasurement);
+    for (auto &mName : qAsConst(m_order))
+    {
+        if (not dirty.contains(mName))
+        {
+            continue;
+        }
+
+        if (mName != name)
+        {
+            const QStringList references = m_references.value(mName);
+            auto IsChanged = [&changed](const QString &reference) {return changed.contains(reference);};
+            if (std::none_of(references.cbegin(), references.cend(), IsChanged))
+            {
+                continue; // Nothing it depends on has changed
+            }
+        }
+
+        const QSharedPointer<VInternalVariable> old = m_tempData->DataVariables()->value(mName);
+        const qreal oldValue = old.isNull() ? 0 : *old->GetValue();
+
+        const int i = m_indexes.value(mName);
+        ReadMeasurement(list.at(i).toElement(), i, height, size);
+        updated.append(mName);
+
+        const QSharedPointer<VInternalVariable> fresh = m_tempData->DataVariables()->value(mName);
+        if (old.isNull() || fresh.isNull() || not VFuzzyComparePossibleNulls(oldValue, *fresh->GetValue()))
+        {
+            changed.insert(mName);
+        }
+    }
+
+    return updated;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VMeasurements::ReadMeasurement(const QDomElement &dom, int i, qreal height, qreal size) const
+{
+    SCASSERT(not m_tempData.isNull())
+
+    const QString name = GetParametrString(dom, AttrName).simplified();
+    const QString description = GetParametrEmptyString(dom, AttrDescription);
+    const QString fullName = GetParametrEmptyString(dom, AttrFullName);
+
+    QSharedPointer<VMeasurement> meash;
+    QSharedPointer<VMeasurement> tempMeash;
+    if (type == MeasurementsType::Multisize)
+    {
+        qreal base = GetParametrDouble(dom, AttrBase, QChar('0'));
+        qreal ksize = GetParametrDouble(dom, AttrSizeIncrease, QChar('0'));
+        qreal kheight = GetParametrDouble(dom, AttrHeightIncrease, QChar('0'));
+
+        tempMeash = QSharedPointer<VMeasurement>(new VMeasurement(static_cast<quint32>(i), name, BaseSize(),
+                                                                  BaseHeight(), base, ksize, kheight));
+        tempMeash->SetSize(size);
+        tempMeash->SetHeight(height);
+        tempMeash->SetUnit(data->GetPatternUnit());
+
+        base = UnitConvertor(base, MUnit(), *data->GetPatternUnit());
+        ksize = UnitConvertor(ksize, MUnit(), *data->GetPatternUnit());
+        kheight = UnitConvertor(kheight, MUnit(), *data->GetPatternUnit());
+
+        const qreal baseSize = UnitConvertor(BaseSize(), MUnit(), *data->GetPatternUnit());
+        const qreal baseHeight = UnitConvertor(BaseHeight(), MUnit(), *data->GetPatternUnit());
+
+        meash = QSharedPointer<VMeasurement>(new VMeasurement(static_cast<quint32>(i), name, baseSize, baseHeight,
+                                                              base, ksize, kheight, fullName, description));
+        meash->SetSize(size);
+        meash->SetHeight(height);
+        meash->SetUnit(data->GetPatternUnit());
+    }
+    else
+    {
+        const QString formula = GetParametrString(dom, AttrValue, QChar('0'));
+        bool ok = false;
+        qreal value = EvalFormula(m_tempData.data(), formula, &ok);
+
+        tempMeash = QSharedPointer<VMeasurement>(new VMeasurement(m_tempData.data(), static_cast<quint32>(i), name,
+                                                                  value, formula, ok));
+
+        value = UnitConvertor(value, MUnit(), *data->GetPatternUnit());
+        meash = QSharedPointer<VMeasurement>(new VMeasurement(data, static_cast<quint32>(i), name, value, formula,
+                                                              ok, fullName, description));
+    }
+    if (m_keepNames)
+    {
+        m_tempData->AddUniqueVariable(tempMeash);
+        data->AddUniqueVariable(meash);
+    }
+    else
+    {
+        m_tempData->AddVariable(tempMeash);
+        data->AddVariable(meash);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BuildGraph build reference graph of measurements and order of evaluation.
+ *
+ * Measurements are sorted topologically. Independent measurements keep file order. Measurements with circular
+ * references are placed at the end in file order, evaluation will report an error for them.
+ */
+void VMeasurements::BuildGraph() const
+{
+    m_indexes.clear();
+    m_references.clear();
+    m_dependents.clear();
+    m_order.clear();
+    m_duplicateNames = false;
 
     const QDomNodeList list = elementsByTagName(TagMeasurement);
+    QStringList names;
+    names.reserve(list.size());
     for (int i=0; i < list.size(); ++i)
     {
-        const QDomElement dom = list.at(i).toElement();
+        const QString name = GetParametrString(list.at(i).toElement(), AttrName).simplified();
+        m_indexes.insert(name, i);
+        names.append(name);
+    }
+
+    if (m_indexes.size() != names.size())
+    {// Duplicate names. Keep old behavior, see ReadMeasurements().
+        m_duplicateNames = true;
+        m_graphValid = true;
+        return;
+    }
 
-        const QString name = GetParametrString(dom, AttrName).simplified();
-        const QString description = GetParametrEmptyString(dom, AttrDescription);
-        const QString fullName = GetParametrEmptyString(dom, AttrFullName);
+    QHash<QString, int> inDegree;
+    inDegree.reserve(names.size());
+    for (int i=0; i < list.size(); ++i)
+    {
+        const QString &name = names.at(i);
+        const QStringList references = References(list.at(i).toElement());
+        m_references.insert(name, references);
+        inDegree.insert(name, references.size());
 
-        QSharedPointer<VMeasurement> meash;
-        QSharedPointer<VMeasurement> tempMeash;
-        if (type == MeasurementsType::Multisize)
+        for (auto &reference : references)
         {
-            qreal base = GetParametrDouble(dom, AttrBase, QChar('0'));
-            qreal ksize = GetParametrDouble(dom, AttrSizeIncrease, QChar('0'));
-            qreal kheight = GetParametrDouble(dom, AttrHeightIncrease, QChar('0'));
-
-            tempMeash = QSharedPointer<VMeasurement>(new VMeasurement(static_cast<quint32>(i), name, BaseSize(),
-                                                                      BaseHeight(), base, ksize, kheight));
-            tempMeash->SetSize(size);
-            tempMeash->SetHeight(height);
-            tempMeash->SetUnit(data->GetPatternUnit());
-
-            base = UnitConvertor(base, MUnit(), *data->GetPatternUnit());
-            ksize = UnitConvertor(ksize, MUnit(), *data->GetPatternUnit());
-            kheight = UnitConvertor(kheight, MUnit(), *data->GetPatternUnit());
-
-            const qreal baseSize = UnitConvertor(BaseSize(), MUnit(), *data->GetPatternUnit());
-            const qreal baseHeight = UnitConvertor(BaseHeight(), MUnit(), *data->GetPatternUnit());
-
-            meash = QSharedPointer<VMeasurement>(new VMeasurement(static_cast<quint32>(i), name, baseSize, baseHeight,
-                                                                  base, ksize, kheight, fullName, description));
-            meash->SetSize(size);
-            meash->SetHeight(height);
-            meash->SetUnit(data->GetPatternUnit());
+            m_dependents[reference].append(name);
         }
-        else
+    }
+
+    // Kahn's algorithm. Ready measurements are taken in file order.
+    QMap<int, QString> ready;
+    for (int i=0; i < names.size(); ++i)
+    {
+        if (inDegree.value(names.at(i)) == 0)
         {
-            const QString formula = GetParametrString(dom, AttrValue, QChar('0'));
-            bool ok = false;
-            qreal value = EvalFormula(tempData.data(), formula, &ok);
+            ready.insert(i, names.at(i));
+        }
+    }
 
-            tempMeash = QSharedPointer<VMeasurement>(new VMeasurement(tempData.data(), static_cast<quint32>(i), name,
-                                                                      value, formula, ok));
+    while (not ready.isEmpty())
+    {
+        const QString name = ready.take(ready.firstKey());
+        m_order.append(name);
 
-            value = UnitConvertor(value, MUnit(), *data->GetPatternUnit());
-            meash = QSharedPointer<VMeasurement>(new VMeasurement(data, static_cast<quint32>(i), name, value, formula,
-                                                                  ok, fullName, description));
+        const QStringList dependents = m_dependents.value(name);
+        for (auto &dependent : dependents)
+        {
+            if (--inDegree[dependent] == 0)
+            {
+                ready.insert(m_indexes.value(dependent), dependent);
+            }
         }
-        if (m_keepNames)
+    }
+
+    if (m_order.size() < names.size())
+    {// Circular references
+        for (auto &name : qAsConst(names))
         {
-            tempData->AddUniqueVariable(tempMeash);
-            data->AddUniqueVariable(meash);
+            if (inDegree.value(name) > 0)
+            {
+                m_order.append(name);
+            }
         }
-        else
+    }
+
+    m_graphValid = true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief References return list of measurements referenced by measurement formula.
+ */
+QStringList VMeasurements::References(const QDomElement &dom) const
+{
+    if (type == MeasurementsType::Multisize)
+    {
+        return QStringList(); // Values of multisize measurements don't depend on each other
+    }
+
+    QMap<int, QString> tokens;
+    QMap<int, QString> numbers;
+    try
+    {
+        qmu::QmuTokenParser::TokenizeInternal(GetParametrString(dom, AttrValue, QChar('0')), tokens, numbers);
+    }
+    catch (qmu::QmuParserError &e)
+    {
+        Q_UNUSED(e)
+        return QStringList(); // Evaluation will report the error
+    }
+
+    QStringList references;
+    for (auto &token : qAsConst(tokens))
+    {
+        if (m_indexes.contains(token) && not references.contains(token))
         {
-            tempData->AddVariable(tempMeash);
-            data->AddVariable(meash);
+            references.append(token);
         }
     }
+    return references;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -482,6 +721,8 @@ void VMeasurements::SetReadOnly(bool ro)
 //---------------------------------------------------------------------------------------------------------------------
 void VMeasurements::SetMName(const QString &name, const QString &text)
 {
+    m_graphValid = false;
+
     QDomElement node = FindM(name);
     if (not node.isNull())
     {
@@ -496,6 +737,8 @@ void VMeasurements::SetMName(const QString &name, const QString &text)
 //---------------------------------------------------------------------------------------------------------------------
 void VMeasurements::SetMValue(const QString &name, const QString &text)
 {
+    m_graphValid = false;
+
     QDomElement node = FindM(name);
     if (not node.isNull())
     {
@@ -830,8 +1073,11 @@ qreal VMeasurements::EvalFormula(VContainer *data, const QString &formula, bool
     {
         try
         {
-            QScopedPointer<Calculator> cal(new Calculator());
-            const qreal result = cal->EvalFormula(data->DataVariables(), formula);
+            if (m_calculator.isNull())
+            {
+                m_calculator = QSharedPointer<Calculator>(new Calculator());
+            }
+            const qreal result = m_calculator->EvalFormula(data->DataVariables(), formula);
 
             (qIsInf(result) || qIsNaN(result)) ? *ok = false : *ok = true;
             return result;
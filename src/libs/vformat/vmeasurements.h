@@ -32,6 +32,8 @@
 #include <qcompilerdetection.h>
 #include <QCoreApplication>
 #include <QDomElement>
+#include <QHash>
+#include <QSharedPointer>
 #include <QString>
 #include <QStringList>
 #include <QtGlobal>
@@ -40,6 +42,7 @@
 #include "../vmisc/def.h"
 
 class VContainer;
+class Calculator;
 
 enum class GenderType : qint8 { Male, Female, Unknown };
 
@@ -65,7 +68,8 @@ public:
 
     void StoreNames(bool store);
 
-    void ReadMeasurements(qreal height, qreal size) const;
+    void        ReadMeasurements(qreal height, qreal size) const;
+    QStringList ReadMeasurement(const QString &name, qreal height, qreal size) const;
     void ClearForExport();
 
     MeasurementsType Type() const;
@@ -148,6 +152,21 @@ private:
     /** @brief m_keepNames store names in container to check uniqueness. */
     bool m_keepNames{true};
 
+    /** @brief m_tempData values in measurement file's unit. Kept between reads for incremental updates. */
+    mutable QSharedPointer<VContainer> m_tempData{};
+
+    /** @brief m_calculator one parser for all formulas. Creating a parser is much more expensive than parsing. */
+    mutable QSharedPointer<Calculator> m_calculator{};
+
+    /** @brief Reference graph of measurements. Dropped after each change of structure or formula. */
+    mutable bool                        m_graphValid{false};
+    mutable QHash<QString, int>         m_indexes{};
+    mutable QHash<QString, QStringList> m_references{};
+    mutable QHash<QString, QStringList> m_dependents{};
+    mutable QStringList                 m_order{};
+    /** @brief m_duplicateNames names are not unique, measurements are evaluated in file order without graph. */
+    mutable bool                        m_duplicateNames{false};
+
     void CreateEmptyMultisizeFile(Unit unit, int baseSize, int baseHeight);
     void CreateEmptyIndividualFile(Unit unit);
 
@@ -159,6 +178,11 @@ private:
 
     qreal EvalFormula(VContainer *data, const QString &formula, bool *ok) const;
 
+    void ReadMeasurement(const QDomElement &dom, int i, qreal height, qreal size) const;
+
+    void        BuildGraph() const;
+    QStringList References(const QDomElement &dom) const;
+
     QString ClearPMCode(const QString &code) const;
 };
 
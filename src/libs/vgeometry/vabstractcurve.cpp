@@ -36,6 +36,7 @@
 #include <QtDebug>
 
 #include "vabstractcurve_p.h"
+#include "vcurveindex.h"
 #include "../vmisc/vabstractapplication.h"
 #include "../vmisc/compatibility.h"
 #include "../ifc/exception/vexceptionobjecterror.h"
@@ -455,11 +456,12 @@ bool VAbstractCurve::CurveIntersectAxis(const QPointF &point, qreal angle, const
     rec.translate(-INT_MAX/2.0, -INT_MAX/2.0);
 
     // Instead of using axis compare two rays. See issue #963.
+    const VCurveIndex curve(curvePoints);
     QLineF axis = QLineF(point, VGObject::BuildRay(point, angle, rec));
-    QVector<QPointF> points = VAbstractCurve::CurveIntersectLine(curvePoints, axis);
+    QVector<QPointF> points = curve.IntersectLine(axis);
 
     axis = QLineF(point, VGObject::BuildRay(point, angle + 180, rec));
-    points += VAbstractCurve::CurveIntersectLine(curvePoints, axis);
+    points += curve.IntersectLine(axis);
 
     if (points.size() > 0)
     {
@@ -0,0 +1,305 @@
+/************************************************************************
+ **
+ **  @file   vcurveindex.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+
+#include "vcurveindex.h"
+
+#include "vgobject.h"
+#include "../vmisc/compatibility.h"
+
+#include <algorithm>
+
+namespace
+{
+// Segments in one leaf. Small leaves cut more pairs, but each node costs a box test.
+constexpr int leafSize = 8;
+
+// Boxes are a bit bigger than segments, so a crossing found by QLineF on a box border is never pruned.
+constexpr qreal boxMargin = accuracyPointOnLine;
+
+//---------------------------------------------------------------------------------------------------------------------
+template <class Box1, class Box2>
+inline bool BoxesOverlap(const Box1 &box1, const Box2 &box2)
+{
+    return box1.left <= box2.right && box2.left <= box1.right && box1.top <= box2.bottom && box2.top <= box1.bottom;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline qreal Side(const QLineF &line, qreal x, qreal y)
+{
+    return (line.x2() - line.x1()) * (y - line.y1()) - (line.y2() - line.y1()) * (x - line.x1());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <class Box>
+bool LineCrossBox(const QLineF &line, const Box &box)
+{
+    // The box is out of reach if all its corners lie strictly on one side of the line.
+    const qreal s1 = Side(line, box.left, box.top);
+    const qreal s2 = Side(line, box.right, box.top);
+    const qreal s3 = Side(line, box.right, box.bottom);
+    const qreal s4 = Side(line, box.left, box.bottom);
+
+    return not ((s1 > 0 && s2 > 0 && s3 > 0 && s4 > 0) || (s1 < 0 && s2 < 0 && s3 < 0 && s4 < 0));
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+VCurveIndex::VCurveIndex(const QVector<QPointF> &points)
+    : m_points(points)
+{
+    if (m_points.size() > 1)
+    {
+        m_nodes.reserve(2 * (m_points.size() / leafSize + 1));
+        Build(0, m_points.size() - 1);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IntersectLine return all bounded intersections of the curve with a line segment.
+ *
+ * Gives the same points as VAbstractCurve::CurveIntersectLine.
+ */
+QVector<QPointF> VCurveIndex::IntersectLine(const QLineF &line) const
+{
+    QVector<QPointF> intersections;
+    if (not m_nodes.isEmpty())
+    {
+        Node lineBox;
+        lineBox.left = qMin(line.x1(), line.x2());
+        lineBox.right = qMax(line.x1(), line.x2());
+        lineBox.top = qMin(line.y1(), line.y2());
+        lineBox.bottom = qMax(line.y1(), line.y2());
+
+        IntersectLine(0, line, lineBox, intersections);
+    }
+    return intersections;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IntersectCurve return all intersections of two curves.
+ *
+ * Points are ordered by segment of this curve and then by segment of the other curve, the same way as calling
+ * VAbstractCurve::CurveIntersectLine(curve, segment) for each segment of this curve.
+ */
+QVector<QPointF> VCurveIndex::IntersectCurve(const VCurveIndex &curve) const
+{
+    QVector<Crossing> crossings;
+    if (not m_nodes.isEmpty() && not curve.m_nodes.isEmpty())
+    {
+        IntersectCurve(0, curve, 0, crossings);
+    }
+
+    // The tree visits leaves of the other curve for each leaf of this curve, so restore the order of a plain scan.
+    std::sort(crossings.begin(), crossings.end(), [](const Crossing &c1, const Crossing &c2)
+    {
+        return c1.segment < c2.segment || (c1.segment == c2.segment && c1.curveSegment < c2.curveSegment);
+    });
+
+    QVector<QPointF> intersections;
+    intersections.reserve(crossings.size());
+    for (auto &crossing : qAsConst(crossings))
+    {
+        intersections.append(crossing.point);
+    }
+    return intersections;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VCurveIndex::IsPointOnCurve(const QPointF &p, qreal accuracy) const
+{
+    if (m_points.isEmpty())
+    {
+        return false;
+    }
+    else if (m_points.size() < 2)
+    {
+        return m_points.at(0) == p;
+    }
+
+    return IsPointOnCurve(0, p, accuracy);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VCurveIndex::Build(int begin, int end)
+{
+    const int index = m_nodes.size();
+    m_nodes.append(Node());
+
+    if (end - begin <= leafSize)
+    {
+        Node node;
+        node.begin = begin;
+        node.end = end;
+        node.left = node.right = m_points.at(begin).x();
+        node.top = node.bottom = m_points.at(begin).y();
+
+        for (int i = begin + 1; i <= end; ++i)
+        {
+            const QPointF &p = m_points.at(i);
+            node.left = qMin(node.left, p.x());
+            node.right = qMax(node.right, p.x());
+            node.top = qMin(node.top, p.y());
+            node.bottom = qMax(node.bottom, p.y());
+        }
+
+        node.left -= boxMargin;
+        node.right += boxMargin;
+        node.top -= boxMargin;
+        node.bottom += boxMargin;
+
+        m_nodes[index] = node;
+        return index;
+    }
+
+    const int middle = begin + (end - begin) / 2;
+    const int child1 = Build(begin, middle);
+    const int child2 = Build(middle, end);
+
+    const Node &node1 = m_nodes.at(child1);
+    const Node &node2 = m_nodes.at(child2);
+
+    Node node;
+    node.begin = begin;
+    node.end = end;
+    node.child1 = child1;
+    node.child2 = child2;
+    node.left = qMin(node1.left, node2.left);
+    node.right = qMax(node1.right, node2.right);
+    node.top = qMin(node1.top, node2.top);
+    node.bottom = qMax(node1.bottom, node2.bottom);
+
+    m_nodes[index] = node;
+    return index;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VCurveIndex::IntersectLine(int node, const QLineF &line, const Node &lineBox,
+                                QVector<QPointF> &intersections) const
+{
+    const Node &current = m_nodes.at(node);
+    if (not BoxesOverlap(current, lineBox) || not LineCrossBox(line, current))
+    {
+        return;
+    }
+
+    if (current.child1 != -1)
+    {
+        IntersectLine(current.child1, line, lineBox, intersections);
+        IntersectLine(current.child2, line, lineBox, intersections);
+        return;
+    }
+
+    for (int i = current.begin; i < current.end; ++i)
+    {
+        QPointF crosPoint;
+        const auto type = Intersects(line, QLineF(m_points.at(i), m_points.at(i+1)), &crosPoint);
+
+        if (type == QLineF::BoundedIntersection)
+        {
+            intersections.append(crosPoint);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VCurveIndex::IntersectCurve(int node, const VCurveIndex &curve, int curveNode,
+                                 QVector<Crossing> &crossings) const
+{
+    const Node &current = m_nodes.at(node);
+    const Node &other = curve.m_nodes.at(curveNode);
+
+    if (not BoxesOverlap(current, other))
+    {
+        return;
+    }
+
+    if (current.child1 != -1)
+    {
+        IntersectCurve(current.child1, curve, curveNode, crossings);
+        IntersectCurve(current.child2, curve, curveNode, crossings);
+        return;
+    }
+
+    if (other.child1 != -1)
+    {
+        IntersectCurve(node, curve, other.child1, crossings);
+        IntersectCurve(node, curve, other.child2, crossings);
+        return;
+    }
+
+    for (int i = current.begin; i < current.end; ++i)
+    {
+        const QLineF segment(m_points.at(i), m_points.at(i+1));
+        for (int j = other.begin; j < other.end; ++j)
+        {
+            QPointF crosPoint;
+            const auto type = Intersects(segment, QLineF(curve.m_points.at(j), curve.m_points.at(j+1)), &crosPoint);
+
+            if (type == QLineF::BoundedIntersection)
+            {
+                Crossing crossing;
+                crossing.segment = i;
+                crossing.curveSegment = j;
+                crossing.point = crosPoint;
+                crossings.append(crossing);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VCurveIndex::IsPointOnCurve(int node, const QPointF &p, qreal accuracy) const
+{
+    const Node &current = m_nodes.at(node);
+
+    // Boxes already include boxMargin, grow them only if the caller asks for a bigger accuracy.
+    const qreal grow = qMax(accuracy - boxMargin, 0.0);
+    if (p.x() < current.left - grow || p.x() > current.right + grow
+            || p.y() < current.top - grow || p.y() > current.bottom + grow)
+    {
+        return false;
+    }
+
+    if (current.child1 != -1)
+    {
+        return IsPointOnCurve(current.child1, p, accuracy) || IsPointOnCurve(current.child2, p, accuracy);
+    }
+
+    for (int i = current.begin; i < current.end; ++i)
+    {
+        if (VGObject::IsPointOnLineSegment(p, m_points.at(i), m_points.at(i+1), accuracy))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,93 @@
+/************************************************************************
+ **
+ **  @file   vcurveindex.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+
+#ifndef VCURVEINDEX_H
+#define VCURVEINDEX_H
+
+#include <QLineF>
+#include <QPointF>
+#include <QVector>
+#include <QtGlobal>
+
+#include "vgeometrydef.h"
+
+/**
+ * @brief The VCurveIndex class is a bounding box hierarchy over segments of a flattened curve.
+ *
+ * Building the index costs O(n). After that a query touches only segments whose boxes can take part in the answer,
+ * so intersecting two curves costs about O((n+m) log n) instead of testing every pair of segments. Results come in
+ * the same order as a plain scan over segments would give them.
+ */
+class VCurveIndex
+{
+public:
+    explicit VCurveIndex(const QVector<QPointF> &points);
+
+    const QVector<QPointF> &GetPoints() const;
+
+    QVector<QPointF> IntersectLine(const QLineF &line) const;
+    QVector<QPointF> IntersectCurve(const VCurveIndex &curve) const;
+    bool             IsPointOnCurve(const QPointF &p, qreal accuracy = accuracyPointOnLine) const;
+
+private:
+    struct Node
+    {
+        qreal left{0};
+        qreal top{0};
+        qreal right{0};
+        qreal bottom{0};
+        int   begin{0}; // first segment
+        int   end{0}; // past the last segment
+        int   child1{-1};
+        int   child2{-1};
+    };
+
+    struct Crossing
+    {
+        int     segment{0};
+        int     curveSegment{0};
+        QPointF point{};
+    };
+
+    QVector<QPointF> m_points;
+    QVector<Node>    m_nodes{};
+
+    int  Build(int begin, int end);
+    void IntersectLine(int node, const QLineF &line, const Node &lineBox, QVector<QPointF> &intersections) const;
+    void IntersectCurve(int node, const VCurveIndex &curve, int curveNode, QVector<Crossing> &crossings) const;
+    bool IsPointOnCurve(int node, const QPointF &p, qreal accuracy) const;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+inline const QVector<QPointF> &VCurveIndex::GetPoints() const
+{
+    return m_points;
+}
+
+#endif // VCURVEINDEX_H
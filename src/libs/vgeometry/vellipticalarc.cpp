@@ -29,7 +29,10 @@
 #include "vellipticalarc.h"
 
 #include <QLineF>
+#include <QMutexLocker>
 #include <QPoint>
+#include <QtMath>
+#include <algorithm>
 
 #include "../vmisc/def.h"
 #include "../vmisc/vmath.h"
@@ -40,6 +43,147 @@
 #include "vellipticalarc_p.h"
 #include "vspline.h"
 
+namespace
+{
+// Parameter step of the length table. With five point quadrature per step the table is exact far below drawing
+// precision even for very flat ellipses.
+constexpr qreal lengthTableStep = M_PI / 64;
+
+// Biggest parameter step of the flattened arc. The chord error alone is not enough for small ellipses, where a
+// tolerance of one pixel would leave only a handful of points.
+constexpr qreal flatteningStep = M_PI / 16;
+
+constexpr int maxFlatteningDepth = 16;
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief EllipsePoint return point of axis aligned ellipse for parameter t in radians.
+ *
+ * The y axis points down, so the parameter grows counterclockwise on screen, the same way angles of QLineF do.
+ */
+inline QPointF EllipsePoint(qreal radius1, qreal radius2, qreal t)
+{
+    return QPointF(radius1 * qCos(t), -radius2 * qSin(t));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline qreal Speed(const VEllipticalArcLengths &table, qreal t)
+{
+    const qreal dx = -table.radius1 * qSin(t);
+    const qreal dy = -table.radius2 * qCos(t);
+    const QTransform &m = table.matrix;
+    return qSqrt(qPow(m.m11() * dx + m.m21() * dy, 2) + qPow(m.m12() * dx + m.m22() * dy, 2));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IntegrateSpeed return arc length between parameters t1 and t2 using five point Gauss-Legendre quadrature.
+ */
+qreal IntegrateSpeed(const VEllipticalArcLengths &table, qreal t1, qreal t2)
+{
+    static const qreal nodes[] = {0.0, 0.5384693101056831, 0.9061798459386640};
+    static const qreal weights[] = {0.5688888888888889, 0.4786286704993665, 0.2369268850561891};
+
+    const qreal half = (t2 - t1) / 2;
+    const qreal middle = (t1 + t2) / 2;
+
+    qreal sum = weights[0] * Speed(table, middle);
+    for (int i = 1; i < 3; ++i)
+    {
+        sum += weights[i] * (Speed(table, middle - half * nodes[i]) + Speed(table, middle + half * nodes[i]));
+    }
+    return sum * half;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LengthToParameter find parameter of the point that lies at given length from the start of the table.
+ */
+qreal LengthToParameter(const VEllipticalArcLengths &table, qreal length)
+{
+    const QVector<qreal> &lengths = table.lengths;
+    if (lengths.size() < 2 || length <= 0)
+    {
+        return table.start;
+    }
+
+    if (length >= lengths.last())
+    {
+        return table.start + table.sweep;
+    }
+
+    const int interval = static_cast<int>(std::upper_bound(lengths.cbegin(), lengths.cend(), length)
+                                          - lengths.cbegin()) - 1;
+    const qreal step = table.sweep / (lengths.size() - 1);
+    const qreal t1 = table.start + step * interval;
+    const qreal t2 = t1 + step;
+    const qreal rest = length - lengths.at(interval);
+
+    // Inside one step the speed changes little, so Newton's method converges in a few iterations.
+    qreal t = t1 + step * rest / (lengths.at(interval + 1) - lengths.at(interval));
+    for (int i = 0; i < 8; ++i)
+    {
+        const qreal speed = Speed(table, t);
+        if (qFuzzyIsNull(speed))
+        {
+            break;
+        }
+
+        const qreal error = IntegrateSpeed(table, t1, t) - rest;
+        t = qBound(t1, t - error / speed, t2);
+
+        if (qAbs(error) < accuracyPointOnLine / 1000)
+        {
+            break;
+        }
+    }
+    return t;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PolarToParameter convert angle between the major axis and the ray from center (degree) to ellipse parameter.
+ */
+inline qreal PolarToParameter(qreal radius1, qreal radius2, qreal angle)
+{
+    const qreal rad = qDegreesToRadians(angle);
+    return qAtan2(radius1 * qSin(rad), radius2 * qCos(rad));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline qreal ParameterToPolar(qreal radius1, qreal radius2, qreal t)
+{
+    QLineF line(0, 0, 100, 0);
+    line.setAngle(qRadiansToDegrees(qAtan2(radius2 * qSin(t), radius1 * qCos(t))));
+    return line.angle(); // We use QLineF just because it is easy way correct angle value
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void FlattenArc(const QTransform &transform, qreal radius1, qreal radius2, qreal t1, const QPointF &p1, qreal t2,
+                const QPointF &p2, qreal tolerance, int depth, QVector<QPointF> &points)
+{
+    if (depth < maxFlatteningDepth)
+    {
+        const qreal t = (t1 + t2) / 2;
+        const QPointF p = transform.map(EllipsePoint(radius1, radius2, t));
+
+        const QLineF chord(p1, p2);
+        const qreal chordLength = chord.length();
+        const qreal cross = (p2.x() - p1.x()) * (p.y() - p1.y()) - (p2.y() - p1.y()) * (p.x() - p1.x());
+        const qreal error = qFuzzyIsNull(chordLength) ? QLineF(p1, p).length() : qAbs(cross) / chordLength;
+
+        if (error > tolerance)
+        {
+            FlattenArc(transform, radius1, radius2, t1, p1, t, p, tolerance, depth + 1, points);
+            FlattenArc(transform, radius1, radius2, t, p, t2, p2, tolerance, depth + 1, points);
+            return;
+        }
+    }
+
+    points.append(p2);
+}
+} // anonymous namespace
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief VEllipticalArc default constructor.
@@ -205,7 +349,12 @@ VEllipticalArc::~VEllipticalArc()
  */
 qreal VEllipticalArc::GetLength() const
 {
-    qreal length = PathLength(GetPoints());
+    qreal start = 0;
+    qreal sweep = 0;
+    ParameterRange(start, sweep);
+
+    const QVector<qreal> lengths = LengthTable(start, sweep).lengths;
+    qreal length = lengths.isEmpty() ? 0 : lengths.last();
 
     if (IsFlipped())
     {
@@ -264,46 +413,39 @@ VPointF VEllipticalArc::GetCenter() const
  */
 QVector<QPointF> VEllipticalArc::GetPoints() const
 {
-    const QPointF center = VAbstractArc::GetCenter().toQPointF();
-    QRectF box(center.x() - d->radius1, center.y() - d->radius2, d->radius1*2, d->radius2*2);
-
-    QLineF startLine(center.x(), center.y(), center.x() + d->radius1, center.y());
-    QLineF endLine = startLine;
-
-    startLine.setAngle(VAbstractArc::GetStartAngle());
-    endLine.setAngle(VAbstractArc::GetEndAngle());
-    qreal sweepAngle = startLine.angleTo(endLine);
-
-    if (qFuzzyIsNull(sweepAngle))
+    QVector<QPointF> points;
+    if (d->radius1 <= 0 || d->radius2 <= 0)
     {
-        sweepAngle = 360;
+        return points;
     }
 
-    QPainterPath path;
-    path.moveTo(GetP1());
-    path.arcTo(box, VAbstractArc::GetStartAngle(), sweepAngle);
-    path.moveTo(GetP2());
+    qreal start = 0;
+    qreal sweep = 0;
+    ParameterRange(start, sweep);
 
-    QTransform t = d->m_transform;
-    t.translate(center.x(), center.y());
-    t.rotate(-GetRotationAngle());
-    t.translate(-center.x(), -center.y());
+    qreal scale = GetApproximationScale();
+    if (scale < minCurveApproximationScale || scale > maxCurveApproximationScale)
+    {
+        scale = qApp->Settings()->GetCurveApproximationScale();
+    }
+    const qreal tolerance = 0.5 / scale;
 
-    path = t.map(path);
+    const QTransform transform = ArcTransform();
+    const int sections = qMax(1, qCeil(sweep / flatteningStep));
+    const qreal step = sweep / sections;
 
-    QPolygonF polygon;
-    const QList<QPolygonF> sub = path.toSubpathPolygons();
-    if (not sub.isEmpty())
+    points.append(GetP1());
+    QPointF p1 = points.first();
+    for (int i = 0; i < sections; ++i)
     {
-        polygon = ConstFirst (path.toSubpathPolygons());
-
-        if (not polygon.isEmpty() && not VFuzzyComparePoints(GetP1(), ConstFirst<QPointF> (polygon)))
-        {
-            polygon.removeFirst(); // remove point (0;0)
-        }
+        const qreal t1 = start + step * i;
+        const qreal t2 = t1 + step;
+        const QPointF p2 = (i == sections - 1) ? GetP2() : transform.map(EllipsePoint(d->radius1, d->radius2, t2));
+        FlattenArc(transform, d->radius1, d->radius2, t1, p1, t2, p2, tolerance, 0, points);
+        p1 = p2;
     }
 
-    return static_cast<QVector<QPointF>>(polygon);
+    return points;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -364,7 +506,7 @@ QPointF VEllipticalArc::CutArc(const qreal &length, VEllipticalArc &arc1, VEllip
     arc2 = VEllipticalArc (GetCenter(), d->radius1, d->radius2, d->formulaRadius1, d->formulaRadius2,
                            arc1.GetEndAngle(), arc1.GetFormulaF2(), GetEndAngle(), GetFormulaF2(), d->rotationAngle,
                            GetFormulaRotationAngle(), getIdObject(), getMode());
-    return arc1.GetP1();
+    return arc1.GetP2();
 }
 
 
@@ -401,61 +543,119 @@ void VEllipticalArc::CreateName()
 //---------------------------------------------------------------------------------------------------------------------
 void VEllipticalArc::FindF2(qreal length)
 {
-    qreal gap = 180;
     if (length < 0)
     {
         SetFlipped(true);
-        gap = -gap;
-    }
-    while (length > MaxLength())
-    {
-        length = MaxLength();
     }
 
-    // We need to calculate the second angle
-    // first approximation of angle between start and end angles
+    // Measure the whole ellipse from the start angle and find where the given length ends.
+    const qreal start = PolarToParameter(d->radius1, d->radius2, VAbstractArc::GetStartAngle());
+    const VEllipticalArcLengths table = LengthTable(start, M_2PI);
 
-    QLineF radius1(GetCenter().x(), GetCenter().y(), GetCenter().x() + d->radius1, GetCenter().y());
-    radius1.setAngle(GetStartAngle());
-    radius1.setAngle(radius1.angle() + gap);
-    qreal endAngle = radius1.angle();
+    const qreal t = LengthToParameter(table, qAbs(length));
+    const qreal endAngle = ParameterToPolar(d->radius1, d->radius2, t);
 
-    // we need to set the end angle, because we want to use GetLength()
     SetFormulaF2(QString::number(endAngle), endAngle);
+    SetFormulaLength(QString::number(qApp->fromPixel(GetLength())));
+}
 
-    qreal lenBez = GetLength(); // first approximation of length
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ParameterRange return ellipse parameters (radians) of the arc ends.
+ *
+ * Angles of the arc are angles of rays from the center, the parameter is the angle of the point on the auxiliary
+ * circle. They are equal only for a circle.
+ */
+void VEllipticalArc::ParameterRange(qreal &start, qreal &sweep) const
+{
+    QLineF startLine(0, 0, 100, 0);
+    QLineF endLine = startLine;
+    startLine.setAngle(VAbstractArc::GetStartAngle());
+    endLine.setAngle(VAbstractArc::GetEndAngle());
+    const qreal angleArc = startLine.angleTo(endLine);
 
-    const qreal eps = ToPixel(0.001, Unit::Mm);
+    start = PolarToParameter(d->radius1, d->radius2, VAbstractArc::GetStartAngle());
 
-    while (qAbs(lenBez - length) > eps)
+    if (qFuzzyIsNull(angleArc))
     {
-        gap = gap/2;
-        if (gap < 0.0001)
-        {
-            break;
-        }
-        if (lenBez > length)
-        { // we selected too big end angle
-            radius1.setAngle(endAngle - qAbs(gap));
-        }
-        else
-        { // we selected too little end angle
-            radius1.setAngle(endAngle + qAbs(gap));
-        }
-        endAngle = radius1.angle();
-        // we need to set d->f2, because we use it when we calculate GetLength
-        SetFormulaF2(QString::number(endAngle), endAngle);
-        lenBez = GetLength();
+        sweep = M_2PI;
+        return;
+    }
+
+    const qreal end = PolarToParameter(d->radius1, d->radius2, VAbstractArc::GetEndAngle());
+    sweep = end - start;
+    while (sweep < 0)
+    {
+        sweep += M_2PI;
+    }
+    while (sweep > M_2PI)
+    {
+        sweep -= M_2PI;
     }
-    SetFormulaLength(QString::number(qApp->fromPixel(lenBez)));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-qreal VEllipticalArc::MaxLength() const
+/**
+ * @brief ArcTransform return transformation from the frame of axis aligned ellipse with center in (0, 0) to the scene.
+ */
+QTransform VEllipticalArc::ArcTransform() const
 {
-    const qreal h = qPow(d->radius1 - d->radius2, 2) / qPow(d->radius1 + d->radius2, 2);
-    const qreal ellipseLength = M_PI * (d->radius1 + d->radius2) * (1+3*h/(10+qSqrt(4-3*h)));
-    return ellipseLength;
+    const QPointF center = VAbstractArc::GetCenter().toQPointF();
+
+    QTransform t = d->m_transform;
+    t.translate(center.x(), center.y());
+    t.rotate(-GetRotationAngle());
+    return t;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LengthTable return cumulative lengths of the ellipse between parameters start and start + sweep.
+ *
+ * The arc and the whole ellipse tables are cached separately, so GetLength and FindF2 do not evict each other.
+ */
+VEllipticalArcLengths VEllipticalArc::LengthTable(qreal start, qreal sweep) const
+{
+    QTransform matrix = ArcTransform();
+    matrix = QTransform(matrix.m11(), matrix.m12(), matrix.m21(), matrix.m22(), 0, 0);
+
+    QMutexLocker locker(&d->m_lengthsMutex);
+
+    VEllipticalArcLengths &cached = qFuzzyCompare(sweep, M_2PI) ? d->m_ellipseLengths : d->m_arcLengths;
+    if (not cached.lengths.isEmpty() && qFuzzyCompare(cached.radius1, d->radius1)
+            && qFuzzyCompare(cached.radius2, d->radius2) && qFuzzyCompare(cached.start + 1, start + 1)
+            && qFuzzyCompare(cached.sweep + 1, sweep + 1) && cached.matrix == matrix)
+    {
+        return cached;
+    }
+
+    VEllipticalArcLengths table;
+    table.radius1 = d->radius1;
+    table.radius2 = d->radius2;
+    table.start = start;
+    table.sweep = sweep;
+    table.matrix = matrix;
+
+    if (d->radius1 > 0 && d->radius2 > 0 && sweep > 0)
+    {
+        const int steps = qMax(1, qCeil(sweep / lengthTableStep));
+        const qreal step = sweep / steps;
+
+        table.lengths.reserve(steps + 1);
+        table.lengths.append(0);
+        for (int i = 0; i < steps; ++i)
+        {
+            const qreal t1 = start + step * i;
+            table.lengths.append(table.lengths.last() + IntegrateSpeed(table, t1, t1 + step));
+        }
+    }
+    else
+    {
+        table.lengths.append(0);
+    }
+
+    cached = table;
+    return table;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
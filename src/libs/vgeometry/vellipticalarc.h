@@ -43,6 +43,7 @@
 #include "vpointf.h"
 
 class VEllipticalArcData;
+struct VEllipticalArcLengths;
 
 class VEllipticalArc : public VAbstractArc
 {
@@ -108,9 +109,11 @@ protected:
 private:
     QSharedDataPointer<VEllipticalArcData> d;
 
-    qreal MaxLength() const;
-
     QPointF GetP(qreal angle) const;
+
+    void                  ParameterRange(qreal &start, qreal &sweep) const;
+    QTransform            ArcTransform() const;
+    VEllipticalArcLengths LengthTable(qreal start, qreal sweep) const;
 };
 
 Q_DECLARE_METATYPE(VEllipticalArc)
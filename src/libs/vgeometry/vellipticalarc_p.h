@@ -1,7 +1,10 @@
 #ifndef VELLIPTICALARC_P
 #define VELLIPTICALARC_P
 
+#include <QMutex>
 #include <QSharedData>
+#include <QTransform>
+#include <QVector>
 #include "../vmisc/vabstractapplication.h"
 #include "../vmisc/diagnostic.h"
 #include "vpointf.h"
@@ -10,6 +13,23 @@ QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Weffc++")
 QT_WARNING_DISABLE_GCC("-Wnon-virtual-dtor")
 
+/**
+ * @brief The VEllipticalArcLengths struct keeps cumulative arc length at evenly spaced parameter values.
+ *
+ * The table is valid only for the ellipse, parameter range and matrix it was built for.
+ */
+struct VEllipticalArcLengths
+{
+    qreal radius1{0};
+    qreal radius2{0};
+    /** @brief start parameter of the first node in radians. */
+    qreal start{0};
+    qreal sweep{0};
+    /** @brief matrix maps the ellipse frame to the scene, translation is ignored. */
+    QTransform matrix{};
+    QVector<qreal> lengths{};
+};
+
 class VEllipticalArcData : public QSharedData
 {
 public:
@@ -35,6 +55,12 @@ public:
     QString formulaRotationAngle;
     QTransform m_transform;
 
+    /** @brief m_arcLengths cached length table of the arc, shared by all copies that share this data. */
+    mutable VEllipticalArcLengths m_arcLengths{};
+    /** @brief m_ellipseLengths cached length table of the whole ellipse from the start angle. */
+    mutable VEllipticalArcLengths m_ellipseLengths{};
+    mutable QMutex                m_lengthsMutex{};
+
 private:
     Q_DISABLE_ASSIGN(VEllipticalArcData)
 };
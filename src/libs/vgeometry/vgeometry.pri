@@ -17,7 +17,8 @@ SOURCES += \
         $$PWD/vcubicbezierpath.cpp \
         $$PWD/vabstractarc.cpp \
         $$PWD/vabstractbezier.cpp \
-    $$PWD/vplacelabelitem.cpp
+    $$PWD/vplacelabelitem.cpp \
+    $$PWD/vcurveindex.cpp
 
 *msvc*:SOURCES += $$PWD/stable.cpp
 
@@ -50,4 +51,5 @@ HEADERS += \
         $$PWD/vabstractarc_p.h \
         $$PWD/vabstractbezier.h \
     $$PWD/vplacelabelitem.h \
-    $$PWD/vplacelabelitem_p.h
+    $$PWD/vplacelabelitem_p.h \
+    $$PWD/vcurveindex.h
@@ -47,6 +47,7 @@
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonDocument>
+#include <limits>
 
 const quint32 VAbstractPieceData::streamHeader = 0x05CDD73A; // CRC-32Q string "VAbstractPieceData"
 const quint16 VAbstractPieceData::classVersion = 2;
@@ -891,6 +892,76 @@ QVector<QPointF> CleanLoopArtifacts(const QVector<VRawSAPoint> &points)
 
     return cleaned;
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+struct VOutlineVertex
+{
+    QPointF point{};
+    int first{0}; // first original vertex replaced by this one
+    int last{0}; // last original vertex replaced by this one
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+inline qreal Cross(const QPointF &v1, const QPointF &v2)
+{
+    return v1.x()*v2.y() - v1.y()*v2.x();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+qreal DistanceToSegment(const QPointF &p, const QPointF &a, const QPointF &b)
+{
+    const QPointF ab = b - a;
+    const qreal length2 = QPointF::dotProduct(ab, ab);
+    if (qFuzzyIsNull(length2))
+    {
+        return QLineF(p, a).length();
+    }
+
+    const qreal t = qBound(0.0, QPointF::dotProduct(p - a, ab) / length2, 1.0);
+    return QLineF(p, a + ab*t).length();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsOriginalNear check that each original vertex strictly between from and to is not farther than tolerance
+ * from the polyline.
+ */
+bool IsOriginalNear(const QVector<QPointF> &original, int from, int to, const QVector<QPointF> &polyline,
+                    qreal tolerance)
+{
+    const int n = original.size();
+    for (int k = (from+1) % n; k != to; k = (k+1) % n)
+    {
+        qreal distance = std::numeric_limits<qreal>::max();
+        for (int i = 1; i < polyline.size(); ++i)
+        {
+            distance = qMin(distance, DistanceToSegment(original.at(k), polyline.at(i-1), polyline.at(i)));
+        }
+
+        if (distance > tolerance)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsNearOriginal check that point is not farther than tolerance from the original path between from and to.
+ */
+bool IsNearOriginal(const QPointF &p, const QVector<QPointF> &original, int from, int to, qreal tolerance)
+{
+    const int n = original.size();
+    for (int k = from; k != to; k = (k+1) % n)
+    {
+        if (DistanceToSegment(p, original.at(k), original.at((k+1) % n)) <= tolerance)
+        {
+            return true;
+        }
+    }
+    return false;
+}
 }
 
 // Friend functions
@@ -1178,6 +1249,127 @@ qreal VAbstractPiece::SumTrapezoids(const QVector<QPointF> &points)
     return res;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SimplifyOutward reduce number of vertices of a closed contour. Result always encloses the original contour
+ * and doesn't go farther than tolerance from it.
+ *
+ * Only two operations are used. A reflex vertex is removed if the new edge passes near original vertices. Two
+ * neighbor convex vertices are replaced by intersection of adjacent edges if the intersection stays near the original.
+ * Both operations only add area, so simplified contour can be safely used for nesting.
+ * @param points closed contour without repeated first point.
+ * @param tolerance max allowed deviation.
+ * @return simplified contour.
+ */
+QVector<QPointF> VAbstractPiece::SimplifyOutward(const QVector<QPointF> &points, qreal tolerance)
+{
+    const int n = points.size();
+    if (n <= 4 || tolerance <= 0)
+    {
+        return points;
+    }
+
+    qreal area = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        area += Cross(points.at(i), points.at((i+1) % n));
+    }
+
+    if (qFuzzyIsNull(area))
+    {
+        return points;
+    }
+
+    // Positive if a vertex is on the inner side of a directed edge
+    const qreal orientation = area > 0 ? 1 : -1;
+
+    QVector<VOutlineVertex> outline;
+    outline.reserve(n);
+    for (int i = 0; i < n; ++i)
+    {
+        VOutlineVertex vertex;
+        vertex.point = points.at(i);
+        vertex.first = i;
+        vertex.last = i;
+        outline.append(vertex);
+    }
+
+    bool changed = true;
+    while (changed && outline.size() > 4)
+    {
+        changed = false;
+
+        for (int i = 0; i < outline.size() && outline.size() > 4; ++i)
+        {
+            const int m = outline.size();
+            const VOutlineVertex &prev = outline.at((i-1+m) % m);
+            const VOutlineVertex &current = outline.at(i);
+            const VOutlineVertex &next = outline.at((i+1) % m);
+
+            if (Cross(next.point - prev.point, current.point - prev.point) * orientation >= 0)
+            { // Reflex or collinear, the new edge lies outside
+                if (IsOriginalNear(points, prev.last, next.first, {prev.point, next.point}, tolerance))
+                {
+                    outline.remove(i);
+                    --i;
+                    changed = true;
+                }
+                continue;
+            }
+
+            const VOutlineVertex &afterNext = outline.at((i+2) % m);
+            if (Cross(afterNext.point - current.point, next.point - current.point) * orientation >= 0)
+            {
+                continue; // Next vertex is not convex
+            }
+
+            QPointF crossPoint;
+            const QLineF line1(prev.point, current.point);
+            const QLineF line2(next.point, afterNext.point);
+            if (line1.intersects(line2, &crossPoint) == QLineF::NoIntersection)
+            {
+                continue;
+            }
+
+            // Intersection must lie forward of both edges, otherwise the corner is too sharp
+            if (QPointF::dotProduct(crossPoint - current.point, current.point - prev.point) < 0 ||
+                QPointF::dotProduct(next.point - crossPoint, afterNext.point - next.point) < 0)
+            {
+                continue;
+            }
+
+            if (not IsNearOriginal(crossPoint, points, prev.last, afterNext.first, tolerance) ||
+                not IsOriginalNear(points, prev.last, afterNext.first, {prev.point, crossPoint, afterNext.point},
+                                   tolerance))
+            {
+                continue;
+            }
+
+            VOutlineVertex merged;
+            merged.point = crossPoint;
+            merged.first = current.first;
+            merged.last = next.last;
+
+            const int nextIndex = (i+1) % m;
+            outline[i] = merged;
+            outline.remove(nextIndex);
+            if (nextIndex < i)
+            {
+                --i;
+            }
+            changed = true;
+        }
+    }
+
+    QVector<QPointF> simplified;
+    simplified.reserve(outline.size());
+    for (auto &vertex : qAsConst(outline))
+    {
+        simplified.append(vertex.point);
+    }
+    return simplified;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QVector<QPointF> VAbstractPiece::CheckLoops(const QVector<QPointF> &points)
 {
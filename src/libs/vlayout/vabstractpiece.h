@@ -93,6 +93,7 @@ public:
 
     static QVector<QPointF> Equidistant(QVector<VSAPoint> points, qreal width, const QString &name);
     static qreal            SumTrapezoids(const QVector<QPointF> &points);
+    static QVector<QPointF> SimplifyOutward(const QVector<QPointF> &points, qreal tolerance);
     static QVector<QPointF> CheckLoops(const QVector<QPointF> &points);
     static QVector<QPointF> CheckLoops(const QVector<VRawSAPoint> &points);
     static QVector<VRawSAPoint> EkvPoint(QVector<VRawSAPoint> points, const VSAPoint &p1Line1, const VSAPoint &p2Line1,
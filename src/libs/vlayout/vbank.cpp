@@ -206,10 +206,32 @@ void VBank::SetNestQuantity(bool value)
     m_nestQuantity = value;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GetSimplifyTolerance return tolerance for simplification of layout allowance. By default one tenth of layout
+ * width, so simplified contour only slightly widens the gap between pieces.
+ */
+qreal VBank::GetSimplifyTolerance() const
+{
+    return m_simplifyTolerance < 0 ? layoutWidth / 10. : m_simplifyTolerance;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetSimplifyTolerance set tolerance for simplification of layout allowance. Zero disables simplification,
+ * negative value restores default.
+ */
+void VBank::SetSimplifyTolerance(qreal value)
+{
+    m_simplifyTolerance = value;
+    Reset();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VBank::SetDetails(const QVector<VLayoutPiece> &details)
 {
     this->details = details;
+    m_rotations.clear();
     Reset();
 }
 
@@ -283,6 +305,57 @@ VLayoutPiece VBank::GetDetail(int i) const
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GetRotations return copies of the detail rotated around the origin by k*(360/number) degrees.
+ *
+ * Rotations are built once and reused for every sheet and every pair of edges. Mapped geometry of each copy is
+ * prepared in advance, so position workers only translate them.
+ * @param i detail index.
+ * @param number number of rotations.
+ */
+QVector<VLayoutPiece> VBank::GetRotations(int i, int number)
+{
+    if (i < 0 || i >= details.size() || number < 1 || number > 360)
+    {
+        return QVector<VLayoutPiece>();
+    }
+
+    QVector<VLayoutPiece> &rotations = m_rotations[qMakePair(i, number)];
+    if (rotations.isEmpty())
+    {
+        rotations = PrepareRotations(details.at(i), number);
+    }
+
+    return rotations;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PrepareRotations return copies of the detail rotated around the origin by k*(360/number) degrees with
+ * prepared mapped geometry.
+ */
+QVector<VLayoutPiece> VBank::PrepareRotations(const VLayoutPiece &detail, int number)
+{
+    QVector<VLayoutPiece> rotations;
+    if (number < 1 || number > 360)
+    {
+        return rotations;
+    }
+
+    const int step = 360/number;
+    rotations.reserve(number+1);
+    for (int angle = 0; angle < 360; angle += step)
+    {
+        VLayoutPiece rotated = detail;
+        rotated.Rotate(QPointF(), angle);
+        rotated.PrepareMappedPaths();
+        rotations.append(rotated);
+    }
+
+    return rotations;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VBank::Arranged(int i)
 {
@@ -380,6 +453,7 @@ bool VBank::PrepareDetails()
     }
 
     diagonal = 0;
+    m_rotations.clear();
 
     for (int i=0; i < details.size(); ++i)
     {
@@ -394,6 +468,9 @@ bool VBank::PrepareDetails()
                                  qWarning() << VAbstractApplication::patternMessageSignature + errorMsg;
         }
 
+        // Nesting works only with layout allowance, full resolution contours are still used for export
+        details[i].SimplifyLayoutAllowance(GetSimplifyTolerance());
+
         const qreal d = details.at(i).Diagonal();
         if (d > diagonal)
         {
@@ -419,6 +496,12 @@ void VBank::Reset()
     diagonal = 0;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+Cases VBank::GetCaseType() const
+{
+    return caseType;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VBank::SetCaseType(Cases caseType)
 {
@@ -31,6 +31,7 @@
 
 #include <QHash>
 #include <QMap>
+#include <QPair>
 #include <QRectF>
 #include <QVector>
 #include <QtGlobal>
@@ -66,9 +67,15 @@ public:
     bool IsNestQuantity() const;
     void SetNestQuantity(bool value);
 
+    qreal GetSimplifyTolerance() const;
+    void  SetSimplifyTolerance(qreal value);
+
     void SetDetails(const QVector<VLayoutPiece> &details);
     int  GetNext();
     VLayoutPiece GetDetail(int i) const;
+    QVector<VLayoutPiece> GetRotations(int i, int number);
+
+    static QVector<VLayoutPiece> PrepareRotations(const VLayoutPiece &detail, int number);
 
     void Arranged(int i);
     void NotArranged(int i);
@@ -76,7 +83,8 @@ public:
     bool PrepareUnsorted();
     bool PrepareDetails();
     void Reset();
-    void SetCaseType(Cases caseType);
+    Cases GetCaseType() const;
+    void  SetCaseType(Cases caseType);
 
     int AllDetailsCount() const;
     int LeftToArrange() const;
@@ -99,6 +107,9 @@ private:
     QVector<uint> groups{};
     QVector<vidtype> arranged{};
 
+    /** @brief m_rotations prepared rotations of details, key is a pair of detail index and number of rotations. */
+    QHash<QPair<int, int>, QVector<VLayoutPiece>> m_rotations{};
+
     qreal layoutWidth{0};
 
     Cases caseType{Cases::CaseDesc};
@@ -106,6 +117,8 @@ private:
     qreal diagonal{0};
     bool m_nestQuantity{false};
     bool m_manualPriority{false};
+    /** @brief m_simplifyTolerance max deviation of nesting contour from layout allowance. Negative means auto. */
+    qreal m_simplifyTolerance{-1};
 
     void PrepareGroup();
 
@@ -24,7 +24,10 @@ HEADERS += \
     $$PWD/vlayoutpiecepath.h \
     $$PWD/vlayoutpiecepath_p.h \
     $$PWD/vbestsquare_p.h \
-    $$PWD/vrawsapoint.h
+    $$PWD/vrawsapoint.h \
+    $$PWD/vlayoutcache.h \
+    $$PWD/vlayoutoptimizer.h \
+    $$PWD/vlayoutprogresslog.h
 
 SOURCES += \
     $$PWD/testpath.cpp \
@@ -40,6 +43,9 @@ SOURCES += \
     $$PWD/vabstractpiece.cpp \
     $$PWD/vlayoutpiece.cpp \
     $$PWD/vlayoutpiecepath.cpp \
-    $$PWD/vrawsapoint.cpp
+    $$PWD/vrawsapoint.cpp \
+    $$PWD/vlayoutcache.cpp \
+    $$PWD/vlayoutoptimizer.cpp \
+    $$PWD/vlayoutprogresslog.cpp
 
 *msvc*:SOURCES += $$PWD/stable.cpp
@@ -0,0 +1,276 @@
+/************************************************************************
+ **
+ **  @file   vlayoutcache.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+
+#include "vlayoutcache.h"
+
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QtDebug>
+
+#include "vlayoutgenerator.h"
+
+QT_WARNING_PUSH
+QT_WARNING_DISABLE_CLANG("-Wmissing-prototypes")
+QT_WARNING_DISABLE_INTEL(1418)
+
+Q_LOGGING_CATEGORY(lLayoutCache, "layout.cache")
+
+QT_WARNING_POP
+
+const quint32 VLayoutCache::streamHeader = 0x36628015; // CRC-32Q string "VLayoutCache"
+const quint16 VLayoutCache::classVersion = 2;
+
+const qint64 VLayoutCache::maxCacheSize = 64 * 1024 * 1024;
+const int VLayoutCache::maxAgeDays = 30;
+
+QString VLayoutCache::cacheDir = QString();
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Load look for a saved layout of the same problem and put it into the generator.
+ * @param generator generator with details and settings already set.
+ * @param result serialized layout, the same as returned by VLayoutGenerator::SerializeResult().
+ * @param exactMatch true if the saved layout was made with the same search budget. Otherwise the generator also gets
+ * search state to continue from.
+ * @return true if a layout was loaded.
+ */
+bool VLayoutCache::Load(VLayoutGenerator &generator, QByteArray &result, bool &exactMatch)
+{
+    const QString path = FilePath(generator);
+    if (not Read(path, generator, result, exactMatch, true))
+    {
+        return false;
+    }
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+    // Modification time is the last use of the entry, see Evict()
+    QFile file(path);
+    if (file.open(QIODevice::ReadWrite))
+    {
+        file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+    }
+#endif
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Save store the best layout with current search state of the generator.
+ * @param result serialized layout, see VLayoutGenerator::SerializeResult().
+ */
+bool VLayoutCache::Save(const VLayoutGenerator &generator, const QByteArray &result)
+{
+    const bool saved = Write(FilePath(generator), generator, result);
+    Evict(CacheDir(), maxCacheSize, maxAgeDays);
+    return saved;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LoadCheckpoint resume from the best layout of an interrupted run. A checkpoint is never final, the generator
+ * always gets search state to continue from.
+ * @return false if there is no checkpoint or it was made for another problem.
+ */
+bool VLayoutCache::LoadCheckpoint(VLayoutGenerator &generator, QByteArray &result, const QString &path)
+{
+    bool exactMatch = false;
+    return Read(path, generator, result, exactMatch, false);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SaveCheckpoint store the best layout so far of a running search. The old checkpoint is replaced atomically,
+ * so killing the process never leaves a broken file.
+ */
+bool VLayoutCache::SaveCheckpoint(const VLayoutGenerator &generator, const QByteArray &result, const QString &path)
+{
+    return Write(path, generator, result);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Evict remove cache entries older than maxAge days, then the least recently used entries until the rest fits
+ * into maxSize bytes.
+ */
+void VLayoutCache::Evict(const QString &dirPath, qint64 maxSize, int maxAge)
+{
+    const QDir dir(dirPath);
+    const QFileInfoList entries = dir.entryInfoList(QStringList(QStringLiteral("*.layout")), QDir::Files,
+                                                    QDir::Time); // Newest first
+    const QDateTime oldest = QDateTime::currentDateTime().addDays(-maxAge);
+
+    qint64 size = 0;
+    for (auto &entry : entries)
+    {
+        size += entry.size();
+        if (entry.lastModified() < oldest || size > maxSize)
+        {
+            qCDebug(lLayoutCache, "Evict layout cache entry %s", qUtf8Printable(entry.fileName()));
+            QFile::remove(entry.absoluteFilePath());
+            size -= entry.size();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CacheDir return the directory of cache entries. By default it is in the user cache location.
+ */
+QString VLayoutCache::CacheDir()
+{
+    if (cacheDir.isEmpty())
+    {
+        return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/layouts");
+    }
+    return cacheDir;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetCacheDir keep cache entries in another directory. An empty path restores the default one.
+ */
+void VLayoutCache::SetCacheDir(const QString &path)
+{
+    cacheDir = path;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VLayoutCache::Read(const QString &path, VLayoutGenerator &generator, QByteArray &result, bool &exactMatch,
+                        bool removeBroken)
+{
+    exactMatch = false;
+
+    QFile file(path);
+    if (not file.exists() || not file.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    QDataStream dataStream(&file);
+    dataStream.setVersion(QDataStream::Qt_5_4);
+
+    quint32 actualStreamHeader = 0;
+    quint16 actualClassVersion = 0;
+    dataStream >> actualStreamHeader >> actualClassVersion;
+
+    if (actualStreamHeader != streamHeader || actualClassVersion != classVersion)
+    {
+        file.close();
+        if (removeBroken)
+        {
+            file.remove(); // Written by other version, will be replaced by the next run
+        }
+        return false;
+    }
+
+    QByteArray problemHash;
+    QByteArray resultHash;
+    QByteArray data;
+    qreal shift = -1;
+    bool rotate = false;
+    int rotationNumber = 2;
+    dataStream >> problemHash >> resultHash >> data >> shift >> rotate >> rotationNumber;
+
+    if (dataStream.status() != QDataStream::Ok)
+    {
+        qCDebug(lLayoutCache, "Broken layout cache entry %s", qUtf8Printable(file.fileName()));
+        file.close();
+        if (removeBroken)
+        {
+            file.remove();
+        }
+        return false;
+    }
+
+    if (problemHash != generator.ProblemHash())
+    {
+        return false;
+    }
+
+    if (not generator.DeserializeResult(data))
+    {
+        qCDebug(lLayoutCache, "Broken layout cache entry %s", qUtf8Printable(file.fileName()));
+        file.close();
+        if (removeBroken)
+        {
+            file.remove();
+        }
+        return false;
+    }
+
+    result = data;
+    exactMatch = removeBroken && (resultHash == generator.ResultHash());
+
+    if (not exactMatch)
+    {
+        generator.SetStartShift(shift);
+        generator.SetRotate(rotate);
+        generator.SetRotationNumber(rotationNumber);
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VLayoutCache::Write(const QString &path, const VLayoutGenerator &generator, const QByteArray &result)
+{
+    if (not QDir().mkpath(QFileInfo(path).absolutePath()))
+    {
+        return false;
+    }
+
+    QSaveFile file(path);
+    if (not file.open(QIODevice::WriteOnly))
+    {
+        qWarning() << QCoreApplication::translate("VLayoutCache", "Can't save layout cache to %1. Error: %2.")
+                      .arg(path, file.errorString());
+        return false;
+    }
+
+    QDataStream dataStream(&file);
+    dataStream.setVersion(QDataStream::Qt_5_4);
+    dataStream << streamHeader << classVersion;
+    dataStream << generator.ProblemHash() << generator.ResultHash() << result;
+    dataStream << generator.GetShift() << generator.GetRotate() << generator.GetRotationNumber();
+
+    return file.commit();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString VLayoutCache::FilePath(const VLayoutGenerator &generator)
+{
+    return CacheDir() + QLatin1Char('/') + QString::fromLatin1(generator.ProblemHash().toHex()) + QStringLiteral(".layout");
+}
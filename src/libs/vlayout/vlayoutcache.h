@@ -0,0 +1,87 @@
+/************************************************************************
+ **
+ **  @file   vlayoutcache.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+
+#ifndef VLAYOUTCACHE_H
+#define VLAYOUTCACHE_H
+
+#include <QByteArray>
+#include <QLoggingCategory>
+#include <QString>
+#include <QtGlobal>
+
+class VLayoutGenerator;
+
+Q_DECLARE_LOGGING_CATEGORY(lLayoutCache)
+
+/**
+ * @brief The VLayoutCache class keeps finished layouts on disk.
+ *
+ * An entry is found by the problem hash of the generator: details and settings that constrain nesting. If the search
+ * budget also matches, the entry is the answer and nesting can be skipped. Otherwise the entry is a warm start: its
+ * layout becomes the result to beat and the search resumes where the saved one stopped.
+ *
+ * The same format serves as checkpoint of a long run. A checkpoint lives at a path chosen by user and is always a warm
+ * start.
+ *
+ * Saving an entry evicts entries not used for maxAgeDays and then the least recently used ones until the cache fits
+ * into maxCacheSize.
+ */
+class VLayoutCache
+{
+public:
+    static bool Load(VLayoutGenerator &generator, QByteArray &result, bool &exactMatch);
+    static bool Save(const VLayoutGenerator &generator, const QByteArray &result);
+
+    static bool LoadCheckpoint(VLayoutGenerator &generator, QByteArray &result, const QString &path);
+    static bool SaveCheckpoint(const VLayoutGenerator &generator, const QByteArray &result, const QString &path);
+
+    static void Evict(const QString &dirPath, qint64 maxSize, int maxAge);
+
+    static QString CacheDir();
+    static void    SetCacheDir(const QString &path);
+
+    static const qint64 maxCacheSize;
+    static const int    maxAgeDays;
+
+private:
+    Q_DISABLE_COPY(VLayoutCache)
+
+    static const quint32 streamHeader;
+    static const quint16 classVersion;
+
+    static QString cacheDir;
+
+    static QString FilePath(const VLayoutGenerator &generator);
+
+    static bool Read(const QString &path, VLayoutGenerator &generator, QByteArray &result, bool &exactMatch,
+                     bool removeBroken);
+    static bool Write(const QString &path, const VLayoutGenerator &generator, const QByteArray &result);
+};
+
+#endif // VLAYOUTCACHE_H
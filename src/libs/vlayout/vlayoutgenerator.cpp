@@ -28,18 +28,38 @@
 
 #include "vlayoutgenerator.h"
 
+#include <QCryptographicHash>
+#include <QDataStream>
 #include <QElapsedTimer>
 #include <QGraphicsRectItem>
+#include <QHash>
 #include <QRectF>
 #include <QThreadPool>
+#include <algorithm>
 
 #include "../vmisc/def.h"
 #include "../vmisc/vmath.h"
 #include "../vmisc/compatibility.h"
+#include "../vmisc/vtrace.h"
+#include "vlayoutcache.h"
 #include "vlayoutpiece.h"
 #include "vlayoutpaper.h"
 #include "../ifc/exception/vexceptionterminatedposition.h"
 
+QT_WARNING_PUSH
+QT_WARNING_DISABLE_CLANG("-Wmissing-prototypes")
+QT_WARNING_DISABLE_INTEL(1418)
+
+Q_LOGGING_CATEGORY(lLayoutGenerator, "layout.generator")
+
+QT_WARNING_POP
+
+namespace
+{
+const int optimizerRounds = 16;
+const qreal repairThreshold = 90; // Minimal efficiency of a repaired layout in percent of the previous one
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VLayoutGenerator::VLayoutGenerator(QObject *parent)
     : QObject(parent),
@@ -80,6 +100,16 @@ VLayoutGenerator::~VLayoutGenerator()
 void VLayoutGenerator::SetDetails(const QVector<VLayoutPiece> &details)
 {
     bank->SetDetails(details);
+
+    // Hash pieces once, their serialization covers geometry, quantity and grainline.
+    QByteArray data;
+    QDataStream dataStream(&data, QIODevice::WriteOnly);
+    dataStream.setVersion(QDataStream::Qt_5_4);
+    dataStream << details;
+    detailsHash = QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+
+    optimizerRun = 0;
+    optimizerGenome = VLayoutGenome();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -104,6 +134,9 @@ int VLayoutGenerator::DetailsCount()
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutGenerator::Generate(const QElapsedTimer &timer, qint64 timeout, LayoutErrors previousState)
 {
+    VTraceScope trace("Generate layout", "layout");
+    trace.AddArg("pieces", DetailsCount());
+
     auto HasExpired = [this, timer, timeout]()
     {
         if (timer.hasExpired(timeout))
@@ -131,34 +164,12 @@ void VLayoutGenerator::Generate(const QElapsedTimer &timer, qint64 timeout, Layo
     int width = PageWidth();
     int height = PageHeight();
 
-    if (VFuzzyComparePossibleNulls(shift, -1))
+    if (not PrepareDetails(height, width))
     {
-        if (bank->PrepareDetails())
-        {
-            SetShift(ToPixel(1, Unit::Cm));
-        }
-        else
-        {
-            state = LayoutErrors::PrepareLayoutError;
-            return;
-        }
-
-        if (stripOptimization)
-        {
-            const qreal b = bank->GetBiggestDiagonal() * multiplier + bank->GetLayoutWidth();
-
-            auto SetStrip = [this, b](int &side)
-            {
-                if (side >= b*2)
-                {
-                    stripOptimizationEnabled = true;
-                    side = qFloor(side / qFloor(side/b));
-                }
-            };
-
-            IsPortrait() ? SetStrip(height) : SetStrip(width);
-        }
+        state = LayoutErrors::PrepareLayoutError;
+        return;
     }
+    stripPending = false; // Only the first attempt nests in strips
 
     if (HasExpired())
     {
@@ -172,78 +183,91 @@ void VLayoutGenerator::Generate(const QElapsedTimer &timer, qint64 timeout, Layo
             return;
         }
 
-        while (bank->AllDetailsCount() > 0)
+        if (optimizer)
         {
-            if (stopGeneration.load())
+            if (not Optimize(height, width, timer, timeout))
             {
                 return;
             }
-
-            if (HasExpired())
+        }
+        else
+        {
+            while (bank->AllDetailsCount() > 0)
             {
-                return;
-            }
+                if (stopGeneration.load())
+                {
+                    return;
+                }
 
-            VLayoutPaper paper(height, width, bank->GetLayoutWidth());
-            paper.SetShift(shift);
-            paper.SetPaperIndex(static_cast<quint32>(papers.count()));
-            paper.SetRotate(rotate);
-            paper.SetFollowGrainline(followGrainline);
-            paper.SetRotationNumber(rotationNumber);
-            paper.SetSaveLength(saveLength);
-            paper.SetOriginPaperPortrait(IsPortrait());
-            do
-            {
-                const int index = bank->GetNext();
-                try
+                if (HasExpired())
                 {
-                    if (paper.ArrangeDetail(bank->GetDetail(index), stopGeneration))
+                    return;
+                }
+
+                VLayoutPaper paper(height, width, bank->GetLayoutWidth());
+                paper.SetShift(shift);
+                paper.SetPaperIndex(static_cast<quint32>(papers.count()));
+                paper.SetRotate(rotate);
+                paper.SetFollowGrainline(followGrainline);
+                paper.SetRotationNumber(rotationNumber);
+                paper.SetSaveLength(saveLength);
+                paper.SetOriginPaperPortrait(IsPortrait());
+                do
+                {
+                    const int index = bank->GetNext();
+                    try
                     {
-                        bank->Arranged(index);
+                        const VLayoutPiece detail = bank->GetDetail(index);
+                        const QVector<VLayoutPiece> rotations =
+                                bank->GetRotations(index, paper.LocalRotationNumber(detail));
+                        if (paper.ArrangeDetail(detail, stopGeneration, rotations))
+                        {
+                            bank->Arranged(index);
+                        }
+                        else
+                        {
+                            bank->NotArranged(index);
+                        }
                     }
-                    else
+                    catch (const VExceptionTerminatedPosition &e)
                     {
-                        bank->NotArranged(index);
+                        qCritical() << e.ErrorMessage();
+                        state = LayoutErrors::TerminatedByException;
+                        return;
+                    }
+
+                    QCoreApplication::processEvents();
+
+                    if (stopGeneration.load())
+                    {
+                        break;
                     }
-                }
-                catch (const VExceptionTerminatedPosition &e)
-                {
-                    qCritical() << e.ErrorMessage();
-                    state = LayoutErrors::TerminatedByException;
-                    return;
-                }
 
-                QCoreApplication::processEvents();
+                    if (HasExpired())
+                    {
+                        return;
+                    }
+                } while(bank->LeftToArrange() > 0);
 
                 if (stopGeneration.load())
                 {
-                    break;
+                    return;
                 }
 
                 if (HasExpired())
                 {
                     return;
                 }
-            } while(bank->LeftToArrange() > 0);
 
-            if (stopGeneration.load())
-            {
-                return;
-            }
-
-            if (HasExpired())
-            {
-                return;
-            }
-
-            if (paper.Count() > 0)
-            {
-                papers.append(paper);
-            }
-            else
-            {
-                state = LayoutErrors::EmptyPaperError;
-                return;
+                if (paper.Count() > 0)
+                {
+                    papers.append(paper);
+                }
+                else
+                {
+                    state = LayoutErrors::EmptyPaperError;
+                    return;
+                }
             }
         }
     }
@@ -267,6 +291,193 @@ void VLayoutGenerator::Generate(const QElapsedTimer &timer, qint64 timeout, Layo
     {
         UnitePages();
     }
+
+    if (VTrace::IsEnabled() && not papers.isEmpty())
+    {
+        trace.AddArg("papers", papers.size());
+        trace.AddArg("efficiency", QString::number(LayoutEfficiency()));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Repair update the previous layout instead of nesting from scratch.
+ *
+ * Details found in the previous layout with the same id and geometry keep their places. Changed, new and conflicting
+ * details are arranged into free space of existing sheets, what doesn't fit goes to new sheets. The result is accepted
+ * only if its efficiency is not less than repair threshold percent of the previous one.
+ * @return true if the repaired layout is accepted. Otherwise papers are empty and a full nesting is needed.
+ */
+bool VLayoutGenerator::Repair(const QElapsedTimer &timer, qint64 timeout)
+{
+    VTraceScope trace("Repair layout", "layout");
+
+    papers.clear();
+    bank->Reset();
+    state = LayoutErrors::NoError;
+    stopGeneration.store(false);
+
+    if (previousLayout.isEmpty())
+    {
+        return false;
+    }
+
+    // The previous layout is made of whole sheets, strips are already gathered. Strips stay pending for the full
+    // nesting that follows if the repair fails.
+    int width = PageWidth();
+    int height = PageHeight();
+    if (not PrepareDetails(height, width) || not bank->PrepareUnsorted())
+    {
+        state = LayoutErrors::PrepareLayoutError;
+        return false;
+    }
+    width = PageWidth();
+    height = PageHeight();
+
+    auto NewPaper = [this, height, width]()
+    {
+        VLayoutPaper paper(height, width, bank->GetLayoutWidth());
+        paper.SetShift(shift);
+        paper.SetPaperIndex(static_cast<quint32>(papers.count()));
+        paper.SetRotate(rotate);
+        paper.SetFollowGrainline(followGrainline);
+        paper.SetRotationNumber(rotationNumber);
+        paper.SetSaveLength(saveLength);
+        paper.SetOriginPaperPortrait(IsPortrait());
+        return paper;
+    };
+
+    auto Clear = [this]()
+    {
+        papers.clear();
+        bank->Reset();
+        return false;
+    };
+
+    // Efficiency to compare with must be measured the same way as the new one
+    for (auto &sheet : qAsConst(previousLayout))
+    {
+        VLayoutPaper paper = NewPaper();
+        paper.SetDetails(ConvertToList(sheet));
+        papers.append(paper);
+    }
+    const qreal previousEfficiency = LayoutEfficiency();
+    papers.clear();
+
+    QHash<QPair<vidtype, QByteArray>, QVector<int>> unplaced;
+    const int count = bank->AllDetailsCount();
+    for (int i = 0; i < count; ++i)
+    {
+        const VLayoutPiece detail = bank->GetDetail(i);
+        unplaced[qMakePair(detail.GetId(), detail.GeometryHash())].append(i);
+    }
+
+    int kept = 0;
+    for (auto &sheet : qAsConst(previousLayout))
+    {
+        VLayoutPaper paper = NewPaper();
+        for (auto &oldDetail : sheet)
+        {
+            auto match = unplaced.find(qMakePair(oldDetail.GetId(), oldDetail.GeometryHash()));
+            if (match == unplaced.end() || match->isEmpty())
+            {
+                continue; // Changed or removed
+            }
+
+            VLayoutPiece detail = bank->GetDetail(match->first());
+            detail.SetMatrix(oldDetail.GetMatrix());
+            detail.SetMirror(oldDetail.IsMirror());
+            if (paper.PlaceDetail(detail))
+            {
+                match->removeFirst();
+                ++kept;
+            }
+        }
+
+        if (paper.Count() > 0)
+        {
+            papers.append(paper);
+        }
+    }
+
+    QVector<int> rest;
+    for (auto &indexes : qAsConst(unplaced))
+    {
+        rest += indexes;
+    }
+
+    const bool manualPriority = bank->GetManualPriority();
+    std::sort(rest.begin(), rest.end(), [this, manualPriority](int a, int b)
+    {
+        const VLayoutPiece detailA = bank->GetDetail(a);
+        const VLayoutPiece detailB = bank->GetDetail(b);
+        if (manualPriority && detailA.GetPriority() != detailB.GetPriority())
+        {
+            return detailA.GetPriority() < detailB.GetPriority();
+        }
+        return detailA.Square() != detailB.Square() ? detailA.Square() > detailB.Square() : a < b;
+    });
+
+    trace.AddArg("kept", kept);
+    trace.AddArg("replaced", rest.size());
+
+    for (auto index : qAsConst(rest))
+    {
+        if (stopGeneration.load() || timer.hasExpired(timeout))
+        {
+            return Clear();
+        }
+
+        const VLayoutPiece detail = bank->GetDetail(index);
+        try
+        {
+            bool arranged = false;
+            for (auto &paper : papers)
+            {
+                const QVector<VLayoutPiece> rotations = bank->GetRotations(index, paper.LocalRotationNumber(detail));
+                if (paper.ArrangeDetail(detail, stopGeneration, rotations))
+                {
+                    arranged = true;
+                    break;
+                }
+            }
+
+            if (not arranged)
+            {
+                VLayoutPaper paper = NewPaper();
+                const QVector<VLayoutPiece> rotations = bank->GetRotations(index, paper.LocalRotationNumber(detail));
+                if (not paper.ArrangeDetail(detail, stopGeneration, rotations))
+                {
+                    state = LayoutErrors::EmptyPaperError;
+                    return Clear();
+                }
+                papers.append(paper);
+            }
+        }
+        catch (const VExceptionTerminatedPosition &e)
+        {
+            qCritical() << e.ErrorMessage();
+            state = LayoutErrors::TerminatedByException;
+            return Clear();
+        }
+    }
+
+    if (stopGeneration.load() || papers.isEmpty())
+    {
+        return Clear();
+    }
+
+    const qreal efficiency = LayoutEfficiency();
+    trace.AddArg("efficiency", QString::number(efficiency));
+
+    if (efficiency < previousEfficiency * repairThreshold / 100.0)
+    {
+        qCDebug(lLayoutGenerator, "Repaired layout efficiency %f is too low, previous was %f.", efficiency,
+                previousEfficiency);
+        return Clear();
+    }
+
+    return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -425,6 +636,242 @@ bool VLayoutGenerator::IsPortrait() const
     return PageHeight() >= PageWidth();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+qreal VLayoutGenerator::GetStartShift() const
+{
+    return startShift;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetStartShift set shift the search starts from after details are prepared. Negative value means default.
+ */
+void VLayoutGenerator::SetStartShift(qreal value)
+{
+    startShift = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SettingsHash return hash of all settings that constrain nesting. A layout made with other settings can't be
+ * repaired. Search state (shift, rotation) and time budget are not included.
+ */
+QByteArray VLayoutGenerator::SettingsHash() const
+{
+    QByteArray data;
+    QDataStream dataStream(&data, QIODevice::WriteOnly);
+    dataStream.setVersion(QDataStream::Qt_5_4);
+
+    dataStream << paperHeight << paperWidth << usePrinterFields;
+    dataStream << margins.left() << margins.top() << margins.right() << margins.bottom();
+    dataStream << bank->GetLayoutWidth() << static_cast<qint8>(bank->GetCaseType());
+    dataStream << bank->GetManualPriority() << bank->IsNestQuantity() << bank->GetSimplifyTolerance();
+    dataStream << followGrainline << autoCropLength << autoCropWidth << saveLength << preferOneSheetSolution;
+    dataStream << unitePages << multiplier << stripOptimization << textAsPaths;
+
+    return QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ProblemHash return hash of everything that defines a layout: details and settings, see SettingsHash().
+ */
+QByteArray VLayoutGenerator::ProblemHash() const
+{
+    QByteArray data;
+    QDataStream dataStream(&data, QIODevice::WriteOnly);
+    dataStream.setVersion(QDataStream::Qt_5_4);
+
+    dataStream << detailsHash << SettingsHash();
+
+    return QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ResultHash return hash of the problem together with the search budget. Equal hashes mean a new search would
+ * be the repetition of the old one.
+ */
+QByteArray VLayoutGenerator::ResultHash() const
+{
+    QByteArray data;
+    QDataStream dataStream(&data, QIODevice::WriteOnly);
+    dataStream.setVersion(QDataStream::Qt_5_4);
+
+    dataStream << ProblemHash() << nestingTime << efficiencyCoefficient << optimizer << seed;
+
+    return QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsOptimizer return true if details are arranged by VLayoutOptimizer instead of the greedy bank order.
+ */
+bool VLayoutGenerator::IsOptimizer() const
+{
+    return optimizer;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutGenerator::SetOptimizer(bool value)
+{
+    optimizer = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GetSeed return seed of the optimizer. The same seed and the same settings give the same layout, unless the
+ * nesting time stops the optimizer before it finishes all rounds.
+ */
+quint32 VLayoutGenerator::GetSeed() const
+{
+    return seed;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutGenerator::SetSeed(quint32 value)
+{
+    seed = value;
+    optimizerRun = 0;
+    optimizerGenome = VLayoutGenome();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsUseCache return true if finished layouts may be taken from and stored to VLayoutCache.
+ */
+bool VLayoutGenerator::IsUseCache() const
+{
+    return useCache;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutGenerator::SetUseCache(bool value)
+{
+    useCache = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GetCheckpointPath return path where the best layout so far is kept during nesting. Empty path means no
+ * checkpoint.
+ */
+QString VLayoutGenerator::GetCheckpointPath() const
+{
+    return checkpointPath;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutGenerator::SetCheckpointPath(const QString &value)
+{
+    checkpointPath = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GetProgressPath return path for progress events, see VLayoutProgressLog. "-" means standard output.
+ */
+QString VLayoutGenerator::GetProgressPath() const
+{
+    return progressPath;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutGenerator::SetProgressPath(const QString &value)
+{
+    progressPath = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ArrangedCount return number of details already placed by the running attempt. The optimizer doesn't take
+ * details from the bank, for it the number is taken from the best layout so far.
+ */
+int VLayoutGenerator::ArrangedCount() const
+{
+    if (not optimizer)
+    {
+        return bank->ArrangedCount();
+    }
+
+    if (runningOptimizer != nullptr)
+    {
+        return runningOptimizer->BestPlacedCount();
+    }
+
+    int count = 0;
+    for (auto &paper : papers)
+    {
+        count += paper.Count();
+    }
+    return count;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsRepairLayout return true if the previous layout should be repaired before a full nesting, see Repair().
+ */
+bool VLayoutGenerator::IsRepairLayout() const
+{
+    return repairLayout;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutGenerator::SetRepairLayout(bool value)
+{
+    repairLayout = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetPreviousLayout set details of the previous layout sheet by sheet, as returned by GetAllDetails().
+ */
+void VLayoutGenerator::SetPreviousLayout(const QVector<QVector<VLayoutPiece>> &layout)
+{
+    previousLayout = layout;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QByteArray VLayoutGenerator::SerializeResult() const
+{
+    QByteArray data;
+    QDataStream dataStream(&data, QIODevice::WriteOnly);
+    dataStream.setVersion(QDataStream::Qt_5_4);
+    dataStream << papers;
+    return data;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief DeserializeResult restore papers saved by SerializeResult.
+ * @return false if data is broken. In this case the generator stays unchanged.
+ */
+bool VLayoutGenerator::DeserializeResult(const QByteArray &data)
+{
+    QDataStream dataStream(data);
+    dataStream.setVersion(QDataStream::Qt_5_4);
+
+    QVector<VLayoutPaper> result;
+    try
+    {
+        dataStream >> result;
+    }
+    catch (const VException &e)
+    {
+        qCWarning(lLayoutCache, "Broken layout data. %s", qUtf8Printable(e.ErrorMessage()));
+        return false;
+    }
+
+    if (dataStream.status() != QDataStream::Ok || result.isEmpty())
+    {
+        return false;
+    }
+
+    papers = result;
+    state = LayoutErrors::NoError;
+    return true;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutGenerator::GatherPages()
 {
@@ -651,6 +1098,98 @@ QList<VLayoutPiece> VLayoutGenerator::MoveDetails(qreal length, const QVector<VL
     return newDetails;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PrepareDetails prepare details in the bank and pick the start shift. Does nothing after the first call.
+ * The first call can also cut the sheet to a strip.
+ * @return false if details can't be prepared.
+ */
+bool VLayoutGenerator::PrepareDetails(int &height, int &width)
+{
+    if (VFuzzyComparePossibleNulls(shift, -1))
+    {
+        if (not bank->PrepareDetails())
+        {
+            return false;
+        }
+
+        SetShift(startShift > 0 ? startShift : ToPixel(1, Unit::Cm));
+        stripPending = stripOptimization;
+    }
+
+    if (stripPending)
+    {
+        const qreal b = bank->GetBiggestDiagonal() * multiplier + bank->GetLayoutWidth();
+
+        auto SetStrip = [this, b](int &side)
+        {
+            if (side >= b*2)
+            {
+                stripOptimizationEnabled = true;
+                side = qFloor(side / qFloor(side/b));
+            }
+        };
+
+        IsPortrait() ? SetStrip(height) : SetStrip(width);
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Optimize arrange details by VLayoutOptimizer. Each call starts from the best genome of the previous one with
+ * the next seed, so the outer search over shift and rotation keeps improving the same solution.
+ * @return false if there is no layout.
+ */
+bool VLayoutGenerator::Optimize(int height, int width, const QElapsedTimer &timer, qint64 timeout)
+{
+    VLayoutPaper paper(height, width, bank->GetLayoutWidth());
+    paper.SetShift(shift);
+    paper.SetRotate(rotate);
+    paper.SetFollowGrainline(followGrainline);
+    paper.SetRotationNumber(rotationNumber);
+    paper.SetSaveLength(saveLength);
+    paper.SetOriginPaperPortrait(IsPortrait());
+
+    QVector<VLayoutPiece> details;
+    details.reserve(bank->AllDetailsCount());
+    for (int i = 0; i < bank->AllDetailsCount(); ++i)
+    {
+        details.append(bank->GetDetail(i));
+    }
+
+    VLayoutOptimizer layoutOptimizer(details, paper, stopGeneration);
+    layoutOptimizer.SetSeed(seed + optimizerRun++);
+    layoutOptimizer.SetManualPriority(bank->GetManualPriority());
+    layoutOptimizer.SetStart(optimizerGenome);
+
+    // Finish before the deadline, otherwise the result will be dropped as timed out. Console mode stops nesting one
+    // second earlier.
+    auto TimeLeft = [timer, timeout]()
+    {
+        return timeout - timer.elapsed() - 1000;
+    };
+
+    runningOptimizer = &layoutOptimizer;
+    const LayoutErrors result = layoutOptimizer.Run(optimizerRounds, TimeLeft);
+    runningOptimizer = nullptr;
+    if (stopGeneration.load())
+    {
+        return false;
+    }
+
+    if (result != LayoutErrors::NoError)
+    {
+        state = result;
+        return false;
+    }
+
+    papers = layoutOptimizer.BestResult();
+    optimizerGenome = layoutOptimizer.BestGenome();
+    return true;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief MasterPage return one "master" page combined all pieces on all pages.
@@ -857,6 +1396,18 @@ void VLayoutGenerator::SetNestQuantity(bool value)
     bank->SetNestQuantity(value);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+qreal VLayoutGenerator::GetSimplifyTolerance() const
+{
+    return bank->GetSimplifyTolerance();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutGenerator::SetSimplifyTolerance(qreal value)
+{
+    bank->SetSimplifyTolerance(value);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 qreal VLayoutGenerator::GetPaperWidth() const
 {
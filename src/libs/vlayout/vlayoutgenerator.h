@@ -31,6 +31,7 @@
 
 #include <qcompilerdetection.h>
 #include <QList>
+#include <QLoggingCategory>
 #include <QMetaObject>
 #include <QObject>
 #include <QString>
@@ -39,14 +40,18 @@
 #include <memory>
 #include <atomic>
 #include <QMargins>
+#include <QByteArray>
 
 #include "vbank.h"
 #include "vlayoutdef.h"
+#include "vlayoutoptimizer.h"
 
 class QGraphicsItem;
 class VLayoutPaper;
 class QElapsedTimer;
 
+Q_DECLARE_LOGGING_CATEGORY(lLayoutGenerator)
+
 class VLayoutGenerator :public QObject
 {
     Q_OBJECT
@@ -80,6 +85,7 @@ public:
     void  SetShift(qreal shift);
 
     void Generate(const QElapsedTimer &timer, qint64 timeout, LayoutErrors previousState = LayoutErrors::NoError);
+    bool Repair(const QElapsedTimer &timer, qint64 timeout);
 
     qreal LayoutEfficiency() const;
 
@@ -105,6 +111,9 @@ public:
     bool IsNestQuantity() const;
     void SetNestQuantity(bool value);
 
+    qreal GetSimplifyTolerance() const;
+    void  SetSimplifyTolerance(qreal value);
+
     int GetRotationNumber() const;
     void SetRotationNumber(int value);
 
@@ -136,6 +145,38 @@ public:
 
     bool IsPortrait() const;
 
+    qreal GetStartShift() const;
+    void  SetStartShift(qreal value);
+
+    bool IsOptimizer() const;
+    void SetOptimizer(bool value);
+
+    quint32 GetSeed() const;
+    void    SetSeed(quint32 value);
+
+    bool IsUseCache() const;
+    void SetUseCache(bool value);
+
+    QString GetCheckpointPath() const;
+    void    SetCheckpointPath(const QString &value);
+
+    QString GetProgressPath() const;
+    void    SetProgressPath(const QString &value);
+
+    int ArrangedCount() const;
+
+    bool IsRepairLayout() const;
+    void SetRepairLayout(bool value);
+
+    void SetPreviousLayout(const QVector<QVector<VLayoutPiece>> &layout);
+
+    QByteArray SettingsHash() const;
+    QByteArray ProblemHash() const;
+    QByteArray ResultHash() const;
+
+    QByteArray SerializeResult() const;
+    bool       DeserializeResult(const QByteArray &data);
+
 public slots:
     void Abort();
     void Timeout();
@@ -165,6 +206,19 @@ private:
     bool textAsPaths;
     int nestingTime{1};
     qreal efficiencyCoefficient{0.0};
+    qreal startShift{-1};
+    QByteArray detailsHash{};
+    bool optimizer{false};
+    quint32 seed{0};
+    quint32 optimizerRun{0};
+    VLayoutGenome optimizerGenome{};
+    const VLayoutOptimizer *runningOptimizer{nullptr};
+    bool useCache{true};
+    QString checkpointPath{};
+    QString progressPath{};
+    bool repairLayout{false};
+    bool stripPending{false};
+    QVector<QVector<VLayoutPiece>> previousLayout{};
 
     int PageHeight() const;
     int PageWidth() const;
@@ -175,6 +229,8 @@ private:
     void UnitePapers(int j, QList<qreal> &papersLength, qreal length);
     QList<VLayoutPiece> MoveDetails(qreal length, const QVector<VLayoutPiece> &details) const;
     VLayoutPaper MasterPage() const;
+    bool PrepareDetails(int &height, int &width);
+    bool Optimize(int height, int width, const QElapsedTimer &timer, qint64 timeout);
 };
 
 #endif // VLAYOUTGENERATOR_H
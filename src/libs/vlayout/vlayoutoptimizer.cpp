@@ -0,0 +1,490 @@
+/************************************************************************
+ **
+ **  @file   vlayoutoptimizer.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "vlayoutoptimizer.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFuture>
+#include <QPointF>
+#include <QRectF>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrent>
+#include <QtDebug>
+#include <QtMath>
+#include <algorithm>
+
+#include "../vmisc/vtrace.h"
+#include "vbank.h"
+#include "../ifc/exception/vexceptionterminatedposition.h"
+
+namespace
+{
+const int candidatesNumber = 8; // Fixed, otherwise the search path would depend on number of cores
+const int orientationsNumber = 4;
+const qreal startTemperature = 0.02;
+const qreal endTemperature = 0.001;
+
+//---------------------------------------------------------------------------------------------------------------------
+int VariantKey(int i, int orientation, bool mirror)
+{
+    return i * orientationsNumber * 2 + orientation * 2 + (mirror ? 1 : 0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Group return arrangement group of the detail with manual priority. Priority 0 means no priority and goes last.
+ */
+uint Group(const VLayoutPiece &detail)
+{
+    return detail.GetPriority() == 0 ? UINT_MAX : detail.GetPriority();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Difference return how much worse fitness a is than fitness b. One sheet costs as much as the whole length.
+ */
+qreal Difference(const VLayoutFitness &a, const VLayoutFitness &b)
+{
+    return (a.papers - b.papers) + (a.length - b.length) / qMax(b.length, 1.0);
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VLayoutGenome::IsValid(int size) const
+{
+    if (order.size() != size || orientation.size() != size || mirror.size() != size)
+    {
+        return false;
+    }
+
+    QVector<int> sorted = order;
+    std::sort(sorted.begin(), sorted.end());
+    for (int i = 0; i < size; ++i)
+    {
+        if (sorted.at(i) != i)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VLayoutFitness::operator<(const VLayoutFitness &other) const
+{
+    return papers < other.papers || (papers == other.papers && length < other.length);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief VLayoutOptimizer constructor.
+ * @param details prepared details, see VBank::PrepareDetails.
+ * @param paper empty sheet with all settings. Each decoded sheet is a copy of it.
+ * @param stop flag to interrupt the search.
+ */
+VLayoutOptimizer::VLayoutOptimizer(const QVector<VLayoutPiece> &details, const VLayoutPaper &paper,
+                                   std::atomic_bool &stop)
+    : m_details(details),
+      m_paper(paper),
+      m_stop(stop)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutOptimizer::SetSeed(quint32 seed)
+{
+    m_random.seed(seed);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutOptimizer::SetManualPriority(bool value)
+{
+    m_manualPriority = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetStart set genome to start the search from. Usually the best genome of the previous run. Ignored if it
+ * doesn't match the details.
+ */
+void VLayoutOptimizer::SetStart(const VLayoutGenome &genome)
+{
+    m_start = genome;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Run search for the best layout.
+ * @param rounds number of rounds. Each round decodes a fixed number of neighbours of the current genome.
+ * @param timeLeft return milliseconds left for the search. A round doesn't start if the slowest one so far wouldn't
+ * fit twice, an interrupted round gives nothing. A search stopped by time is not reproducible.
+ * @return state of the search. NoError means BestResult() holds a layout.
+ */
+LayoutErrors VLayoutOptimizer::Run(int rounds, const std::function<qint64()> &timeLeft)
+{
+    VTraceScope trace("Optimize layout", "layout");
+    trace.AddArg("pieces", m_details.size());
+    trace.AddArg("rounds", rounds);
+
+    m_best = Candidate();
+    m_bestGenome = VLayoutGenome();
+
+    VLayoutGenome current = m_start.IsValid(m_details.size()) ? m_start : InitialGenome();
+    PrepareVariants(current);
+    Candidate currentResult = Evaluate(QVector<VLayoutGenome>{current}).first();
+    if (currentResult.state != LayoutErrors::NoError)
+    {
+        return currentResult.state;
+    }
+
+    m_best = currentResult;
+    m_bestGenome = current;
+
+    qint64 slowestRound = 0;
+    QElapsedTimer roundTimer;
+
+    for (int round = 0; round < rounds; ++round)
+    {
+        if (m_stop.load() || timeLeft() < slowestRound * 2)
+        {
+            break;
+        }
+        roundTimer.start();
+
+        QVector<VLayoutGenome> neighbours;
+        neighbours.reserve(candidatesNumber);
+        for (int i = 0; i < candidatesNumber; ++i)
+        {
+            neighbours.append(Neighbour(current));
+            PrepareVariants(neighbours.last());
+        }
+
+        const QVector<Candidate> results = Evaluate(neighbours);
+        if (m_stop.load())
+        {
+            break; // Interrupted decoding gives incomplete layouts
+        }
+        slowestRound = qMax(slowestRound, roundTimer.elapsed());
+
+        int chosen = -1;
+        for (int i = 0; i < results.size(); ++i)
+        {
+            if (results.at(i).state == LayoutErrors::TerminatedByException)
+            {
+                return results.at(i).state;
+            }
+
+            if (results.at(i).state == LayoutErrors::NoError
+                    && (chosen == -1 || results.at(i).fitness < results.at(chosen).fitness))
+            {
+                chosen = i;
+            }
+        }
+
+        if (chosen == -1)
+        {
+            continue;
+        }
+
+        const qreal progress = rounds > 1 ? static_cast<qreal>(round) / (rounds - 1) : 1;
+        const qreal temperature = startTemperature * qPow(endTemperature / startTemperature, progress);
+        const qreal delta = Difference(results.at(chosen).fitness, currentResult.fitness);
+        const qreal chance = static_cast<qreal>(m_random()) / (static_cast<qreal>(std::mt19937::max()) + 1.0);
+
+        if (delta <= 0 || chance < qExp(-delta / temperature))
+        {
+            current = neighbours.at(chosen);
+            currentResult = results.at(chosen);
+
+            if (currentResult.fitness < m_best.fitness)
+            {
+                m_best = currentResult;
+                m_bestGenome = current;
+            }
+        }
+    }
+
+    trace.AddArg("papers", m_best.fitness.papers);
+    return LayoutErrors::NoError;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutGenome VLayoutOptimizer::BestGenome() const
+{
+    return m_bestGenome;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<VLayoutPaper> VLayoutOptimizer::BestResult() const
+{
+    return m_best.papers;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BestPlacedCount return number of details on sheets of the best layout so far.
+ */
+int VLayoutOptimizer::BestPlacedCount() const
+{
+    int count = 0;
+    for (auto &paper : m_best.papers)
+    {
+        count += paper.Count();
+    }
+    return count;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Orientations return number of orientations the detail can get. A detail that follows grainline will be
+ * turned by the decoder anyway.
+ */
+int VLayoutOptimizer::Orientations(int i) const
+{
+    return FollowsGrainline(i) ? 1 : orientationsNumber;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CanMirror return true if the optimizer may mirror the detail. The decoder aligns grainline by the original
+ * angle, so a detail that follows grainline is left as it is.
+ */
+bool VLayoutOptimizer::CanMirror(int i) const
+{
+    const VLayoutPiece &detail = m_details.at(i);
+    return not detail.IsForbidFlipping() && not detail.IsForceFlipping() && not FollowsGrainline(i);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VLayoutOptimizer::FollowsGrainline(int i) const
+{
+    return m_paper.GetFollowGrainline() && m_details.at(i).IsGrainlineEnabled();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief InitialGenome return genome that repeats greedy strategy: biggest details first.
+ */
+VLayoutGenome VLayoutOptimizer::InitialGenome() const
+{
+    VLayoutGenome genome;
+    genome.order.reserve(m_details.size());
+    for (int i = 0; i < m_details.size(); ++i)
+    {
+        genome.order.append(i);
+    }
+
+    std::stable_sort(genome.order.begin(), genome.order.end(), [this](int a, int b)
+    {
+        return m_details.at(a).Square() > m_details.at(b).Square();
+    });
+
+    genome.orientation.fill(0, m_details.size());
+    genome.mirror.fill(false, m_details.size());
+    return genome;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Neighbour return copy of the genome with one random change: a detail moved to another place in order, two
+ * details swapped, a detail mirrored or turned.
+ */
+VLayoutGenome VLayoutOptimizer::Neighbour(const VLayoutGenome &genome)
+{
+    // Plain modulo instead of std distributions, their results differ between standard libraries.
+    auto RandomIndex = [this](int number)
+    {
+        return static_cast<int>(m_random() % static_cast<quint32>(number));
+    };
+
+    VLayoutGenome neighbour = genome;
+    const int size = neighbour.order.size();
+    const int change = RandomIndex(4);
+    const int i = RandomIndex(size);
+
+    if (change == 1 && size > 1)
+    {
+        const int piece = neighbour.order.takeAt(i);
+        neighbour.order.insert(RandomIndex(size), piece);
+    }
+    else if (change == 2 && CanMirror(i))
+    {
+        neighbour.mirror[i] = not neighbour.mirror.at(i);
+    }
+    else if (change == 3 && Orientations(i) > 1)
+    {
+        const int orientations = Orientations(i);
+        const int turn = 1 + RandomIndex(orientations - 1);
+        neighbour.orientation[i] = static_cast<quint8>((neighbour.orientation.at(i) + turn) % orientations);
+    }
+    else if (size > 1)
+    {
+        const int j = RandomIndex(size);
+        std::swap(neighbour.order[i], neighbour.order[j]);
+    }
+
+    return neighbour;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PrepareVariants turn and mirror details as the genome requires. Must be called before decoding, variants are
+ * shared by decoding threads.
+ */
+void VLayoutOptimizer::PrepareVariants(const VLayoutGenome &genome)
+{
+    for (int i = 0; i < m_details.size(); ++i)
+    {
+        const int key = VariantKey(i, genome.orientation.at(i), genome.mirror.at(i));
+        if (m_variants.contains(key))
+        {
+            continue;
+        }
+
+        Variant variant;
+        variant.detail = m_details.at(i);
+        if (genome.mirror.at(i))
+        {
+            variant.detail.Mirror();
+        }
+
+        if (genome.orientation.at(i) > 0)
+        {
+            variant.detail.Rotate(QPointF(), genome.orientation.at(i) * 360 / orientationsNumber);
+        }
+        variant.detail.PrepareMappedPaths();
+
+        const int rotationNumber = m_paper.LocalRotationNumber(variant.detail);
+        if (rotationNumber > 0)
+        {
+            variant.rotations = VBank::PrepareRotations(variant.detail, rotationNumber);
+        }
+
+        m_variants.insert(key, variant);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Decode arrange details in the order of the genome. Details that don't fit a sheet are tried on the next one.
+ */
+VLayoutOptimizer::Candidate VLayoutOptimizer::Decode(const VLayoutGenome &genome) const
+{
+    Candidate candidate;
+
+    QVector<int> left = genome.order;
+    if (m_manualPriority)
+    {
+        std::stable_sort(left.begin(), left.end(), [this](int a, int b)
+        {
+            return Group(m_details.at(a)) < Group(m_details.at(b));
+        });
+    }
+
+    while (not left.isEmpty())
+    {
+        VLayoutPaper paper = m_paper;
+        paper.SetPaperIndex(static_cast<quint32>(candidate.papers.size()));
+
+        QVector<int> notArranged;
+        for (auto i : qAsConst(left))
+        {
+            if (m_stop.load())
+            {
+                candidate.state = LayoutErrors::ProcessStoped;
+                return candidate;
+            }
+
+            const Variant variant = m_variants.value(VariantKey(i, genome.orientation.at(i), genome.mirror.at(i)));
+            try
+            {
+                if (not paper.ArrangeDetail(variant.detail, m_stop, variant.rotations))
+                {
+                    notArranged.append(i);
+                }
+            }
+            catch (const VExceptionTerminatedPosition &e)
+            {
+                qCritical() << e.ErrorMessage();
+                candidate.state = LayoutErrors::TerminatedByException;
+                return candidate;
+            }
+        }
+
+        if (paper.Count() == 0)
+        {
+            candidate.state = LayoutErrors::EmptyPaperError;
+            return candidate;
+        }
+
+        candidate.papers.append(paper);
+        left = notArranged;
+    }
+
+    candidate.fitness.papers = candidate.papers.size();
+    for (auto &paper : qAsConst(candidate.papers))
+    {
+        const QRectF rect = paper.DetailsBoundingRect();
+        candidate.fitness.length += m_paper.IsOriginPaperPortrait() ? rect.bottom() : rect.right();
+    }
+
+    return candidate;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Evaluate decode genomes in parallel. Results go in the order of genomes.
+ */
+QVector<VLayoutOptimizer::Candidate> VLayoutOptimizer::Evaluate(const QVector<VLayoutGenome> &genomes) const
+{
+    // Own pool, because the decoder itself waits for position jobs in the global one.
+    QThreadPool pool;
+    pool.setMaxThreadCount(qMin(genomes.size(), QThread::idealThreadCount()));
+
+    QVector<QFuture<Candidate>> futures;
+    futures.reserve(genomes.size());
+    for (auto &genome : genomes)
+    {
+        futures.append(QtConcurrent::run(&pool, [this, genome]() {return Decode(genome);}));
+    }
+
+    QVector<Candidate> candidates;
+    candidates.reserve(futures.size());
+    for (auto &future : qAsConst(futures))
+    {
+        while (not future.isFinished())
+        {
+            QCoreApplication::processEvents();
+            QThread::msleep(50);
+        }
+        candidates.append(future.result());
+    }
+
+    return candidates;
+}
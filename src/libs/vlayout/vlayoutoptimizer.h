@@ -0,0 +1,132 @@
+/************************************************************************
+ **
+ **  @file   vlayoutoptimizer.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VLAYOUTOPTIMIZER_H
+#define VLAYOUTOPTIMIZER_H
+
+#include <QHash>
+#include <QVector>
+#include <QtGlobal>
+#include <atomic>
+#include <climits>
+#include <functional>
+#include <random>
+
+#include "vlayoutdef.h"
+#include "vlayoutpaper.h"
+#include "vlayoutpiece.h"
+
+/**
+ * @brief The VLayoutGenome struct describes one solution of the optimizer: the order in which pieces are arranged and
+ * the orientation each piece is given before arranging.
+ */
+struct VLayoutGenome
+{
+    QVector<int>    order{};
+    QVector<quint8> orientation{}; // number of quarter turns
+    QVector<bool>   mirror{};
+
+    bool IsValid(int size) const;
+};
+
+/**
+ * @brief The VLayoutFitness struct estimates a layout. Fewer sheets win, then shorter length used on all sheets.
+ */
+struct VLayoutFitness
+{
+    int   papers{INT_MAX};
+    qreal length{0};
+
+    bool operator<(const VLayoutFitness &other) const;
+};
+
+/**
+ * @brief The VLayoutOptimizer class searches for better order and orientation of pieces by simulated annealing.
+ *
+ * Greedy placement of VLayoutPaper::ArrangeDetail serves as decoder. A genome is decoded by arranging pieces one by one
+ * in its order, a piece that doesn't fit goes to the next sheet. Each round a fixed number of neighbours is decoded in
+ * parallel. Neighbours are produced and chosen on the calling thread, so for the same seed the search follows the same
+ * path regardless of number of cores.
+ *
+ * The result is reproducible only if the number of rounds ends the search. When the time runs out first, the number of
+ * finished rounds and so the layout depend on the speed of the machine.
+ */
+class VLayoutOptimizer
+{
+public:
+    VLayoutOptimizer(const QVector<VLayoutPiece> &details, const VLayoutPaper &paper, std::atomic_bool &stop);
+
+    void SetSeed(quint32 seed);
+    void SetManualPriority(bool value);
+    void SetStart(const VLayoutGenome &genome);
+
+    LayoutErrors Run(int rounds, const std::function<qint64()> &timeLeft);
+
+    VLayoutGenome         BestGenome() const;
+    QVector<VLayoutPaper> BestResult() const;
+    int                   BestPlacedCount() const;
+
+private:
+    Q_DISABLE_COPY(VLayoutOptimizer)
+
+    struct Variant
+    {
+        VLayoutPiece          detail{};
+        QVector<VLayoutPiece> rotations{};
+    };
+
+    struct Candidate
+    {
+        QVector<VLayoutPaper> papers{};
+        VLayoutFitness        fitness{};
+        LayoutErrors          state{LayoutErrors::NoError};
+    };
+
+    QVector<VLayoutPiece> m_details;
+    VLayoutPaper          m_paper;
+    std::atomic_bool     &m_stop;
+    std::mt19937          m_random{};
+    bool                  m_manualPriority{false};
+    VLayoutGenome         m_start{};
+    VLayoutGenome         m_bestGenome{};
+    Candidate             m_best{};
+    QHash<int, Variant>   m_variants{};
+
+    int  Orientations(int i) const;
+    bool CanMirror(int i) const;
+    bool FollowsGrainline(int i) const;
+
+    VLayoutGenome InitialGenome() const;
+    VLayoutGenome Neighbour(const VLayoutGenome &genome);
+
+    void               PrepareVariants(const VLayoutGenome &genome);
+    Candidate          Decode(const VLayoutGenome &genome) const;
+    QVector<Candidate> Evaluate(const QVector<VLayoutGenome> &genomes) const;
+};
+
+#endif // VLAYOUTOPTIMIZER_H
@@ -51,6 +51,24 @@
 #include "../ifc/exception/vexceptionterminatedposition.h"
 #include "../vmisc/compatibility.h"
 
+const quint32 VLayoutPaperData::streamHeader = 0x9701DF20; // CRC-32Q string "VLayoutPaperData"
+const quint16 VLayoutPaperData::classVersion = 1;
+
+// Friend functions
+//---------------------------------------------------------------------------------------------------------------------
+QDataStream &operator<<(QDataStream &dataStream, const VLayoutPaper &paper)
+{
+    dataStream << *paper.d;
+    return dataStream;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QDataStream &operator>>(QDataStream &dataStream, VLayoutPaper &paper)
+{
+    dataStream >> *paper.d;
+    return dataStream;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VLayoutPaper::VLayoutPaper()
     :d(new VLayoutPaperData)
@@ -221,17 +239,39 @@ void VLayoutPaper::SetOriginPaperPortrait(bool portrait)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-bool VLayoutPaper::ArrangeDetail(const VLayoutPiece &detail, std::atomic_bool &stop)
+/**
+ * @brief LocalRotationNumber return number of rotations that will be tried for the detail. 0 if rotation is disabled.
+ */
+int VLayoutPaper::LocalRotationNumber(const VLayoutPiece &detail) const
+{
+    if ((detail.IsForceFlipping() || detail.IsForbidFlipping()) && not d->globalRotate)
+    { // Compensate forbidden flipping by rotating. 180 degree will be enough.
+        return 2;
+    }
+
+    return d->globalRotate ? d->globalRotationNumber : 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ArrangeDetail find the best position for the detail on the sheet.
+ * @param detail detail to arrange.
+ * @param stop flag to interrupt the search.
+ * @param rotations prepared rotations of the detail for LocalRotationNumber(), see VBank::GetRotations.
+ */
+bool VLayoutPaper::ArrangeDetail(const VLayoutPiece &detail, std::atomic_bool &stop,
+                                 const QVector<VLayoutPiece> &rotations)
 {
     if (detail.LayoutEdgesCount() < 3 || detail.DetailEdgesCount() < 3)
     {
         return false;//Not enough edges
     }
 
-    if ((detail.IsForceFlipping() || detail.IsForbidFlipping()) && not d->globalRotate)
-    { // Compensate forbidden flipping by rotating. 180 degree will be enough.
+    const int rotationNumber = LocalRotationNumber(detail);
+    if (rotationNumber > 0)
+    {
         d->localRotate = true;
-        d->localRotationNumber = 2;
+        d->localRotationNumber = rotationNumber;
     }
     else
     { // Return to global values if was changed
@@ -247,11 +287,66 @@ bool VLayoutPaper::ArrangeDetail(const VLayoutPiece &detail, std::atomic_bool &s
     data.followGrainline = d->followGrainline;
     data.positionsCache = d->positionsCache;
     data.isOriginPaperOrientationPortrait = d->originPaperOrientation;
+    if (data.rotate)
+    {
+        data.rotations = rotations;
+    }
 
     const VBestSquare result = VPosition::ArrangeDetail(data, &stop, d->saveLength);
     return SaveResult(result, detail);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PlaceDetail put the detail on the sheet where its matrix says, without searching for a position.
+ *
+ * Used to keep placements of a previous layout. The whole outline of the detail is added to the global contour, so
+ * details arranged later can take positions next to it on every side, including holes left by removed details.
+ * @return false if the detail is out of the sheet or crosses already arranged details.
+ */
+bool VLayoutPaper::PlaceDetail(const VLayoutPiece &detail)
+{
+    if (detail.LayoutEdgesCount() < 3 || detail.DetailEdgesCount() < 3)
+    {
+        return false;//Not enough edges
+    }
+
+    const QRectF sheet(-accuracyPointOnLine, -accuracyPointOnLine, d->globalContour.GetWidth()+accuracyPointOnLine,
+                       d->globalContour.GetHeight()+accuracyPointOnLine);
+    if (not sheet.contains(detail.DetailBoundingRect()))
+    {
+        return false;
+    }
+
+    VCachedPositions positionChache;
+    const QVector<QPointF> layoutPoints = detail.GetLayoutAllowancePoints();
+    positionChache.boundingRect = VLayoutPiece::BoundingRect(layoutPoints);
+    positionChache.layoutAllowancePath = VLayoutPiece::PainterPath(layoutPoints);
+
+    for (auto &position : qAsConst(d->positionsCache))
+    {
+        if (position.boundingRect.intersects(positionChache.boundingRect)
+                && position.layoutAllowancePath.intersects(positionChache.layoutAllowancePath))
+        {
+            return false;
+        }
+    }
+
+    // Append the outline after the last point, the closing edge leads back to the sheet edge
+    d->globalContour.CeateEmptySheetContour();
+    const int lastPoint = d->globalContour.GetContour().size() - 1;
+    const QVector<QPointF> newGContour = d->globalContour.UniteWithContour(detail, lastPoint, 1, BestFrom::Rotation);
+    if (newGContour.isEmpty())
+    {
+        return false;
+    }
+
+    d->details.append(detail);
+    d->globalContour.SetContour(newGContour);
+    d->positionsCache.append(positionChache);
+    return true;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 int VLayoutPaper::Count() const
 {
@@ -44,6 +44,7 @@ class VLayoutPiece;
 class QGraphicsRectItem;
 class QRectF;
 class QGraphicsItem;
+class QDataStream;
 template <typename T> class QList;
 template <typename T> class QVector;
 
@@ -91,7 +92,10 @@ public:
     bool IsOriginPaperPortrait() const;
     void SetOriginPaperPortrait(bool portrait);
 
-    bool ArrangeDetail(const VLayoutPiece &detail, std::atomic_bool &stop);
+    int  LocalRotationNumber(const VLayoutPiece &detail) const;
+    bool ArrangeDetail(const VLayoutPiece &detail, std::atomic_bool &stop,
+                       const QVector<VLayoutPiece> &rotations = QVector<VLayoutPiece>());
+    bool PlaceDetail(const VLayoutPiece &detail);
     int  Count() const;
     Q_REQUIRED_RESULT QGraphicsRectItem *GetPaperItem(bool autoCropLength, bool autoCropWidth, bool textAsPaths) const;
     Q_REQUIRED_RESULT QGraphicsPathItem *GetGlobalContour() const;
@@ -104,6 +108,9 @@ public:
 
     qreal Efficiency() const;
 
+    friend QDataStream& operator<< (QDataStream& dataStream, const VLayoutPaper& paper);
+    friend QDataStream& operator>> (QDataStream& dataStream, VLayoutPaper& paper);
+
 private:
     QSharedDataPointer<VLayoutPaperData> d;
 
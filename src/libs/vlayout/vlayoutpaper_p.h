@@ -32,9 +32,12 @@
 #include <QSharedData>
 #include <QVector>
 #include <QPointF>
+#include <QCoreApplication>
+#include <QDataStream>
 
 #include "vlayoutpiece.h"
 #include "vcontour.h"
+#include "../ifc/exception/vexception.h"
 
 QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Weffc++")
@@ -69,6 +72,9 @@ public:
 
     ~VLayoutPaperData() {}
 
+    friend QDataStream& operator<<(QDataStream& dataStream, const VLayoutPaperData& paper);
+    friend QDataStream& operator>>(QDataStream& dataStream, VLayoutPaperData& paper);
+
     /** @brief details list of arranged details. */
     QVector<VLayoutPiece> details{};
 
@@ -89,8 +95,87 @@ public:
 
 private:
     Q_DISABLE_ASSIGN(VLayoutPaperData)
+
+    static const quint32 streamHeader;
+    static const quint16 classVersion;
 };
 
+// Friend functions
+//---------------------------------------------------------------------------------------------------------------------
+inline QDataStream &operator<<(QDataStream &dataStream, const VLayoutPaperData &paper)
+{
+    dataStream << VLayoutPaperData::streamHeader << VLayoutPaperData::classVersion;
+
+    // Added in classVersion = 1
+    // Global contour is only needed while arranging. Keep its frame, the arranged details are enough to restore
+    // a finished sheet.
+    dataStream << paper.globalContour.GetHeight();
+    dataStream << paper.globalContour.GetWidth();
+    dataStream << paper.globalContour.GetShift();
+    dataStream << paper.details;
+    dataStream << paper.paperIndex;
+    dataStream << paper.layoutWidth;
+    dataStream << paper.globalRotate;
+    dataStream << paper.localRotate;
+    dataStream << paper.globalRotationNumber;
+    dataStream << paper.localRotationNumber;
+    dataStream << paper.saveLength;
+    dataStream << paper.followGrainline;
+    dataStream << paper.originPaperOrientation;
+
+    return dataStream;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline QDataStream &operator>>(QDataStream &dataStream, VLayoutPaperData &paper)
+{
+    quint32 actualStreamHeader = 0;
+    dataStream >> actualStreamHeader;
+
+    if (actualStreamHeader != VLayoutPaperData::streamHeader)
+    {
+        QString message = QCoreApplication::tr("VLayoutPaperData prefix mismatch error: actualStreamHeader = 0x%1 and "
+                                               "streamHeader = 0x%2")
+                .arg(actualStreamHeader, 8, 0x10, QChar('0'))
+                .arg(VLayoutPaperData::streamHeader, 8, 0x10, QChar('0'));
+        throw VException(message);
+    }
+
+    quint16 actualClassVersion = 0;
+    dataStream >> actualClassVersion;
+
+    if (actualClassVersion > VLayoutPaperData::classVersion)
+    {
+        QString message = QCoreApplication::tr("VLayoutPaperData compatibility error: actualClassVersion = %1 and "
+                                               "classVersion = %2")
+                .arg(actualClassVersion).arg(VLayoutPaperData::classVersion);
+        throw VException(message);
+    }
+
+    int height = 0;
+    int width = 0;
+    qreal shift = 0;
+    dataStream >> height;
+    dataStream >> width;
+    dataStream >> shift;
+    dataStream >> paper.details;
+    dataStream >> paper.paperIndex;
+    dataStream >> paper.layoutWidth;
+    dataStream >> paper.globalRotate;
+    dataStream >> paper.localRotate;
+    dataStream >> paper.globalRotationNumber;
+    dataStream >> paper.localRotationNumber;
+    dataStream >> paper.saveLength;
+    dataStream >> paper.followGrainline;
+    dataStream >> paper.originPaperOrientation;
+
+    paper.globalContour = VContour(height, width, paper.layoutWidth);
+    paper.globalContour.SetShift(shift);
+    paper.positionsCache.clear();
+
+    return dataStream;
+}
+
 QT_WARNING_POP
 
 #endif // VLAYOUTPAPER_P_H
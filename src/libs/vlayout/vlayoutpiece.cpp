@@ -29,6 +29,8 @@
 #include "vlayoutpiece.h"
 
 #include <QBrush>
+#include <QCryptographicHash>
+#include <QDataStream>
 #include <QFlags>
 #include <QFont>
 #include <QFontMetrics>
@@ -44,12 +46,14 @@
 #include <QTransform>
 #include <Qt>
 #include <QtDebug>
+#include <algorithm>
 
 #include "../vpatterndb/floatItemData/vpatternlabeldata.h"
 #include "../vpatterndb/floatItemData/vpiecelabeldata.h"
 #include "../vmisc/vmath.h"
 #include "../vmisc/vabstractapplication.h"
 #include "../vmisc/compatibility.h"
+#include "../vmisc/vtrace.h"
 #include "../vpatterndb/vcontainer.h"
 #include "../vpatterndb/calculator.h"
 #include "../vpatterndb/vpassmark.h"
@@ -439,6 +443,13 @@ VLayoutPiece::~VLayoutPiece()
 //---------------------------------------------------------------------------------------------------------------------
 VLayoutPiece VLayoutPiece::Create(const VPiece &piece, vidtype id, const VContainer *pattern)
 {
+    VTraceScope trace("Create layout piece", "layout");
+    if (VTrace::IsEnabled())
+    {
+        trace.AddArg("id", static_cast<qint64>(id));
+        trace.AddArg("name", piece.GetName());
+    }
+
     QFuture<QVector<QPointF> > futureSeamAllowance = QtConcurrent::run(piece, &VPiece::SeamAllowancePoints, pattern);
     QFuture<bool> futureSeamAllowanceValid = QtConcurrent::run(piece, &VPiece::IsSeamAllowanceValid, pattern);
     QFuture<QVector<QPointF> > futureMainPath = QtConcurrent::run(piece, &VPiece::MainPathPoints, pattern);
@@ -514,13 +525,7 @@ QVector<T> VLayoutPiece::Map(QVector<T> points) const
 
     if (d->mirror)
     {
-        QList<T> list = ConvertToList(points);
-
-        for (int k=0, s=list.size(), max=(s/2); k<max; k++)
-        {
-            SwapItemsAt(list, k, s-(1+k));
-        }
-        points = ConvertToVector(list);
+        std::reverse(points.begin(), points.end());
     }
     return points;
 }
@@ -554,7 +559,7 @@ QVector<VLayoutPassmark> VLayoutPiece::Map<VLayoutPassmark>(QVector<VLayoutPassm
 // cppcheck-suppress unusedFunction
 QVector<QPointF> VLayoutPiece::GetMappedContourPoints() const
 {
-    return Map(d->contour);
+    return MappedPath(d->m_mappedContour, d->contour).points;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -567,6 +572,7 @@ QVector<QPointF> VLayoutPiece::GetContourPoints() const
 void VLayoutPiece::SetCountourPoints(const QVector<QPointF> &points, bool hideMainPath)
 {
     d->contour = RemoveDublicates(points, false);
+    InvalidateMappedPaths();
     SetHideMainPath(hideMainPath);
 }
 
@@ -574,7 +580,7 @@ void VLayoutPiece::SetCountourPoints(const QVector<QPointF> &points, bool hideMa
 // cppcheck-suppress unusedFunction
 QVector<QPointF> VLayoutPiece::GetMappedSeamAllowancePoints() const
 {
-    return Map(d->seamAllowance);
+    return MappedPath(d->m_mappedSeamAllowance, d->seamAllowance).points;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -600,13 +606,14 @@ void VLayoutPiece::SetSeamAllowancePoints(const QVector<QPointF> &points, bool s
             qWarning()<<"Seam allowance is empty.";
             SetSeamAllowance(false);
         }
+        InvalidateMappedPaths();
     }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QVector<QPointF> VLayoutPiece::GetLayoutAllowancePoints() const
 {
-    return Map(d->layoutAllowance);
+    return MappedLayoutPath().points;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -784,6 +791,7 @@ QTransform VLayoutPiece::GetMatrix() const
 void VLayoutPiece::SetMatrix(const QTransform &matrix)
 {
     d->matrix = matrix;
+    InvalidateMappedPaths();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -828,6 +836,7 @@ void VLayoutPiece::Translate(qreal dx, qreal dy)
     QTransform m;
     m.translate(dx, dy);
     d->matrix *= m;
+    TranslateMappedPaths(dx, dy);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -836,6 +845,7 @@ void VLayoutPiece::Scale(qreal sx, qreal sy)
     QTransform m;
     m.scale(sx, sy);
     d->matrix *= m;
+    InvalidateMappedPaths();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -846,6 +856,7 @@ void VLayoutPiece::Rotate(const QPointF &originPoint, qreal degrees)
     m.rotate(-degrees);
     m.translate(-originPoint.x(), -originPoint.y());
     d->matrix *= m;
+    InvalidateMappedPaths();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -879,6 +890,7 @@ void VLayoutPiece::Mirror(const QLineF &edge)
     d->matrix *= m;
 
     d->mirror = !d->mirror;
+    InvalidateMappedPaths();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -888,6 +900,7 @@ void VLayoutPiece::Mirror()
     m.scale(-1, 1);
     d->matrix *= m;
     d->mirror = !d->mirror;
+    InvalidateMappedPaths();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -906,26 +919,25 @@ int VLayoutPiece::LayoutEdgesCount() const
 //---------------------------------------------------------------------------------------------------------------------
 QLineF VLayoutPiece::LayoutEdge(int i) const
 {
-    return Edge(d->layoutAllowance, i);
+    return Edge(MappedLayoutPath().points, i);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int VLayoutPiece::LayoutEdgeByPoint(const QPointF &p1) const
 {
-    return EdgeByPoint(d->layoutAllowance, p1);
+    return EdgeByPoint(MappedLayoutPath().points, p1);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QRectF VLayoutPiece::DetailBoundingRect() const
 {
-    return IsSeamAllowance() && not IsSeamAllowanceBuiltIn() ? BoundingRect(GetMappedSeamAllowancePoints()) :
-                                                               BoundingRect(GetMappedContourPoints());
+    return MappedDetailPath().boundingRect;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QRectF VLayoutPiece::LayoutBoundingRect() const
 {
-    return BoundingRect(GetLayoutAllowancePoints());
+    return MappedLayoutPath().boundingRect;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -961,6 +973,24 @@ qint64 VLayoutPiece::Square() const
     return d->m_square;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GeometryHash return hash of everything that defines the shape of the piece for nesting. Position on a sheet
+ * is not included, so a piece keeps its hash after arranging.
+ */
+QByteArray VLayoutPiece::GeometryHash() const
+{
+    QByteArray data;
+    QDataStream dataStream(&data, QIODevice::WriteOnly);
+    dataStream.setVersion(QDataStream::Qt_5_4);
+
+    dataStream << d->contour << d->seamAllowance << IsSeamAllowance() << IsSeamAllowanceBuiltIn();
+    dataStream << d->layoutWidth << IsForbidFlipping() << IsForceFlipping();
+    dataStream << d->grainlineEnabled << d->grainlineAngle;
+
+    return QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutPiece::SetLayoutAllowancePoints()
 {
@@ -994,6 +1024,24 @@ void VLayoutPiece::SetLayoutAllowancePoints()
     {
         d->layoutAllowance.clear();
     }
+
+    InvalidateMappedPaths();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SimplifyLayoutAllowance reduce number of layout allowance edges. The new contour encloses the old one.
+ * @param tolerance max deviation from original contour in pixels.
+ */
+void VLayoutPiece::SimplifyLayoutAllowance(qreal tolerance)
+{
+    if (tolerance <= 0 || d->layoutAllowance.size() <= 4)
+    {
+        return;
+    }
+
+    d->layoutAllowance = SimplifyOutward(d->layoutAllowance, tolerance);
+    InvalidateMappedPaths();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1164,23 +1212,12 @@ bool VLayoutPiece::IsLayoutAllowanceValid() const
 //---------------------------------------------------------------------------------------------------------------------
 qreal VLayoutPiece::BiggestEdge() const
 {
-    qreal edge = 0;
-
     if (LayoutEdgesCount() < 1)
     {
-        return edge;
-    }
-
-    for (int i = 1; i < LayoutEdgesCount(); ++i)
-    {
-        const qreal length = LayoutEdge(i).length();
-        if (length > edge)
-        {
-            edge = length;
-        }
+        return 0;
     }
 
-    return edge;
+    return MappedLayoutPath().biggestEdge;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1373,10 +1410,11 @@ bool VLayoutPiece::IsMirror() const
 void VLayoutPiece::SetMirror(bool value)
 {
     d->mirror = value;
+    InvalidateMappedPaths();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-QLineF VLayoutPiece::Edge(const QVector<QPointF> &path, int i) const
+QLineF VLayoutPiece::Edge(const QVector<QPointF> &mappedPath, int i)
 {
     if (i < 1)
     { // Doesn't exist such edge
@@ -1384,48 +1422,39 @@ QLineF VLayoutPiece::Edge(const QVector<QPointF> &path, int i) const
     }
 
     int i1, i2;
-    if (i < path.count())
+    if (i < mappedPath.count())
     {
         i1 = i-1;
         i2 = i;
     }
     else
     {
-        i1 = path.count()-1;
+        i1 = mappedPath.count()-1;
         i2 = 0;
     }
 
-    if (d->mirror)
-    {
-        QVector<QPointF> newPath = Map(path);
-        return QLineF(newPath.at(i1), newPath.at(i2));
-    }
-    else
-    {
-        return QLineF(d->matrix.map(path.at(i1)), d->matrix.map(path.at(i2)));
-    }
+    return QLineF(mappedPath.at(i1), mappedPath.at(i2));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-int VLayoutPiece::EdgeByPoint(const QVector<QPointF> &path, const QPointF &p1) const
+int VLayoutPiece::EdgeByPoint(const QVector<QPointF> &mappedPath, const QPointF &p1)
 {
     if (p1.isNull())
     {
         return 0;
     }
 
-    if (path.count() < 3)
+    if (mappedPath.count() < 3)
     {
         return 0;
     }
 
-    const QVector<QPointF> points = Map(path);
-    for (int i=0; i < points.size(); i++)
+    for (int i=0; i < mappedPath.size(); i++)
     {
-        if (VFuzzyComparePoints(points.at(i), p1))
+        if (VFuzzyComparePoints(mappedPath.at(i), p1))
         {
             int pos = i+1;
-            if (pos > points.size())
+            if (pos > mappedPath.size())
             {
                 pos = 1;
             }
@@ -1434,3 +1463,87 @@ int VLayoutPiece::EdgeByPoint(const QVector<QPointF> &path, const QPointF &p1) c
     }
     return 0; // Did not find edge
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MappedPath return path mapped by the piece matrix. Mapping happens once per geometry version.
+ */
+VLayoutPieceMappedPath VLayoutPiece::MappedPath(VLayoutPieceMappedPath &cache, const QVector<QPointF> &path) const
+{
+    QMutexLocker locker(&d->m_cacheMutex);
+
+    if (cache.version != d->m_geometryVersion)
+    {
+        cache.points = Map(path);
+        cache.boundingRect = cache.points.isEmpty() ? QRectF() : BoundingRect(cache.points);
+
+        cache.biggestEdge = 0;
+        for (int i = 1; i < cache.points.size(); ++i)
+        {
+            cache.biggestEdge = qMax(cache.biggestEdge, QLineF(cache.points.at(i-1), cache.points.at(i)).length());
+        }
+
+        cache.version = d->m_geometryVersion;
+    }
+
+    return cache;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutPieceMappedPath VLayoutPiece::MappedDetailPath() const
+{
+    return IsSeamAllowance() && not IsSeamAllowanceBuiltIn() ? MappedPath(d->m_mappedSeamAllowance, d->seamAllowance)
+                                                             : MappedPath(d->m_mappedContour, d->contour);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutPieceMappedPath VLayoutPiece::MappedLayoutPath() const
+{
+    return MappedPath(d->m_mappedLayoutAllowance, d->layoutAllowance);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPiece::InvalidateMappedPaths()
+{
+    ++d->m_geometryVersion;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief TranslateMappedPaths move already mapped paths instead of mapping them again after translation.
+ */
+void VLayoutPiece::TranslateMappedPaths(qreal dx, qreal dy)
+{
+    const quint32 oldVersion = d->m_geometryVersion;
+    InvalidateMappedPaths();
+
+    auto TranslatePath = [this, oldVersion, dx, dy](VLayoutPieceMappedPath &cache)
+    {
+        if (cache.version != oldVersion)
+        {
+            return;
+        }
+
+        for (auto &p : cache.points)
+        {
+            p += QPointF(dx, dy);
+        }
+        cache.boundingRect.translate(dx, dy);
+        cache.version = d->m_geometryVersion;
+    };
+
+    TranslatePath(d->m_mappedContour);
+    TranslatePath(d->m_mappedSeamAllowance);
+    TranslatePath(d->m_mappedLayoutAllowance);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PrepareMappedPaths map geometry in advance. Copies made after this call share mapped paths.
+ */
+void VLayoutPiece::PrepareMappedPaths() const
+{
+    MappedPath(d->m_mappedContour, d->contour);
+    MappedPath(d->m_mappedSeamAllowance, d->seamAllowance);
+    MappedLayoutPath();
+}
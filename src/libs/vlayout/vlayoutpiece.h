@@ -47,6 +47,7 @@
 #include "../vpatterndb/floatItemData/floatitemdef.h"
 
 class VLayoutPieceData;
+struct VLayoutPieceMappedPath;
 class VLayoutPiecePath;
 class QGraphicsItem;
 class QGraphicsPathItem;
@@ -84,6 +85,7 @@ public:
 
     QVector<QPointF> GetLayoutAllowancePoints() const;
     void SetLayoutAllowancePoints();
+    void SimplifyLayoutAllowance(qreal tolerance);
 
     QVector<VLayoutPassmark> GetPassmarks() const;
     void SetPassmarks(const QVector<VLayoutPassmark> &passmarks);
@@ -146,6 +148,8 @@ public:
     bool isNull() const;
     qint64 Square() const;
 
+    QByteArray GeometryHash() const;
+
     QPainterPath ContourPath() const;
     QPainterPath LayoutAllowancePath() const;
 
@@ -157,6 +161,8 @@ public:
 
     qreal BiggestEdge() const;
 
+    void PrepareMappedPaths() const;
+
     friend QDataStream& operator<< (QDataStream& dataStream, const VLayoutPiece& piece);
     friend QDataStream& operator>> (QDataStream& dataStream, VLayoutPiece& piece);
 
@@ -175,8 +181,14 @@ private:
     template <class T>
     QVector<T> Map(QVector<T> points) const;
 
-    QLineF Edge(const QVector<QPointF> &path, int i) const;
-    int    EdgeByPoint(const QVector<QPointF> &path, const QPointF &p1) const;
+    VLayoutPieceMappedPath MappedPath(VLayoutPieceMappedPath &cache, const QVector<QPointF> &path) const;
+    VLayoutPieceMappedPath MappedDetailPath() const;
+    VLayoutPieceMappedPath MappedLayoutPath() const;
+    void InvalidateMappedPaths();
+    void TranslateMappedPaths(qreal dx, qreal dy);
+
+    static QLineF Edge(const QVector<QPointF> &mappedPath, int i);
+    static int    EdgeByPoint(const QVector<QPointF> &mappedPath, const QPointF &p1);
 };
 
 Q_DECLARE_TYPEINFO(VLayoutPiece, Q_MOVABLE_TYPE);
@@ -31,8 +31,10 @@
 
 #include <QSharedData>
 #include <QPointF>
+#include <QRectF>
 #include <QVector>
 #include <QTransform>
+#include <QMutex>
 
 #include "../vpatterndb/floatItemData/vpiecelabeldata.h"
 #include "../vpatterndb/floatItemData/vpatternlabeldata.h"
@@ -50,6 +52,19 @@ QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Weffc++")
 QT_WARNING_DISABLE_GCC("-Wnon-virtual-dtor")
 
+/**
+ * @brief The VLayoutPieceMappedPath struct keeps a path mapped by the piece matrix together with its bounding rect.
+ *
+ * The path is valid while version equals VLayoutPieceData::m_geometryVersion.
+ */
+struct VLayoutPieceMappedPath
+{
+    quint32          version{0};
+    QVector<QPointF> points{};
+    QRectF           boundingRect{};
+    qreal            biggestEdge{0};
+};
+
 class VLayoutPieceData : public QSharedData
 {
 public:
@@ -77,8 +92,14 @@ public:
           m_placeLabels(detail.m_placeLabels),
           m_square(detail.m_square),
           m_quantity(detail.m_quantity),
-          m_id(detail.m_id)
-    {}
+          m_id(detail.m_id),
+          m_geometryVersion(detail.m_geometryVersion)
+    {
+        QMutexLocker locker(&detail.m_cacheMutex);
+        m_mappedContour = detail.m_mappedContour;
+        m_mappedSeamAllowance = detail.m_mappedSeamAllowance;
+        m_mappedLayoutAllowance = detail.m_mappedLayoutAllowance;
+    }
 
     ~VLayoutPieceData() Q_DECL_EQ_DEFAULT;
 
@@ -137,6 +158,16 @@ public:
     /** @brief m_id keep id of original piece. */
     vidtype                   m_id;
 
+    /** @brief m_geometryVersion changes each time points, matrix or mirror state change. Invalidates mapped paths. */
+    quint32 m_geometryVersion{1};
+
+    /** @brief m_cacheMutex guards lazy mapping. Copies of a piece share data until detach, also between threads. */
+    mutable QMutex m_cacheMutex{};
+
+    mutable VLayoutPieceMappedPath m_mappedContour{};
+    mutable VLayoutPieceMappedPath m_mappedSeamAllowance{};
+    mutable VLayoutPieceMappedPath m_mappedLayoutAllowance{};
+
 private:
     Q_DISABLE_ASSIGN(VLayoutPieceData)
 
@@ -224,6 +255,8 @@ inline QDataStream &operator>>(QDataStream &dataStream, VLayoutPieceData &piece)
         dataStream >> piece.m_id;
     }
 
+    ++piece.m_geometryVersion;
+
     return dataStream;
 }
 
@@ -0,0 +1,112 @@
+/************************************************************************
+ **
+ **  @file   vlayoutprogresslog.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "vlayoutprogresslog.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QJsonDocument>
+#include <QtDebug>
+
+#include <cstdio>
+
+std::atomic_bool VLayoutProgressLog::standardOutput{false};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief VLayoutProgressLog open the log.
+ * @param path path to file, "-" means standard output. The file is truncated.
+ * @param timer nesting timer, elapsed time of events is taken from it.
+ */
+VLayoutProgressLog::VLayoutProgressLog(const QString &path, const QElapsedTimer &timer)
+    : m_timer(timer)
+{
+    if (path.isEmpty())
+    {
+        return;
+    }
+
+    bool opened = false;
+    if (path == QLatin1String("-"))
+    {
+        opened = m_file.open(stdout, QIODevice::WriteOnly | QIODevice::Text);
+        m_standardOutput = opened;
+        standardOutput.store(opened);
+    }
+    else
+    {
+        m_file.setFileName(path);
+        opened = m_file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text);
+    }
+
+    if (not opened)
+    {
+        qWarning() << QCoreApplication::translate("VLayoutProgressLog", "Can't open progress log %1. Error: %2.")
+                      .arg(path, m_file.errorString());
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutProgressLog::~VLayoutProgressLog()
+{
+    if (m_standardOutput)
+    {
+        standardOutput.store(false);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VLayoutProgressLog::IsEnabled() const
+{
+    return m_file.isOpen();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutProgressLog::Event(const QString &type, QJsonObject data)
+{
+    if (not IsEnabled())
+    {
+        return;
+    }
+
+    data[QLatin1String("event")] = type;
+    data[QLatin1String("elapsedMs")] = static_cast<double>(m_timer.isValid() ? m_timer.elapsed() : 0);
+
+    m_file.write(QJsonDocument(data).toJson(QJsonDocument::Compact));
+    m_file.write("\n");
+    m_file.flush();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsStandardOutput return true if standard output is taken by a progress log.
+ */
+bool VLayoutProgressLog::IsStandardOutput()
+{
+    return standardOutput.load();
+}
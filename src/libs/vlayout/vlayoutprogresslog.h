@@ -0,0 +1,71 @@
+/************************************************************************
+ **
+ **  @file   vlayoutprogresslog.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VLAYOUTPROGRESSLOG_H
+#define VLAYOUTPROGRESSLOG_H
+
+#include <QFile>
+#include <QJsonObject>
+#include <QString>
+#include <QtGlobal>
+#include <atomic>
+
+class QElapsedTimer;
+
+/**
+ * @brief The VLayoutProgressLog class reports progress of nesting as JSON Lines, one event object per line.
+ *
+ * Each event has fields "event" and "elapsedMs". A line is flushed as soon as it is written, so a job scheduler can
+ * follow the file or standard output while nesting goes on. Empty path disables the log.
+ *
+ * While a log writes to standard output, IsStandardOutput() is true. Message handlers must send all messages to
+ * standard error at this time, otherwise they break the stream of events.
+ */
+class VLayoutProgressLog
+{
+public:
+    VLayoutProgressLog(const QString &path, const QElapsedTimer &timer);
+    ~VLayoutProgressLog();
+
+    bool IsEnabled() const;
+
+    static bool IsStandardOutput();
+
+    void Event(const QString &type, QJsonObject data = QJsonObject());
+
+private:
+    Q_DISABLE_COPY(VLayoutProgressLog)
+
+    const QElapsedTimer &m_timer;
+    QFile                m_file{};
+    bool                 m_standardOutput{false};
+
+    static std::atomic_bool standardOutput;
+};
+
+#endif // VLAYOUTPROGRESSLOG_H
@@ -52,6 +52,7 @@
 
 #include "../vmisc/def.h"
 #include "../vmisc/vmath.h"
+#include "../vmisc/vtrace.h"
 #include "../ifc/exception/vexception.h"
 #include "../vpatterndb/floatItemData/floatitemdef.h"
 
@@ -87,6 +88,14 @@ void VPosition::run()
         return;
     }
 
+    VTraceScope trace("Find position", "layout");
+    if (VTrace::IsEnabled())
+    {
+        trace.AddArg("piece", m_data.detail.GetName());
+        trace.AddArg("rotation", static_cast<qint64>(m_data.rotationNumber));
+    }
+    const auto reportTests = qScopeGuard([this, &trace]() {trace.AddArg("candidates", m_tests);});
+
     if (stop->load())
     {
         return;
@@ -131,6 +140,13 @@ VBestSquare VPosition::getBestResult() const
 //---------------------------------------------------------------------------------------------------------------------
 VBestSquare VPosition::ArrangeDetail(const VPositionData &data, std::atomic_bool *stop, bool saveLength)
 {
+    VTraceScope trace("Arrange piece", "layout");
+    if (VTrace::IsEnabled())
+    {
+        trace.AddArg("piece", data.detail.GetName());
+        trace.AddArg("edges", data.gContour.GlobalEdgesCount());
+    }
+
     VBestSquare bestResult(data.gContour.GetSize(), saveLength, data.isOriginPaperOrientationPortrait);
 
     if (stop->load())
@@ -173,30 +189,44 @@ VBestSquare VPosition::ArrangeDetail(const VPositionData &data, std::atomic_bool
 
     watcher.setFuture(QtConcurrent::mapped(jobs, Nest));
 
-    while(not watcher.isStarted())
+    if (QCoreApplication::instance() == nullptr || QThread::currentThread() != QCoreApplication::instance()->thread())
     {
-        QCoreApplication::processEvents();
-        QThread::msleep(250);
-    }
+        // Called by the layout optimizer from a worker thread. There are no events to process, jobs check the stop
+        // flag on their own.
+        watcher.waitForFinished();
 
-    // Wait for done
-    do
-    {
-        QCoreApplication::processEvents();
-        QThread::msleep(250);
+        if (stop->load())
+        {
+            return bestResult;
+        }
     }
-    while(watcher.isRunning() && not stop->load());
-
-    if (stop->load())
+    else
     {
+        while(not watcher.isStarted())
+        {
+            QCoreApplication::processEvents();
+            QThread::msleep(250);
+        }
+
+        // Wait for done
         do
         {
             QCoreApplication::processEvents();
             QThread::msleep(250);
         }
-        while(watcher.isRunning());
+        while(watcher.isRunning() && not stop->load());
 
-        return bestResult;
+        if (stop->load())
+        {
+            do
+            {
+                QCoreApplication::processEvents();
+                QThread::msleep(250);
+            }
+            while(watcher.isRunning());
+
+            return bestResult;
+        }
     }
 
     QList<VBestSquare> results = watcher.future().results();
@@ -310,7 +340,6 @@ bool VPosition::CheckCombineEdges(VLayoutPiece &detail, int j, int &dEdge)
 bool VPosition::CheckRotationEdges(VLayoutPiece &detail, int j, int dEdge, qreal angle) const
 {
     const QLineF globalEdge = m_data.gContour.GlobalEdge(j);
-    bool flagSquare = false;
 
     if (detail.IsForceFlipping())
     {
@@ -319,26 +348,19 @@ bool VPosition::CheckRotationEdges(VLayoutPiece &detail, int j, int dEdge, qreal
 
     RotateEdges(detail, globalEdge, dEdge, angle);
 
+    return CheckPosition(detail);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VPosition::CheckPosition(const VLayoutPiece &detail) const
+{
     CrossingType type = CrossingType::Intersection;
     if (SheetContains(detail.DetailBoundingRect()))
     {
         type = Crossing(detail);
     }
 
-    switch (type)
-    {
-        case CrossingType::EdgeError:
-            return false;
-        case CrossingType::Intersection:
-            flagSquare = false;
-            break;
-        case CrossingType::NoIntersection:
-            flagSquare = true;
-            break;
-        default:
-            break;
-    }
-    return flagSquare;
+    return type == CrossingType::NoIntersection;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -353,21 +375,43 @@ void VPosition::RotateOnAngle(qreal angle)
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RotateVariant same as RotateOnAngle, but uses prepared rotated copy of the detail. The copy already has
+ * mapped geometry, so only translation to the global edge left.
+ * @param variant index of rotation in the list of prepared rotations.
+ */
+void VPosition::RotateVariant(int variant)
+{
+    VLayoutPiece workDetail = m_data.rotations.at(variant);
+
+    const QLineF globalEdge = m_data.gContour.GlobalEdge(m_data.j);
+    const QLineF detailEdge = workDetail.LayoutEdge(m_data.i);
+    workDetail.Translate(globalEdge.x2() - detailEdge.x2(), globalEdge.y2() - detailEdge.y2());
+
+    if (CheckPosition(workDetail))
+    {
+        SaveCandidate(m_bestResult, workDetail, m_data.j, m_data.i, BestFrom::Rotation);
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VPosition::CrossingType VPosition::Crossing(const VLayoutPiece &detail) const
 {
+    ++m_tests;
+
     if (m_data.positionsCache.isEmpty())
     {
         return CrossingType::NoIntersection;
     }
 
     const QVector<QPointF> layoutPoints = detail.GetLayoutAllowancePoints();
-    const QRectF layoutBoundingRect = VLayoutPiece::BoundingRect(layoutPoints);
+    const QRectF layoutBoundingRect = detail.LayoutBoundingRect();
     const QPainterPath layoutAllowancePath = VLayoutPiece::PainterPath(layoutPoints);
 
     const QVector<QPointF> contourPoints = detail.IsSeamAllowance() && not detail.IsSeamAllowanceBuiltIn() ?
                 detail.GetMappedSeamAllowancePoints() : detail.GetMappedContourPoints();
-    const QRectF detailBoundingRect = VLayoutPiece::BoundingRect(contourPoints);
+    const QRectF detailBoundingRect = detail.DetailBoundingRect();
     const QPainterPath contourPath = VLayoutPiece::PainterPath(contourPoints);
 
     for(auto &position : m_data.positionsCache)
@@ -432,6 +476,7 @@ void VPosition::Rotate(int number)
     {
         startAngle = step;
     }
+    const bool usePrepared = not m_data.detail.IsForceFlipping() && not m_data.rotations.isEmpty();
     for (qreal angle = startAngle; angle < 360; angle = angle+step)
     {
         if (stop->load())
@@ -439,7 +484,15 @@ void VPosition::Rotate(int number)
             return;
         }
 
-        RotateOnAngle(angle);
+        const int variant = qRound(angle/step);
+        if (usePrepared && variant < m_data.rotations.size())
+        {
+            RotateVariant(variant);
+        }
+        else
+        {
+            RotateOnAngle(angle);
+        }
     }
 }
 
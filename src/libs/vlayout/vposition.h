@@ -51,6 +51,8 @@ struct VPositionData
     bool followGrainline{false};
     QVector<VCachedPositions> positionsCache{};
     bool isOriginPaperOrientationPortrait{true};
+    /** @brief rotations detail rotated around the origin by k*(360/rotationNumber) degrees. Empty if not prepared. */
+    QVector<VLayoutPiece> rotations{};
 };
 
 QT_WARNING_PUSH
@@ -81,6 +83,8 @@ private:
      * @brief angle_between keep angle between global edge and detail edge. Need for optimization rotation.
      */
     qreal angle_between{0};
+    /** @brief m_tests number of checked candidate positions, reported to trace. */
+    mutable qint64 m_tests{0};
 
     enum class CrossingType : qint8
     {
@@ -102,6 +106,9 @@ private:
     bool CheckRotationEdges(VLayoutPiece &detail, int j, int dEdge, qreal angle) const;
 
     void RotateOnAngle(qreal angle);
+    void RotateVariant(int variant);
+
+    bool CheckPosition(const VLayoutPiece &detail) const;
 
     CrossingType Crossing(const VLayoutPiece &detail) const;
     bool         SheetContains(const QRectF &rect) const;
@@ -137,6 +137,13 @@ const QString LONG_OPTION_LANDSCAPE_ORIENTATION = QStringLiteral("landscapeOrien
 
 const QString LONG_OPTION_NEST_QUANTITY = QStringLiteral("nestQuantity");
 const QString LONG_OPTION_PREFER_ONE_SHEET_SOLUTION = QStringLiteral("preferOneSheetSolution");
+const QString LONG_OPTION_NEST_OPTIMIZER = QStringLiteral("nestOptimizer");
+const QString LONG_OPTION_NEST_SEED = QStringLiteral("nestSeed");
+const QString LONG_OPTION_NO_LAYOUT_CACHE = QStringLiteral("noLayoutCache");
+const QString LONG_OPTION_NEST_CHECKPOINT = QStringLiteral("nestCheckpoint");
+const QString LONG_OPTION_NEST_PROGRESS = QStringLiteral("nestProgress");
+
+const QString LONG_OPTION_TRACE = QStringLiteral("trace");
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
@@ -195,6 +202,12 @@ QStringList AllKeys()
         LONG_OPTION_MANUAL_PRIORITY,
         LONG_OPTION_LANDSCAPE_ORIENTATION,
         LONG_OPTION_NEST_QUANTITY,
-        LONG_OPTION_PREFER_ONE_SHEET_SOLUTION
+        LONG_OPTION_PREFER_ONE_SHEET_SOLUTION,
+        LONG_OPTION_NEST_OPTIMIZER,
+        LONG_OPTION_NEST_SEED,
+        LONG_OPTION_NO_LAYOUT_CACHE,
+        LONG_OPTION_NEST_CHECKPOINT,
+        LONG_OPTION_NEST_PROGRESS,
+        LONG_OPTION_TRACE
     };
 }
@@ -131,6 +131,13 @@ extern const QString LONG_OPTION_MANUAL_PRIORITY;
 extern const QString LONG_OPTION_LANDSCAPE_ORIENTATION;
 extern const QString LONG_OPTION_NEST_QUANTITY;
 extern const QString LONG_OPTION_PREFER_ONE_SHEET_SOLUTION;
+extern const QString LONG_OPTION_NEST_OPTIMIZER;
+extern const QString LONG_OPTION_NEST_SEED;
+extern const QString LONG_OPTION_NO_LAYOUT_CACHE;
+extern const QString LONG_OPTION_NEST_CHECKPOINT;
+extern const QString LONG_OPTION_NEST_PROGRESS;
+
+extern const QString LONG_OPTION_TRACE;
 
 QStringList AllKeys();
 
@@ -68,6 +68,7 @@ Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingConfigurationFreeCurveMode, (QLa
 Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingConfigurationDoubleClickZoomFitBestCurrentPP, (QLatin1String("configuration/doubleClickZoomFitBestCurrentPP")))
 
 Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingPatternUndo, (QLatin1String("pattern/undo")))
+Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingPatternUndoMemory, (QLatin1String("pattern/undoMemory")))
 Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingPatternForbidFlipping, (QLatin1String("pattern/forbidFlipping")))
 Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingPatternForceFlipping, (QLatin1String("pattern/forceFlipping")))
 Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingPatternHideMainPath, (QLatin1String("pattern/hideMainPath")))
@@ -110,6 +111,7 @@ Q_GLOBAL_STATIC(QString, localeCached)
 qreal lineWidthCached = 0;
 int labelFontSizeCached = 0;
 int pieceShowMainPath = -1;
+int hideLabelsCached = -1;
 
 //---------------------------------------------------------------------------------------------------------------------
 QStringList ClearFormats(const QStringList &predefinedFormats, QStringList formats)
@@ -604,6 +606,30 @@ void VCommonSettings::SetUndoCount(const int &value)
     setValue(*settingPatternUndo, value);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GetUndoMemory return how many megabytes undo history may keep in memory before it is compressed and moved to
+ * a temporary file.
+ */
+int VCommonSettings::GetUndoMemory() const
+{
+    bool ok = false;
+    const int val = value(*settingPatternUndoMemory, GetDefUndoMemory()).toInt(&ok);
+    return ok && val > 0 ? val : GetDefUndoMemory();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VCommonSettings::SetUndoMemory(int value)
+{
+    setValue(*settingPatternUndoMemory, value);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VCommonSettings::GetDefUndoMemory()
+{
+    return 32;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QStringList VCommonSettings::GetRecentFileList() const
 {
@@ -1006,12 +1032,17 @@ int VCommonSettings::GetDefLabelFontSize()
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::GetHideLabels() const
 {
-    return value(*settingPatternHideLabels, false).toBool();
+    if (hideLabelsCached < 0)
+    {
+        hideLabelsCached = value(*settingPatternHideLabels, false).toBool();
+    }
+    return hideLabelsCached;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetHideLabels(bool value)
 {
+    hideLabelsCached = value;
     setValue(*settingPatternHideLabels, value);
 }
 
@@ -114,6 +114,10 @@ public:
     int  GetUndoCount() const;
     void SetUndoCount(const int &value);
 
+    int  GetUndoMemory() const;
+    void SetUndoMemory(int value);
+    static int GetDefUndoMemory();
+
     QStringList GetRecentFileList() const;
     void SetRecentFileList(const QStringList &value);
 
@@ -90,6 +90,8 @@ Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingLayoutPaperWidth, (QLatin1String
 Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingLayoutFollowGrainline, (QLatin1String("layout/followGrainline")))
 Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingLayoutManualPriority, (QLatin1String("layout/manualPriority")))
 Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingLayoutNestQuantity, (QLatin1String("layout/nestQuantity")))
+Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingLayoutRepair, (QLatin1String("layout/repair")))
+Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingLayoutCache, (QLatin1String("layout/cache")))
 Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingLayoutAutoCropLength, (QLatin1String("layout/autoCropLength")))
 Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingLayoutAutoCropWidth, (QLatin1String("layout/autoCropWidth")))
 Q_GLOBAL_STATIC_WITH_ARGS(const QString, settingLayoutSaveLength, (QLatin1String("layout/saveLength")))
@@ -379,6 +381,42 @@ void VSettings::SetLayoutNestQuantity(bool value)
     setValue(*settingLayoutNestQuantity, value);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+bool VSettings::GetLayoutRepair() const
+{
+    return value(*settingLayoutRepair, GetDefLayoutRepair()).toBool();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VSettings::GetDefLayoutRepair()
+{
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VSettings::SetLayoutRepair(bool value)
+{
+    setValue(*settingLayoutRepair, value);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VSettings::GetLayoutCache() const
+{
+    return value(*settingLayoutCache, GetDefLayoutCache()).toBool();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VSettings::GetDefLayoutCache()
+{
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VSettings::SetLayoutCache(bool value)
+{
+    setValue(*settingLayoutCache, value);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 bool VSettings::GetLayoutAutoCropLength() const
 {
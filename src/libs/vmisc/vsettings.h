@@ -98,6 +98,14 @@ public:
     static bool GetDefLayoutNestQuantity();
     void SetLayoutNestQuantity(bool value);
 
+    bool GetLayoutRepair() const;
+    static bool GetDefLayoutRepair();
+    void SetLayoutRepair(bool value);
+
+    bool GetLayoutCache() const;
+    static bool GetDefLayoutCache();
+    void SetLayoutCache(bool value);
+
     bool GetLayoutAutoCropLength() const;
     static bool GetDefLayoutAutoCropLength();
     void SetLayoutAutoCropLength(bool value);
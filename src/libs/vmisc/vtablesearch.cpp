@@ -28,16 +28,19 @@
 
 #include "vtablesearch.h"
 
-#include <QPalette>
+#include <QAbstractItemModel>
+#include <QBrush>
+#include <QRegularExpression>
+#include <QRegularExpressionMatch>
+#include <QScopedPointer>
 #include <QStringBuilder>
-#include <QTableWidget>
-#include <QTableWidgetItem>
+#include <QTableView>
 #include <Qt>
 
 #include "../vmisc/def.h"
 
 //---------------------------------------------------------------------------------------------------------------------
-VTableSearch::VTableSearch(QTableWidget *table, QObject *parent)
+VTableSearch::VTableSearch(QTableView *table, QObject *parent)
     : QObject(parent),
       table(table),
       searchIndex(-1),
@@ -50,20 +53,17 @@ void VTableSearch::Clear()
 {
     SCASSERT(table != nullptr)
 
-    for(int i = 0; i < table->rowCount(); ++i)
+    QAbstractItemModel *model = table->model();
+    SCASSERT(model != nullptr)
+
+    for(int i = 0; i < model->rowCount(); ++i)
     {
-        for(int j = 0; j < table->columnCount(); ++j)
+        for(int j = 0; j < model->columnCount(); ++j)
         {
-            if (QTableWidgetItem *item = table->item(i, j))
+            const QModelIndex index = model->index(i, j);
+            if (index.data(Qt::BackgroundRole).isValid())
             {
-                if (item->row() % 2 != 0 && table->alternatingRowColors())
-                {
-                    item->setBackground(QPalette().alternateBase());
-                }
-                else
-                {
-                    item->setBackground(QPalette().base());
-                }
+                model->setData(index, QVariant(), Qt::BackgroundRole);
             }
         }
     }
@@ -79,12 +79,11 @@ void VTableSearch::ShowNext(int newIndex)
 {
     if (not searchList.isEmpty())
     {
-        QTableWidgetItem *item = searchList.at(searchIndex);
-        item->setBackground(Qt::yellow);
+        Highlight(searchList.at(searchIndex), Qt::yellow);
 
-        item = searchList.at(newIndex);
-        item->setBackground(Qt::red);
-        table->scrollToItem(item);
+        const QPersistentModelIndex &index = searchList.at(newIndex);
+        Highlight(index, Qt::red);
+        table->scrollTo(index);
         searchIndex = newIndex;
     }
     else
@@ -94,34 +93,57 @@ void VTableSearch::ShowNext(int newIndex)
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-QList<QTableWidgetItem *> VTableSearch::FindTableItems(const QString& term)
+void VTableSearch::Highlight(const QPersistentModelIndex &index, const QBrush &brush)
+{
+    if (index.isValid())
+    {
+        table->model()->setData(index, brush, Qt::BackgroundRole);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QList<QPersistentModelIndex> VTableSearch::FindTableItems(const QString& term)
 {
     if (term.isEmpty())
     {
-        return QList<QTableWidgetItem *>();
+        return QList<QPersistentModelIndex>();
     }
 
+    QString searchTerm = term;
+    Qt::MatchFlags flags = Qt::MatchContains;
+
     if (term.startsWith(QChar('/')))
     {
         QRegularExpression qre(QStringLiteral("^/(?<searchType>[^/]+)/(?<searchString>.+)$"));
         QScopedPointer<QRegularExpressionMatch> match(new QRegularExpressionMatch());
         if (!term.contains(qre, match.data()))
         {
-            return QList<QTableWidgetItem *>();
+            return QList<QPersistentModelIndex>();
         }
 
         auto searchType = match->capturedRef(QStringLiteral("searchType"));
         auto searchString = match->capturedRef(QStringLiteral("searchString"));
-        if (searchType == QChar('r'))
+        if (searchType != QChar('r'))
         {
-            QString reSearchString = ".*" % searchString % ".*";
-            return table->findItems(reSearchString, Qt::MatchRegExp);
+            return QList<QPersistentModelIndex>();
         }
 
-        return QList<QTableWidgetItem *>();
+        searchTerm = ".*" % searchString % ".*";
+        flags = Qt::MatchRegExp;
     }
 
-    return table->findItems(term, Qt::MatchContains);
+    // Same order as QTableWidget::findItems()
+    const QAbstractItemModel *model = table->model();
+    QList<QPersistentModelIndex> found;
+    for (int column = 0; column < model->columnCount(); ++column)
+    {
+        const QModelIndexList indexes = model->match(model->index(0, column), Qt::DisplayRole, searchTerm, -1, flags);
+        for (auto &index : indexes)
+        {
+            found.append(QPersistentModelIndex(index));
+        }
+    }
+    return found;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -135,15 +157,15 @@ void VTableSearch::Find(const QString &term)
 
     if (not searchList.isEmpty())
     {
-        for (auto item : qAsConst(searchList))
+        for (auto &index : qAsConst(searchList))
         {
-            item->setBackground(Qt::yellow);
+            Highlight(index, Qt::yellow);
         }
 
         searchIndex = 0;
-        QTableWidgetItem *item = searchList.at(searchIndex);
-        item->setBackground(Qt::red);
-        table->scrollToItem(item);
+        const QPersistentModelIndex &index = searchList.at(searchIndex);
+        Highlight(index, Qt::red);
+        table->scrollTo(index);
 
         emit HasResult(true);
     }
@@ -183,13 +205,13 @@ void VTableSearch::RemoveRow(int row)
         return;
     }
 
-    const int indexRow = searchList.at(searchIndex)->row();
+    const int indexRow = searchList.at(searchIndex).row();
 
     if (row <= indexRow)
     {
-        for (auto item : qAsConst(searchList))
+        for (auto &index : qAsConst(searchList))
         {
-            if (item->row() == row)
+            if (index.row() == row)
             {
                 --searchIndex;
             }
@@ -205,13 +227,13 @@ void VTableSearch::AddRow(int row)
         return;
     }
 
-    const int indexRow = searchList.at(searchIndex)->row();
+    const int indexRow = searchList.at(searchIndex).row();
 
     if (row <= indexRow)
     {
-        for (auto item : qAsConst(searchList))
+        for (auto &index : qAsConst(searchList))
         {
-            if (item->row() == row)
+            if (index.row() == row)
             {
                 ++searchIndex;
             }
@@ -228,9 +250,9 @@ void VTableSearch::RefreshList(const QString &term)
 
     if (not searchList.isEmpty())
     {
-        for (auto item : qAsConst(searchList))
+        for (auto &index : qAsConst(searchList))
         {
-            item->setBackground(Qt::yellow);
+            Highlight(index, Qt::yellow);
         }
 
         if (searchIndex < 0)
@@ -242,9 +264,9 @@ void VTableSearch::RefreshList(const QString &term)
            searchIndex = 0;
         }
 
-        QTableWidgetItem *item = searchList.at(searchIndex);
-        item->setBackground(Qt::red);
-        table->scrollToItem(item);
+        const QPersistentModelIndex &index = searchList.at(searchIndex);
+        Highlight(index, Qt::red);
+        table->scrollTo(index);
 
         emit HasResult(true);
     }
@@ -31,15 +31,21 @@
 
 #include <QObject>
 #include <QList>
+#include <QPersistentModelIndex>
 #include <QString>
-#include <QTableWidget>
+#include <QTableView>
 #include <QtGlobal>
 
+/**
+ * @brief The VTableSearch class searches text in cells of a table and highlights found cells.
+ *
+ * Works with any model that accepts Qt::BackgroundRole in setData(), for example the model of QTableWidget.
+ */
 class VTableSearch: public QObject
 {
     Q_OBJECT
 public:
-    explicit VTableSearch(QTableWidget *table, QObject *parent = nullptr);
+    explicit VTableSearch(QTableView *table, QObject *parent = nullptr);
 
     void Find(const QString &term);
     void FindPrevious();
@@ -54,13 +60,14 @@ signals:
 private:
     Q_DISABLE_COPY(VTableSearch)
 
-    QTableWidget *table;
-    int           searchIndex;
-    QList<QTableWidgetItem *> searchList;
+    QTableView *table;
+    int         searchIndex;
+    QList<QPersistentModelIndex> searchList;
 
     void Clear();
     void ShowNext(int newIndex);
-    QList<QTableWidgetItem *> FindTableItems(const QString& term);
+    void Highlight(const QPersistentModelIndex &index, const QBrush &brush);
+    QList<QPersistentModelIndex> FindTableItems(const QString& term);
 };
 
 #endif // VTABLESEARCH_H
@@ -0,0 +1,228 @@
+/************************************************************************
+ **
+ **  @file   vtrace.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "vtrace.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSharedPointer>
+#include <QThread>
+#include <QtDebug>
+
+QAtomicInt VTrace::enabled = QAtomicInt(0);
+
+namespace
+{
+struct VTraceEvent
+{
+    const char *name{nullptr};
+    const char *category{nullptr};
+    qint64      start{0};
+    qint64      end{0};
+    QVector<QPair<const char *, QString>> args{};
+};
+
+struct VTraceBuffer
+{
+    QMutex               mutex{};
+    int                  tid{0};
+    QString              threadName{};
+    QVector<VTraceEvent> events{};
+};
+
+QMutex traceMutex;
+QString tracePath;
+QElapsedTimer traceTimer;
+QVector<QSharedPointer<VTraceBuffer>> traceBuffers;
+
+//---------------------------------------------------------------------------------------------------------------------
+VTraceBuffer *ThreadBuffer()
+{
+    // The registry owns buffers, so events of finished worker threads survive until the trace is saved.
+    thread_local VTraceBuffer *buffer = nullptr;
+    if (buffer == nullptr)
+    {
+        QSharedPointer<VTraceBuffer> newBuffer(new VTraceBuffer);
+
+        QThread *thread = QThread::currentThread();
+        QMutexLocker locker(&traceMutex);
+        newBuffer->tid = traceBuffers.size() + 1;
+        if (thread != nullptr && not thread->objectName().isEmpty())
+        {
+            newBuffer->threadName = thread->objectName();
+        }
+        else if (QCoreApplication::instance() != nullptr && thread == QCoreApplication::instance()->thread())
+        {
+            newBuffer->threadName = QStringLiteral("Main thread");
+        }
+        else
+        {
+            newBuffer->threadName = QStringLiteral("Worker %1").arg(newBuffer->tid);
+        }
+        traceBuffers.append(newBuffer);
+        buffer = newBuffer.data();
+    }
+    return buffer;
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Enable start recording spans. The trace will be saved to path by Flush().
+ */
+void VTrace::Enable(const QString &path)
+{
+    if (path.isEmpty())
+    {
+        return;
+    }
+
+    QMutexLocker locker(&traceMutex);
+    tracePath = path;
+    if (not traceTimer.isValid())
+    {
+        traceTimer.start();
+    }
+    enabled.storeRelease(1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Flush save all recorded spans and stop recording.
+ * @return false if the trace file could not be written.
+ */
+bool VTrace::Flush()
+{
+    if (not IsEnabled())
+    {
+        return true;
+    }
+    enabled.storeRelease(0);
+
+    QMutexLocker locker(&traceMutex);
+
+    const qint64 pid = QCoreApplication::applicationPid();
+    QJsonArray events;
+
+    for (auto &buffer : qAsConst(traceBuffers))
+    {
+        QMutexLocker bufferLocker(&buffer->mutex);
+
+        QJsonObject meta;
+        meta[QLatin1String("ph")] = QStringLiteral("M");
+        meta[QLatin1String("name")] = QStringLiteral("thread_name");
+        meta[QLatin1String("pid")] = pid;
+        meta[QLatin1String("tid")] = buffer->tid;
+        meta[QLatin1String("args")] = QJsonObject{{QStringLiteral("name"), buffer->threadName}};
+        events.append(meta);
+
+        for (auto &event : qAsConst(buffer->events))
+        {
+            QJsonObject object;
+            object[QLatin1String("ph")] = QStringLiteral("X");
+            object[QLatin1String("name")] = QString::fromLatin1(event.name);
+            object[QLatin1String("cat")] = QString::fromLatin1(event.category);
+            object[QLatin1String("pid")] = pid;
+            object[QLatin1String("tid")] = buffer->tid;
+            object[QLatin1String("ts")] = static_cast<double>(event.start) / 1000.0;
+            object[QLatin1String("dur")] = static_cast<double>(event.end - event.start) / 1000.0;
+
+            if (not event.args.isEmpty())
+            {
+                QJsonObject args;
+                for (auto &arg : event.args)
+                {
+                    args[QString::fromLatin1(arg.first)] = arg.second;
+                }
+                object[QLatin1String("args")] = args;
+            }
+            events.append(object);
+        }
+        buffer->events.clear();
+    }
+
+    QJsonObject root;
+    root[QLatin1String("traceEvents")] = events;
+    root[QLatin1String("displayTimeUnit")] = QStringLiteral("ms");
+
+    QFile file(tracePath);
+    if (not file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning() << QCoreApplication::translate("VTrace", "Can't save trace to %1. Error: %2.")
+                      .arg(tracePath, file.errorString());
+        return false;
+    }
+
+    file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VTrace::Record(const char *name, const char *category, qint64 start, qint64 end,
+                    const QVector<QPair<const char *, QString>> &args)
+{
+    VTraceBuffer *buffer = ThreadBuffer();
+
+    VTraceEvent event;
+    event.name = name;
+    event.category = category;
+    event.start = start;
+    event.end = end;
+    event.args = args;
+
+    QMutexLocker locker(&buffer->mutex);
+    buffer->events.append(event);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+qint64 VTrace::Now()
+{
+    return traceTimer.nsecsElapsed();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VTraceScope::VTraceScope(const char *name, const char *category)
+    : m_name(name),
+      m_category(category),
+      m_start(VTrace::IsEnabled() ? VTrace::Now() : -1)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+VTraceScope::~VTraceScope()
+{
+    if (m_start >= 0 && VTrace::IsEnabled())
+    {
+        VTrace::Record(m_name, m_category, m_start, VTrace::Now(), m_args);
+    }
+}
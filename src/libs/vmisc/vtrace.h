@@ -0,0 +1,107 @@
+/************************************************************************
+ **
+ **  @file   vtrace.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VTRACE_H
+#define VTRACE_H
+
+#include <QAtomicInt>
+#include <QPair>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+/**
+ * @brief The VTrace class collects timing spans and saves them in Chrome trace event format.
+ *
+ * Tracing is off by default. While it is off a span costs one atomic load, so instrumentation can stay in hot code.
+ * Each thread records into its own buffer, buffers are merged only when the trace is saved.
+ */
+class VTrace
+{
+public:
+    static void Enable(const QString &path);
+    static bool Flush();
+
+    static inline bool IsEnabled()
+    {
+        return enabled.loadAcquire() != 0;
+    }
+
+private:
+    Q_DISABLE_COPY(VTrace)
+    friend class VTraceScope;
+
+    static QAtomicInt enabled;
+
+    static void Record(const char *name, const char *category, qint64 start, qint64 end,
+                       const QVector<QPair<const char *, QString>> &args);
+    static qint64 Now();
+};
+
+/**
+ * @brief The VTraceScope class records a complete event from construction to destruction.
+ *
+ * Name, category and argument keys must be string literals, only pointers are stored.
+ */
+class VTraceScope
+{
+public:
+    VTraceScope(const char *name, const char *category);
+    ~VTraceScope();
+
+    void AddArg(const char *key, const QString &value);
+    void AddArg(const char *key, qint64 value);
+
+private:
+    Q_DISABLE_COPY(VTraceScope)
+
+    const char *m_name;
+    const char *m_category;
+    qint64      m_start;
+    QVector<QPair<const char *, QString>> m_args{};
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+inline void VTraceScope::AddArg(const char *key, const QString &value)
+{
+    if (m_start >= 0)
+    {
+        m_args.append(qMakePair(key, value));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline void VTraceScope::AddArg(const char *key, qint64 value)
+{
+    if (m_start >= 0)
+    {
+        m_args.append(qMakePair(key, QString::number(value)));
+    }
+}
+
+#endif // VTRACE_H
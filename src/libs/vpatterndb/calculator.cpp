@@ -86,6 +86,10 @@ qreal Calculator::EvalFormula(const QHash<QString, QSharedPointer<VInternalVaria
         return result;
     }
 
+    // Variables from previous evaluation keep old values. Forget them to make reusing calculator safe.
+    ClearVar();
+    m_varsValues.clear();
+
     SetSepForEval();//Reset separators options
     m_vars = vars;
     SetExpr(formula);
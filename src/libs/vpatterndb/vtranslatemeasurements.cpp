@@ -28,6 +28,8 @@
 
 #include "vtranslatemeasurements.h"
 
+#include <QMutexLocker>
+
 #include "../qmuparser/qmutranslation.h"
 #include "measurements.h"
 #include "../vmisc/vabstractapplication.h"
@@ -40,7 +42,7 @@ VTranslateMeasurements::VTranslateMeasurements()
       numbers(QMap<QString, QString>()),
       formulas(QMap<QString, QString>())
 {
-    InitMeasurements();
+    // Tables are big. Build them on first lookup.
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -59,16 +61,13 @@ VTranslateMeasurements::~VTranslateMeasurements()
 bool VTranslateMeasurements::MeasurementsFromUser(QString &newFormula, int position, const QString &token,
                                                   int &bias) const
 {
-    QMap<QString, qmu::QmuTranslation>::const_iterator i = measurements.constBegin();
-    while (i != measurements.constEnd())
+    const QHash<QString, QString> table = FromUserTable();
+    auto i = table.constFind(token);
+    if (i != table.constEnd())
     {
-        if (token == i.value().translate(qApp->Settings()->GetLocale()))
-        {
-            newFormula.replace(position, token.length(), i.key());
-            bias = token.length() - i.key().length();
-            return true;
-        }
-        ++i;
+        newFormula.replace(position, token.length(), i.value());
+        bias = token.length() - i.value().length();
+        return true;
     }
     return false;
 }
@@ -76,22 +75,14 @@ bool VTranslateMeasurements::MeasurementsFromUser(QString &newFormula, int posit
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateMeasurements::MFromUser(const QString &measurement) const
 {
-    QMap<QString, qmu::QmuTranslation>::const_iterator i = measurements.constBegin();
-    while (i != measurements.constEnd())
-    {
-        const QString translated = i.value().translate(qApp->Settings()->GetLocale());
-        if (measurement == translated)
-        {
-            return i.key();
-        }
-        ++i;
-    }
-    return measurement;
+    return FromUserTable().value(measurement, measurement);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateMeasurements::MToUser(const QString &measurement) const
 {
+    PrepareMeasurements();
+
     if (measurements.contains(measurement))
     {
         return measurements.value(measurement).translate(qApp->Settings()->GetLocale());
@@ -105,6 +96,8 @@ QString VTranslateMeasurements::MToUser(const QString &measurement) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateMeasurements::MNumber(const QString &measurement) const
 {
+    PrepareMeasurements();
+
     if (numbers.contains(measurement))
     {
         return numbers.value(measurement);
@@ -118,12 +111,16 @@ QString VTranslateMeasurements::MNumber(const QString &measurement) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateMeasurements::MFormula(const QString &measurement) const
 {
+    PrepareMeasurements();
+
     return formulas.value(measurement);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateMeasurements::GuiText(const QString &measurement) const
 {
+    PrepareMeasurements();
+
     if (guiTexts.contains(measurement))
     {
         return guiTexts.value(measurement).translate(qApp->Settings()->GetLocale());
@@ -137,6 +134,8 @@ QString VTranslateMeasurements::GuiText(const QString &measurement) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateMeasurements::Description(const QString &measurement) const
 {
+    PrepareMeasurements();
+
     if (descriptions.contains(measurement))
     {
         return descriptions.value(measurement).translate(qApp->Settings()->GetLocale());
@@ -150,12 +149,75 @@ QString VTranslateMeasurements::Description(const QString &measurement) const
 //---------------------------------------------------------------------------------------------------------------------
 void VTranslateMeasurements::Retranslate()
 {
+    QMutexLocker locker(&m_mutex);
     measurements.clear();
     guiTexts.clear();
     descriptions.clear();
     numbers.clear();
     formulas.clear();
-    InitMeasurements();
+    m_fromUser.clear();
+    m_fromUserLocale.clear();
+    m_ready.storeRelease(0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+const QMap<QString, qmu::QmuTranslation> &VTranslateMeasurements::Measurements() const
+{
+    PrepareMeasurements();
+    return measurements;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PrepareMeasurements build tables on first lookup.
+ *
+ * Thread safe. One object can be shared by all pattern evaluations in the same process.
+ */
+void VTranslateMeasurements::PrepareMeasurements() const
+{
+    if (m_ready.loadAcquire() != 0)
+    {
+        return;
+    }
+
+    QMutexLocker locker(&m_mutex);
+    if (m_ready.loadAcquire() == 0)
+    {
+        // Object itself is never created as const, only lookups are const.
+        const_cast<VTranslateMeasurements *>(this)->InitMeasurements();
+        m_ready.storeRelease(1);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FromUserTable return compiled for current locale table of relations between translated measurement names and
+ * internal.
+ */
+QHash<QString, QString> VTranslateMeasurements::FromUserTable() const
+{
+    PrepareMeasurements();
+
+    const QString locale = qApp->Settings()->GetLocale();
+
+    QMutexLocker locker(&m_mutex);
+    if (m_fromUserLocale != locale || m_fromUser.isEmpty())
+    {
+        m_fromUser.clear();
+        m_fromUser.reserve(measurements.size());
+        QMap<QString, qmu::QmuTranslation>::const_iterator i = measurements.constBegin();
+        while (i != measurements.constEnd())
+        {
+            const QString translated = i.value().translate(locale);
+            if (not m_fromUser.contains(translated))
+            {// Keep the first match the same way as linear search did
+                m_fromUser.insert(translated, i.key());
+            }
+            ++i;
+        }
+        m_fromUserLocale = locale;
+    }
+    return m_fromUser;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
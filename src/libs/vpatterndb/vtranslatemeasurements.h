@@ -29,7 +29,10 @@
 #ifndef VTRANSLATEMEASUREMENTS_H
 #define VTRANSLATEMEASUREMENTS_H
 
+#include <QAtomicInt>
+#include <QHash>
 #include <QMap>
+#include <QMutex>
 #include <QString>
 #include <QtGlobal>
 
@@ -53,15 +56,24 @@ public:
     virtual void Retranslate();
 
 protected:
-    QMap<QString, qmu::QmuTranslation> measurements;
+    const QMap<QString, qmu::QmuTranslation> &Measurements() const;
 
 private:
     Q_DISABLE_COPY(VTranslateMeasurements)
+    QMap<QString, qmu::QmuTranslation> measurements;
     QMap<QString, qmu::QmuTranslation> guiTexts;
     QMap<QString, qmu::QmuTranslation> descriptions;
     QMap<QString, QString> numbers;
     QMap<QString, QString> formulas;
 
+    mutable QMutex m_mutex{};
+    mutable QAtomicInt m_ready{0};
+    mutable QString m_fromUserLocale{};
+    mutable QHash<QString, QString> m_fromUser{};
+
+    void PrepareMeasurements() const;
+    QHash<QString, QString> FromUserTable() const;
+
     void InitGroupA(); // Direct Height
     void InitGroupB(); // Direct Width
     void InitGroupC(); // Indentation
@@ -32,6 +32,7 @@
 #include <QLocale>
 #include <QMap>
 #include <QMessageLogger>
+#include <QMutexLocker>
 #include <QString>
 #include <QtDebug>
 
@@ -45,16 +46,19 @@
 #include "vtranslatemeasurements.h"
 #include "pmsystems.h"
 
+namespace
+{
+// Bound for each translation cache. Enough to keep all formulas of a big pattern.
+const int formulaCacheSize = 4096;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VTranslateVars::VTranslateVars()
-    :VTranslateMeasurements()
+    :VTranslateMeasurements(),
+      m_toUserCache(formulaCacheSize),
+      m_fromUserCache(formulaCacheSize)
 {
-    InitPatternMakingSystems();
-    InitVariables();
-    InitFunctions();
-    InitPlaceholder();
-
-    PrepareFunctionTranslations();
+    // Tables are built on first lookup. See PrepareTables().
 }
 
 #define translate(context, source, disambiguation) qmu::QmuTranslation::translate((context), (source), (disambiguation))
@@ -658,6 +662,8 @@ void VTranslateVars::BiasTokens(int position, int bias, QMap<int, QString> &toke
  */
 bool VTranslateVars::VariablesFromUser(QString &newFormula, int position, const QString &token, int &bias) const
 {
+    PrepareTables();
+
     const QString currentLengthTr = variables.value(currentLength).translate(qApp->Settings()->GetLocale());
     const QString currentSeamAllowanceTr = variables.value(currentSeamAllowance)
             .translate(qApp->Settings()->GetLocale());
@@ -698,16 +704,13 @@ bool VTranslateVars::VariablesFromUser(QString &newFormula, int position, const
  */
 bool VTranslateVars::FunctionsFromUser(QString &newFormula, int position, const QString &token, int &bias) const
 {
-    QMap<QString, qmu::QmuTranslation>::const_iterator i = functions.constBegin();
-    while (i != functions.constEnd())
+    const QHash<QString, QString> table = FunctionsFromUserTable();
+    auto i = table.constFind(token);
+    if (i != table.constEnd())
     {
-        if (token == i.value().translate(qApp->Settings()->GetLocale()))
-        {
-            newFormula.replace(position, token.length(), i.key());
-            bias = token.length() - i.key().length();
-            return true;
-        }
-        ++i;
+        newFormula.replace(position, token.length(), i.value());
+        bias = token.length() - i.value().length();
+        return true;
     }
     return false;
 }
@@ -723,6 +726,8 @@ bool VTranslateVars::FunctionsFromUser(QString &newFormula, int position, const
  */
 bool VTranslateVars::VariablesToUser(QString &newFormula, int position, const QString &token, int &bias) const
 {
+    PrepareTables();
+
     QMap<QString, qmu::QmuTranslation>::const_iterator i = variables.constBegin();
     while (i != variables.constEnd())
     {
@@ -764,6 +769,8 @@ QString VTranslateVars::InternalVarToUser(const QString &var) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateVars::PlaceholderToUser(QString var) const
 {
+    PrepareTables();
+
     QString number;
     if (var.startsWith(pl_userMaterial) && var.length() > pl_userMaterial.length())
     {
@@ -782,6 +789,8 @@ QString VTranslateVars::PlaceholderToUser(QString var) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateVars::PlaceholderToUserText(QString text) const
 {
+    PrepareTables();
+
     QChar per('%');
     auto i = placeholders.constBegin();
     while (i != placeholders.constEnd())
@@ -821,6 +830,8 @@ QString VTranslateVars::PlaceholderToUserText(QString text) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateVars::PlaceholderFromUserText(QString text) const
 {
+    PrepareTables();
+
     QChar per('%');
     auto i = placeholders.constBegin();
     while (i != placeholders.constEnd())
@@ -864,11 +875,13 @@ QString VTranslateVars::VarToUser(const QString &var) const
         return var; // We do not support translation of variables for Chinese
     }
 
+    const QMap<QString, qmu::QmuTranslation> &measurements = Measurements();
     if (measurements.contains(var))
     {
         return measurements.value(var).translate(qApp->Settings()->GetLocale());
     }
 
+    PrepareTables();
     if (functions.contains(var))
     {
         return functions.value(var).translate(qApp->Settings()->GetLocale());
@@ -907,18 +920,21 @@ QString VTranslateVars::VarFromUser(const QString &var) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateVars::PMSystemName(const QString &code) const
 {
+    PrepareTables();
     return PMSystemNames.value(code).translate(qApp->Settings()->GetLocale());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateVars::PMSystemAuthor(const QString &code) const
 {
+    PrepareTables();
     return PMSystemAuthors.value(code).translate(qApp->Settings()->GetLocale());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateVars::PMSystemBook(const QString &code) const
 {
+    PrepareTables();
     return PMSystemBooks.value(code).translate(qApp->Settings()->GetLocale());
 }
 
@@ -936,7 +952,15 @@ QString VTranslateVars::FormulaFromUser(const QString &formula, bool osSeparator
     {
         return formula;
     }
-    QString newFormula = formula;// Local copy for making changes
+
+    const QString key = FormulaCacheKey(formula, osSeparator);
+    QString newFormula;
+    if (CachedFormula(m_fromUserCache, key, newFormula))
+    {
+        return newFormula;
+    }
+
+    newFormula = formula;// Local copy for making changes
 
     // Eval formula
     QScopedPointer<qmu::QmuTokenParser> cal(new qmu::QmuTokenParser(formula, osSeparator, true, GetTranslatedFunctions()));
@@ -1017,6 +1041,7 @@ QString VTranslateVars::FormulaFromUser(const QString &formula, bool osSeparator
         }
     }
 
+    CacheFormula(m_fromUserCache, key, newFormula);
     return newFormula;
 }
 
@@ -1049,15 +1074,20 @@ QString VTranslateVars::FormulaToUser(const QString &formula, bool osSeparator)
         return formula;
     }
 
-    QString newFormula = formula;// Local copy for making changes
+    const QString key = FormulaCacheKey(formula, osSeparator);
+    QString newFormula;
+    if (CachedFormula(m_toUserCache, key, newFormula))
+    {
+        return newFormula;
+    }
+
+    newFormula = formula;// Local copy for making changes
 
-    QMap<int, QString> tokens;
-    QMap<int, QString> numbers;
+    QMap<int, QString> tokens;// Tokens (variables, measurements)
+    QMap<int, QString> numbers;// All numbers in expression for changing decimal separator
     try
     {
-        QScopedPointer<qmu::QmuTokenParser> cal(new qmu::QmuTokenParser(formula, false, false));// Eval formula
-        tokens = cal->GetTokens();// Tokens (variables, measurements)
-        numbers = cal->GetNumbers();// All numbers in expression for changing decimal separator
+        qmu::QmuTokenParser::TokenizeInternal(formula, tokens, numbers);
     }
     catch (qmu::QmuParserError &e)
     {
@@ -1069,6 +1099,9 @@ QString VTranslateVars::FormulaToUser(const QString &formula, bool osSeparator)
         return newFormula;
     }
 
+    PrepareTables();
+    const QMap<QString, qmu::QmuTranslation> &measurements = Measurements();
+
     QList<int> tKeys = tokens.keys();
     QList<QString> tValues = tokens.values();
     for (int i = 0; i < tKeys.size(); ++i)
@@ -1154,6 +1187,7 @@ QString VTranslateVars::FormulaToUser(const QString &formula, bool osSeparator)
         }
     }
 
+    CacheFormula(m_toUserCache, key, newFormula);
     return newFormula;
 }
 
@@ -1176,36 +1210,145 @@ void VTranslateVars::Retranslate()
 {
     VTranslateMeasurements::Retranslate();
 
-    PMSystemNames.clear();
-    PMSystemAuthors.clear();
-    PMSystemBooks.clear();
-    variables.clear();
-    functions.clear();
-    functionsDescriptions.clear();
-    stDescriptions.clear();
+    {
+        QMutexLocker locker(&m_tablesMutex);
+        PMSystemNames.clear();
+        PMSystemAuthors.clear();
+        PMSystemBooks.clear();
+        variables.clear();
+        functions.clear();
+        functionsDescriptions.clear();
+        placeholders.clear();
+        stDescriptions.clear();
+        translatedFunctions.clear();
+        m_functionsFromUser.clear();
+        m_functionsFromUserLocale.clear();
+        m_tablesReady.storeRelease(0);
+    }
 
-    InitPatternMakingSystems();
-    InitVariables();
-    InitFunctions();
-    InitPlaceholder();
+    InvalidateFormulaCache();
+}
 
-    PrepareFunctionTranslations();
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PrepareTables build tables of variables, functions, placeholders and pattern making systems on first lookup.
+ *
+ * Thread safe. One object can be shared by all pattern evaluations in the same process.
+ */
+void VTranslateVars::PrepareTables() const
+{
+    if (m_tablesReady.loadAcquire() != 0)
+    {
+        return;
+    }
+
+    QMutexLocker locker(&m_tablesMutex);
+    if (m_tablesReady.loadAcquire() == 0)
+    {
+        // Object itself is never created as const, only lookups are const.
+        auto *self = const_cast<VTranslateVars *>(this);
+        self->InitPatternMakingSystems();
+        self->InitVariables();
+        self->InitFunctions();
+        self->InitPlaceholder();
+
+        self->PrepareFunctionTranslations();
+        m_tablesReady.storeRelease(1);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FunctionsFromUserTable return compiled for current locale table of relations between translated function names
+ * and internal.
+ */
+QHash<QString, QString> VTranslateVars::FunctionsFromUserTable() const
+{
+    PrepareTables();
+
+    const QString locale = qApp->Settings()->GetLocale();
+
+    QMutexLocker locker(&m_tablesMutex);
+    if (m_functionsFromUserLocale != locale || m_functionsFromUser.isEmpty())
+    {
+        m_functionsFromUser.clear();
+        m_functionsFromUser.reserve(functions.size());
+        QMap<QString, qmu::QmuTranslation>::const_iterator i = functions.constBegin();
+        while (i != functions.constEnd())
+        {
+            const QString translated = i.value().translate(locale);
+            if (not m_functionsFromUser.contains(translated))
+            {// Keep the first match the same way as linear search did
+                m_functionsFromUser.insert(translated, i.key());
+            }
+            ++i;
+        }
+        m_functionsFromUserLocale = locale;
+    }
+    return m_functionsFromUser;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief InvalidateFormulaCache forget all translated formulas. Must be called each time translation rules change.
+ */
+void VTranslateVars::InvalidateFormulaCache()
+{
+    QMutexLocker locker(&m_formulaCacheMutex);
+    m_toUserCache.clear();
+    m_fromUserCache.clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FormulaCacheKey build key for translation caches.
+ *
+ * Result of translation depends on formula, selected language and decimal separator settings. All of them are part of
+ * the key, so changing settings doesn't require explicit invalidation.
+ */
+QString VTranslateVars::FormulaCacheKey(const QString &formula, bool osSeparator)
+{
+    const QLocale loc;
+    return formula + QChar(QChar::Null) + qApp->Settings()->GetLocale() + QChar(QChar::Null) + loc.name() +
+            loc.decimalPoint() + loc.groupSeparator() + loc.negativeSign() + (osSeparator ? '1' : '0');
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VTranslateVars::CachedFormula(const QCache<QString, QString> &cache, const QString &key, QString &formula) const
+{
+    QMutexLocker locker(&m_formulaCacheMutex);
+    if (const QString *cached = cache.object(key))
+    {
+        formula = *cached;
+        return true;
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VTranslateVars::CacheFormula(QCache<QString, QString> &cache, const QString &key, const QString &formula) const
+{
+    QMutexLocker locker(&m_formulaCacheMutex);
+    cache.insert(key, new QString(formula));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QMap<QString, QString> VTranslateVars::GetTranslatedFunctions() const
 {
+    PrepareTables();
     return translatedFunctions;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QMap<QString, qmu::QmuTranslation> VTranslateVars::GetFunctions() const
 {
+    PrepareTables();
     return functions;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QMap<QString, qmu::QmuTranslation> VTranslateVars::GetFunctionsDescriptions() const
 {
+    PrepareTables();
     return functionsDescriptions;
 }
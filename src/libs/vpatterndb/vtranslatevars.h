@@ -30,6 +30,8 @@
 #define VTRANSLATEVARS_H
 
 #include <qcompilerdetection.h>
+#include <QCache>
+#include <QMutex>
 #include <QtGlobal>
 
 #include "vtranslatemeasurements.h"
@@ -65,6 +67,8 @@ public:
 
     virtual void Retranslate() override;
 
+    void InvalidateFormulaCache();
+
     QMap<QString, QString> GetTranslatedFunctions() const;
     QMap<QString, qmu::QmuTranslation> GetFunctions() const;
     QMap<QString, qmu::QmuTranslation> GetFunctionsDescriptions() const;
@@ -83,6 +87,15 @@ private:
     QMap<QString, qmu::QmuTranslation> stDescriptions{};
     QMap<QString, QString> translatedFunctions{};
 
+    mutable QMutex m_tablesMutex{};
+    mutable QAtomicInt m_tablesReady{0};
+    mutable QString m_functionsFromUserLocale{};
+    mutable QHash<QString, QString> m_functionsFromUser{};
+
+    mutable QMutex m_formulaCacheMutex{};
+    mutable QCache<QString, QString> m_toUserCache;
+    mutable QCache<QString, QString> m_fromUserCache;
+
     void InitPatternMakingSystems();
     void InitVariables();
     void InitFunctions();
@@ -90,11 +103,18 @@ private:
 
     void PrepareFunctionTranslations();
 
+    void PrepareTables() const;
+    QHash<QString, QString> FunctionsFromUserTable() const;
+
     void InitSystem(const QString &code, const qmu::QmuTranslation &name, const qmu::QmuTranslation &author,
                     const qmu::QmuTranslation &book);
 
     void CorrectionsPositions(int position, int bias, QMap<int, QString> &tokens, QMap<int, QString> &numbers) const;
 
+    static QString FormulaCacheKey(const QString &formula, bool osSeparator);
+    bool CachedFormula(const QCache<QString, QString> &cache, const QString &key, QString &formula) const;
+    void CacheFormula(QCache<QString, QString> &cache, const QString &key, const QString &formula) const;
+
 };
 
 #endif // VTRANSLATEVARS_H
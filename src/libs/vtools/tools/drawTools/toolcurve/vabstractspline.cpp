@@ -62,8 +62,7 @@ VAbstractSpline::VAbstractSpline(VAbstractPattern *doc, VContainer *data, quint3
       sceneType(SceneObject::Unknown),
       m_isHovered(false),
       detailsMode(qApp->Settings()->IsShowCurveDetails()),
-      m_acceptHoverEvents(true),
-      m_parentRefresh(false)
+      m_acceptHoverEvents(true)
 {
     InitDefShape();
     setAcceptHoverEvents(m_acceptHoverEvents);
@@ -95,45 +94,38 @@ QPainterPath VAbstractSpline::shape() const
 //---------------------------------------------------------------------------------------------------------------------
 void VAbstractSpline::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    const qreal width = ScaleWidth(m_isHovered ? qApp->Settings()->WidthMainLine() : qApp->Settings()->WidthHairLine(),
-                                   SceneScale(scene()));
+    const qreal lod = ItemLevelOfDetail(painter);
+    const qreal arrowLength = ScaleWidth(VAbstractCurve::LengthCurveDirectionArrow(),
+                                         SceneRenderSettings(scene()).scale);
 
-    const QSharedPointer<VAbstractCurve> curve = VAbstractTool::data.GeometricObject<VAbstractCurve>(m_id);
-    setPen(QPen(CorrectColor(this, curve->GetColor()), width, LineStyleToPenStyle(curve->GetPenStyle()), Qt::RoundCap));
-
-    auto PaintSpline = [this, curve](QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+    if ((m_isHovered || detailsMode) && not IsSubPixel(arrowLength, lod))
     {
-        if (m_isHovered || detailsMode)
-        {
-            painter->save();
+        const QSharedPointer<VAbstractCurve> curve = VAbstractTool::data.GeometricObject<VAbstractCurve>(m_id);
 
-            QPen arrowPen(pen());
-            arrowPen.setStyle(Qt::SolidLine);
+        painter->save();
 
-            painter->setPen(arrowPen);
-            painter->setBrush(brush());
+        QPen arrowPen(pen());
+        arrowPen.setStyle(Qt::SolidLine);
 
-            painter->drawPath(VAbstractCurve::ShowDirection(curve->DirectionArrows(),
-                                                            ScaleWidth(VAbstractCurve::LengthCurveDirectionArrow(),
-                                                                       SceneScale(scene()))));
+        painter->setPen(arrowPen);
+        painter->setBrush(brush());
 
-            painter->restore();
-        }
+        painter->drawPath(VAbstractCurve::ShowDirection(curve->DirectionArrows(), arrowLength));
 
-        PaintWithFixItemHighlightSelected<QGraphicsPathItem>(this, painter, option, widget);
-    };
-
-    if (not m_parentRefresh)
-    {
-        RefreshCtrlPoints();
-        m_parentRefresh = true;
-        PaintSpline(painter, option, widget);
-    }
-    else
-    {
-        m_parentRefresh = false;
-        PaintSpline(painter, option, widget);
+        painter->restore();
     }
+
+    PaintPathWithLevelOfDetail(this, m_levelOfDetail, lod, painter, option, widget);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief UpdateRenderSettings scale the pen and control points for the current zoom.
+ */
+void VAbstractSpline::UpdateRenderSettings(const VSceneRenderSettings &settings)
+{
+    ScalePenWidth(settings);
+    RefreshCtrlPoints();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -150,6 +142,7 @@ void VAbstractSpline::FullUpdateFromFile()
 {
     ReadAttributes();
     RefreshGeometry();
+    RefreshPen();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -225,6 +218,15 @@ void VAbstractSpline::RefreshGeometry()
     SetVisualization();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RefreshPen update the pen after hover, enable or color changes.
+ */
+void VAbstractSpline::RefreshPen()
+{
+    ScalePenWidth(SceneRenderSettings(scene()));
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief hoverEnterEvent handle hover enter events.
@@ -234,6 +236,7 @@ void VAbstractSpline::RefreshGeometry()
 void VAbstractSpline::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
 {
     m_isHovered = true;
+    RefreshPen();
     setToolTip(MakeToolTip());
     QGraphicsPathItem::hoverEnterEvent(event);
 }
@@ -247,6 +250,7 @@ void VAbstractSpline::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
 void VAbstractSpline::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
 {
     m_isHovered = false;
+    RefreshPen();
     QGraphicsPathItem::hoverLeaveEvent(event);
 }
 
@@ -263,6 +267,11 @@ QVariant VAbstractSpline::itemChange(QGraphicsItem::GraphicsItemChange change, c
     {
         emit ChangedToolSelection(value.toBool(), m_id, m_id);
     }
+    else if ((change == QGraphicsItem::ItemSceneHasChanged && scene() != nullptr)
+             || change == QGraphicsItem::ItemEnabledHasChanged)
+    {
+        RefreshPen();
+    }
 
     return QGraphicsPathItem::itemChange(change, value);
 }
@@ -439,6 +448,15 @@ void VAbstractSpline::InitDefShape()
     this->setPath(curve->GetPath());
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void VAbstractSpline::ScalePenWidth(const VSceneRenderSettings &settings)
+{
+    const qreal width = ScaleWidth(m_isHovered ? settings.widthMainLine : settings.widthHairLine, settings.scale);
+
+    const QSharedPointer<VAbstractCurve> curve = VAbstractTool::data.GeometricObject<VAbstractCurve>(m_id);
+    setPen(QPen(CorrectColor(this, curve->GetColor()), width, LineStyleToPenStyle(curve->GetPenStyle()), Qt::RoundCap));
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VAbstractSpline::ShowHandles(bool show)
 {
@@ -50,6 +50,8 @@
 #include "../vmisc/def.h"
 #include "../vwidgets/vmaingraphicsscene.h"
 #include "../vwidgets/vmaingraphicsview.h"
+#include "../vwidgets/global.h"
+#include "../vwidgets/vlevelofdetail.h"
 
 class VControlPointSpline;
 template <class T> class QSharedPointer;
@@ -68,7 +70,7 @@ struct VAbstractSplineInitData : VAbstractToolInitData
     qreal approximationScale;
 };
 
-class VAbstractSpline:public VDrawTool, public QGraphicsPathItem
+class VAbstractSpline:public VDrawTool, public QGraphicsPathItem, public VSceneRenderItem
 {
     Q_OBJECT
 public:
@@ -77,6 +79,7 @@ public:
 
     virtual QPainterPath shape() const override;
     virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget) override;
+    virtual void UpdateRenderSettings(const VSceneRenderSettings &settings) override;
     virtual int      type() const  override {return Type;}
     enum { Type = UserType + static_cast<int>(Tool::AbstractSpline)};
     virtual QString  getTagName() const override;
@@ -122,6 +125,7 @@ protected:
      * @brief RefreshGeometry  refresh item on scene.
      */
     virtual void     RefreshGeometry();
+    void             RefreshPen();
     virtual void     ShowTool(quint32 id, bool enable) override;
     virtual void     hoverEnterEvent ( QGraphicsSceneHoverEvent * event ) override;
     virtual void     hoverLeaveEvent ( QGraphicsSceneHoverEvent * event ) override;
@@ -155,9 +159,10 @@ protected:
 private:
     Q_DISABLE_COPY(VAbstractSpline)
 
-    bool m_parentRefresh;
+    VPathLevelOfDetail m_levelOfDetail{};
 
     void InitDefShape();
+    void ScalePenWidth(const VSceneRenderSettings &settings);
 };
 
 //---------------------------------------------------------------------------------------------------------------------
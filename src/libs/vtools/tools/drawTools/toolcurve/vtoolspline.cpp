@@ -613,6 +613,8 @@ void VToolSpline::CurveReleased()
 
         moved = false;
     }
+
+    doc->FlushLiteParse();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -667,6 +669,6 @@ void VToolSpline::SetSplineAttributes(QDomElement &domElement, const VSpline &sp
 void VToolSpline::UndoCommandMove(const VSpline &oldSpl, const VSpline &newSpl)
 {
     MoveSpline *moveSpl = new MoveSpline(doc, oldSpl, newSpl, m_id);
-    connect(moveSpl, &MoveSpline::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
+    connect(moveSpl, &MoveSpline::NeedLiteParsing, doc, &VAbstractPattern::ScheduleLiteParse);
     qApp->getUndoStack()->push(moveSpl);
 }
@@ -357,7 +357,7 @@ void VToolSplinePath::SetSplinePathAttributes(QDomElement &domElement, const VSp
 void VToolSplinePath::UndoCommandMove(const VSplinePath &oldPath, const VSplinePath &newPath)
 {
     MoveSplinePath *moveSplPath = new MoveSplinePath(doc, oldPath, newPath, m_id);
-    connect(moveSplPath, &VUndoCommand::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
+    connect(moveSplPath, &VUndoCommand::NeedLiteParsing, doc, &VAbstractPattern::ScheduleLiteParse);
     qApp->getUndoStack()->push(moveSplPath);
 }
 
@@ -772,4 +772,6 @@ void VToolSplinePath::CurveReleased()
 
         moved = false;
     }
+
+    doc->FlushLiteParse();
 }
@@ -87,15 +87,18 @@ VToolLinePoint::~VToolLinePoint()
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void VToolLinePoint::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+void VToolLinePoint::UpdateRenderSettings(const VSceneRenderSettings &settings)
 {
-    QPen mPen = mainLine->pen();
-    mPen.setColor(CorrectColor(this, lineColor));
-    mPen.setStyle(LineStyleToPenStyle(m_lineType));
+    if (mainLine != nullptr)
+    {
+        QPen mPen = mainLine->pen();
+        mPen.setColor(CorrectColor(this, lineColor));
+        mPen.setStyle(LineStyleToPenStyle(m_lineType));
 
-    mainLine->setPen(mPen);
+        mainLine->setPen(mPen);
+    }
 
-    VToolSinglePoint::paint(painter, option, widget);
+    VToolSinglePoint::UpdateRenderSettings(settings);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -68,8 +68,7 @@ public:
     virtual int       type() const override {return Type;}
     enum { Type = UserType + static_cast<int>(Tool::LinePoint)};
 
-    virtual void   paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
-                         QWidget *widget = nullptr) override;
+    virtual void   UpdateRenderSettings(const VSceneRenderSettings &settings) override;
 
     VFormula GetFormulaLength() const;
     void     SetFormulaLength(const VFormula &value);
@@ -187,7 +187,7 @@ QVariant VToolBasePoint::itemChange(QGraphicsItem::GraphicsItemChange change, co
             QPointF newPos = value.toPointF();
 
             MoveSPoint *moveSP = new MoveSPoint(doc, newPos.x(), newPos.y(), m_id, this->scene());
-            connect(moveSP, &MoveSPoint::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
+            connect(moveSP, &MoveSPoint::NeedLiteParsing, doc, &VAbstractPattern::ScheduleLiteParse);
             qApp->getUndoStack()->push(moveSP);
             const QList<QGraphicsView *> viewList = scene()->views();
             if (not viewList.isEmpty())
@@ -302,6 +302,7 @@ void VToolBasePoint::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
         if (event->button() == Qt::LeftButton && event->type() != QEvent::GraphicsSceneMouseDoubleClick)
         {
             SetItemOverrideCursor(this, cursorArrowOpenHand, 1, 1);
+            doc->FlushLiteParse(); // Show the final position without waiting for the next frame
         }
     }
     VToolSinglePoint::mouseReleaseEvent(event);
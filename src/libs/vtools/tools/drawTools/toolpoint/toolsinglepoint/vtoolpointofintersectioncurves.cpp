@@ -43,6 +43,7 @@
 #include "../ifc/exception/vexceptionobjecterror.h"
 #include "../ifc/ifcdef.h"
 #include "../vgeometry/vabstractcurve.h"
+#include "../vgeometry/vcurveindex.h"
 #include "../vgeometry/vgobject.h"
 #include "../vgeometry/vpointf.h"
 #include "../vpatterndb/vcontainer.h"
@@ -172,12 +173,7 @@ bool VToolPointOfIntersectionCurves::FindPoint(const QVector<QPointF> &curve1Poi
         return false;
     }
 
-    QVector<QPointF> intersections;
-    for ( auto i = 0; i < curve1Points.count()-1; ++i )
-    {
-        intersections << VAbstractCurve::CurveIntersectLine(curve2Points,
-                                                            QLineF(curve1Points.at(i), curve1Points.at(i+1)));
-    }
+    const QVector<QPointF> intersections = VCurveIndex(curve1Points).IntersectCurve(VCurveIndex(curve2Points));
 
     if (intersections.isEmpty())
     {
@@ -59,11 +59,19 @@ template <class T> class QSharedPointer;
 VDrawTool::VDrawTool(VAbstractPattern *doc, VContainer *data, quint32 id, QObject *parent)
     : VInteractiveTool(doc, data, id, parent),
       nameActivDraw(doc->GetNameActivPP()),
-      m_lineType(TypeLineLine)
+      m_lineType(TypeLineLine),
+      m_dispatcher(VDrawToolDispatcher::Instance(doc))
 {
-    connect(this->doc, &VAbstractPattern::ChangedActivPP, this, &VDrawTool::ChangedActivDraw);
-    connect(this->doc, &VAbstractPattern::ChangedNameDraw, this, &VDrawTool::ChangedNameDraw);
-    connect(this->doc, &VAbstractPattern::ShowTool, this, &VDrawTool::ShowTool);
+    m_dispatcher->Register(this);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VDrawTool::~VDrawTool()
+{
+    if (not m_dispatcher.isNull())
+    {
+        m_dispatcher->Unregister(this);
+    }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -39,6 +39,7 @@
 #include <QMenu>
 #include <QMetaObject>
 #include <QObject>
+#include <QPointer>
 #include <QString>
 #include <QtGlobal>
 
@@ -52,6 +53,7 @@
 #include "../vdatatool.h"
 #include "../vgeometry/vpointf.h"
 #include "../vtools/undocommands/undogroup.h"
+#include "vdrawtooldispatcher.h"
 
 /**
  * @brief The VDrawTool abstract class for all draw tool.
@@ -62,7 +64,7 @@ class VDrawTool : public VInteractiveTool
 public:
 
     VDrawTool(VAbstractPattern *doc, VContainer *data, quint32 id, QObject *parent = nullptr);
-    virtual ~VDrawTool() Q_DECL_EQ_DEFAULT;
+    virtual ~VDrawTool();
 
     QString      getLineType() const;
     virtual void SetTypeLine(const QString &value);
@@ -127,6 +129,9 @@ protected:
     static void InitDrawToolConnections(VMainGraphicsScene *scene, T *tool);
 private:
     Q_DISABLE_COPY(VDrawTool)
+    friend class VDrawToolDispatcher;
+
+    QPointer<VDrawToolDispatcher> m_dispatcher;
 };
 
 //---------------------------------------------------------------------------------------------------------------------
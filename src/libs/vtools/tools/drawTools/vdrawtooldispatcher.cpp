@@ -0,0 +1,149 @@
+/************************************************************************
+ **
+ **  @file   vdrawtooldispatcher.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "vdrawtooldispatcher.h"
+
+#include "../ifc/xml/vabstractpattern.h"
+#include "../vmisc/def.h"
+#include "vdrawtool.h"
+
+namespace
+{
+QHash<VAbstractPattern *, VDrawToolDispatcher *> dispatchers;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VDrawToolDispatcher::VDrawToolDispatcher(VAbstractPattern *doc)
+    : QObject(doc)
+{
+    SCASSERT(doc != nullptr)
+    connect(doc, &VAbstractPattern::ChangedActivPP, this, &VDrawToolDispatcher::ChangedActivPP);
+    connect(doc, &VAbstractPattern::ChangedNameDraw, this, &VDrawToolDispatcher::ChangedNameDraw);
+    connect(doc, &VAbstractPattern::ShowTool, this, &VDrawToolDispatcher::ShowTool);
+    connect(doc, &QObject::destroyed, this, [doc]() {dispatchers.remove(doc);});
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Instance return the dispatcher of the document, the dispatcher is created on first use and lives as long as
+ * the document.
+ */
+VDrawToolDispatcher *VDrawToolDispatcher::Instance(VAbstractPattern *doc)
+{
+    VDrawToolDispatcher *dispatcher = dispatchers.value(doc, nullptr);
+    if (dispatcher == nullptr)
+    {
+        dispatcher = new VDrawToolDispatcher(doc);
+        dispatchers.insert(doc, dispatcher);
+    }
+    return dispatcher;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDrawToolDispatcher::Register(VDrawTool *tool)
+{
+    SCASSERT(tool != nullptr)
+    m_tools.insert(tool->getId(), tool);
+
+    PatternPiece &patternPiece = m_patternPieces[tool->nameActivDraw];
+    patternPiece.tools.insert(tool);
+    patternPiece.stale = true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDrawToolDispatcher::Unregister(VDrawTool *tool)
+{
+    SCASSERT(tool != nullptr)
+    if (m_tools.value(tool->getId(), nullptr) == tool)
+    {
+        m_tools.remove(tool->getId());
+    }
+
+    auto patternPiece = m_patternPieces.find(tool->nameActivDraw);
+    if (patternPiece != m_patternPieces.end())
+    {
+        patternPiece->tools.remove(tool);
+        if (patternPiece->tools.isEmpty())
+        {
+            m_patternPieces.erase(patternPiece);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDrawToolDispatcher::ChangedActivPP(const QString &newName)
+{
+    for (auto patternPiece = m_patternPieces.begin(); patternPiece != m_patternPieces.end(); ++patternPiece)
+    {
+        const bool active = patternPiece.key() == newName;
+        if (patternPiece->stale || patternPiece->active != active)
+        {
+            for (auto *tool : qAsConst(patternPiece->tools))
+            {
+                tool->ChangedActivDraw(newName);
+            }
+            patternPiece->active = active;
+            patternPiece->stale = false;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDrawToolDispatcher::ChangedNameDraw(const QString &oldName, const QString &newName)
+{
+    if (oldName == newName || not m_patternPieces.contains(oldName))
+    {
+        return;
+    }
+
+    const PatternPiece renamed = m_patternPieces.take(oldName);
+    for (auto *tool : renamed.tools)
+    {
+        tool->ChangedNameDraw(oldName, newName);
+    }
+
+    auto patternPiece = m_patternPieces.find(newName);
+    if (patternPiece == m_patternPieces.end())
+    {
+        m_patternPieces.insert(newName, renamed);
+    }
+    else
+    {
+        patternPiece->tools.unite(renamed.tools);
+        patternPiece->stale = true;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDrawToolDispatcher::ShowTool(quint32 id, bool enable)
+{
+    if (VDrawTool *tool = m_tools.value(id, nullptr))
+    {
+        tool->ShowTool(id, enable);
+    }
+}
@@ -0,0 +1,79 @@
+/************************************************************************
+ **
+ **  @file   vdrawtooldispatcher.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VDRAWTOOLDISPATCHER_H
+#define VDRAWTOOLDISPATCHER_H
+
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QtGlobal>
+
+class VAbstractPattern;
+class VDrawTool;
+
+/**
+ * @brief The VDrawToolDispatcher class delivers document notifications only to draw tools they concern.
+ *
+ * Instead of connecting every tool to the document, tools are indexed by id and by pattern piece. ShowTool reaches one
+ * tool, renaming a pattern piece touches only its tools, changing the active pattern piece touches only pattern
+ * pieces that change their state.
+ */
+class VDrawToolDispatcher : public QObject
+{
+    Q_OBJECT
+public:
+    static VDrawToolDispatcher *Instance(VAbstractPattern *doc);
+
+    void Register(VDrawTool *tool);
+    void Unregister(VDrawTool *tool);
+
+private slots:
+    void ChangedActivPP(const QString &newName);
+    void ChangedNameDraw(const QString &oldName, const QString &newName);
+    void ShowTool(quint32 id, bool enable);
+
+private:
+    Q_DISABLE_COPY(VDrawToolDispatcher)
+
+    struct PatternPiece
+    {
+        QSet<VDrawTool *> tools{};
+        bool              active{false};
+        /** @brief stale true if the tools may not match the active state, for example new tools. */
+        bool              stale{true};
+    };
+
+    QHash<quint32, VDrawTool *>   m_tools{};
+    QHash<QString, PatternPiece>  m_patternPieces{};
+
+    explicit VDrawToolDispatcher(VAbstractPattern *doc);
+};
+
+#endif // VDRAWTOOLDISPATCHER_H
@@ -23,6 +23,7 @@ HEADERS += \
     $$PWD/drawTools/toolcurve/vtoolarc.h \
     $$PWD/drawTools/toolpoint/toolsinglepoint/toollinepoint/vtoolalongline.h \
     $$PWD/drawTools/vdrawtool.h \
+    $$PWD/drawTools/vdrawtooldispatcher.h \
     $$PWD/drawTools/drawtools.h \
     $$PWD/nodeDetails/vnodesplinepath.h \
     $$PWD/nodeDetails/vnodespline.h \
@@ -84,6 +85,7 @@ SOURCES += \
     $$PWD/drawTools/toolcurve/vtoolarc.cpp \
     $$PWD/drawTools/toolpoint/toolsinglepoint/toollinepoint/vtoolalongline.cpp \
     $$PWD/drawTools/vdrawtool.cpp \
+    $$PWD/drawTools/vdrawtooldispatcher.cpp \
     $$PWD/nodeDetails/vnodesplinepath.cpp \
     $$PWD/nodeDetails/vnodespline.cpp \
     $$PWD/nodeDetails/vnodepoint.cpp \
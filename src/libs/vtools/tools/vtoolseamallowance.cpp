@@ -52,6 +52,7 @@
 #include "../undocommands/togglepiecestate.h"
 #include "../vwidgets/vmaingraphicsview.h"
 #include "../vwidgets/vnobrushscalepathitem.h"
+#include "../vwidgets/vdecorationpathitem.h"
 #include "../vwidgets/vabstractmainwindow.h"
 #include "../qmuparser/qmutokenparser.h"
 #include "../vlayout/vlayoutdef.h"
@@ -466,16 +467,26 @@ void VToolSeamAllowance::ConnectOutsideSignals()
     connect(m_grainLine, &VGrainlineItem::SignalResized, this, &VToolSeamAllowance::SaveResizeGrainline);
     connect(m_grainLine, &VGrainlineItem::SignalRotated, this, &VToolSeamAllowance::SaveRotateGrainline);
 
-    connect(doc, &VAbstractPattern::UpdatePatternLabel, this, &VToolSeamAllowance::UpdatePatternInfo);
-    connect(doc, &VAbstractPattern::UpdatePatternLabel, this, &VToolSeamAllowance::UpdateDetailLabel);
-    connect(doc, &VAbstractPattern::CheckLayout, this, &VToolSeamAllowance::UpdateDetailLabel);
-    connect(doc, &VAbstractPattern::CheckLayout, this, &VToolSeamAllowance::UpdatePatternInfo);
-    connect(doc, &VAbstractPattern::CheckLayout, this, &VToolSeamAllowance::UpdateGrainline);
+    // One connection per signal, every piece listens to these document wide signals
+    connect(doc, &VAbstractPattern::UpdatePatternLabel, this, [this]()
+    {
+        UpdatePatternInfo();
+        UpdateDetailLabel();
+    });
+    connect(doc, &VAbstractPattern::CheckLayout, this, [this]()
+    {
+        UpdateDetailLabel();
+        UpdatePatternInfo();
+        UpdateGrainline();
+    });
 
     connect(m_sceneDetails, &VMainGraphicsScene::EnableToolMove, this, &VToolSeamAllowance::EnableToolMove);
     connect(m_sceneDetails, &VMainGraphicsScene::ItemClicked, this, &VToolSeamAllowance::ResetChildren);
-    connect(m_sceneDetails, &VMainGraphicsScene::DimensionsChanged, this, &VToolSeamAllowance::UpdateDetailLabel);
-    connect(m_sceneDetails, &VMainGraphicsScene::DimensionsChanged, this, &VToolSeamAllowance::UpdatePatternInfo);
+    connect(m_sceneDetails, &VMainGraphicsScene::DimensionsChanged, this, [this]()
+    {
+        UpdateDetailLabel();
+        UpdatePatternInfo();
+    });
     connect(m_sceneDetails, &VMainGraphicsScene::LanguageChanged, this, &VToolSeamAllowance::retranslateUi);
     connect(m_sceneDetails, &VMainGraphicsScene::EnableDetailItemHover, this, &VToolSeamAllowance::AllowHover);
     connect(m_sceneDetails, &VMainGraphicsScene::EnableDetailItemSelection, this, &VToolSeamAllowance::AllowSelecting);
@@ -845,21 +856,25 @@ void VToolSeamAllowance::SaveRotateGrainline(qreal dRot, const QPointF& ptPos)
  */
 void VToolSeamAllowance::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    QPen toolPen = pen();
-    toolPen.setWidthF(ScaleWidth(qApp->Settings()->WidthHairLine(), SceneScale(scene())));
-
-    setPen(toolPen);
-    m_seamAllowance->setPen(toolPen);
-    m_passmarks->setPen(toolPen);
-    m_placeLabels->setPen(toolPen);
-
     if ((m_dataLabel->IsIdle() == false
             || m_patternInfo->IsIdle() == false
             || m_grainLine->IsIdle() == false) && not isSelected())
     {
         setSelected(true);
     }
-    PaintWithFixItemHighlightSelected<QGraphicsPathItem>(this, painter, option, widget);
+    PaintPathWithLevelOfDetail(this, m_levelOfDetail, ItemLevelOfDetail(painter), painter, option, widget);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VToolSeamAllowance::UpdateRenderSettings(const VSceneRenderSettings &settings)
+{
+    QPen toolPen = pen();
+    toolPen.setWidthF(ScaleWidth(settings.widthHairLine, settings.scale));
+
+    setPen(toolPen);
+    m_seamAllowance->setPen(toolPen);
+    m_passmarks->setPen(toolPen);
+    m_placeLabels->setPen(toolPen);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -998,6 +1013,11 @@ QVariant VToolSeamAllowance::itemChange(QGraphicsItem::GraphicsItemChange change
         }
     }
 
+    if (change == QGraphicsItem::ItemSceneHasChanged)
+    {
+        UpdateRenderSettings(SceneRenderSettings(scene()));
+    }
+
     return QGraphicsPathItem::itemChange(change, value);
 }
 
@@ -1208,8 +1228,8 @@ VToolSeamAllowance::VToolSeamAllowance(const VToolSeamAllowanceInitData &initDat
       m_dataLabel(new VTextGraphicsItem(this)),
       m_patternInfo(new VTextGraphicsItem(this)),
       m_grainLine(new VGrainlineItem(this)),
-      m_passmarks(new QGraphicsPathItem(this)),
-      m_placeLabels(new QGraphicsPathItem(this)),
+      m_passmarks(new VDecorationPathItem(this)),
+      m_placeLabels(new VDecorationPathItem(this)),
       m_acceptHoverEvents(true)
 {
     VPiece detail = initData.data->GetPiece(initData.id);
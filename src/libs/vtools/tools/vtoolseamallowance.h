@@ -37,9 +37,12 @@
 #include "vinteractivetool.h"
 #include "../vwidgets/vtextgraphicsitem.h"
 #include "../vwidgets/vgrainlineitem.h"
+#include "../vwidgets/global.h"
+#include "../vwidgets/vlevelofdetail.h"
 
 class DialogTool;
 class VNoBrushScalePathItem;
+class VDecorationPathItem;
 
 struct VToolSeamAllowanceInitData : VAbstractToolInitData
 {
@@ -55,7 +58,7 @@ struct VToolSeamAllowanceInitData : VAbstractToolInitData
     QString drawName;
 };
 
-class VToolSeamAllowance : public VInteractiveTool, public QGraphicsPathItem
+class VToolSeamAllowance : public VInteractiveTool, public QGraphicsPathItem, public VSceneRenderItem
 {
     Q_OBJECT
 public:
@@ -119,6 +122,7 @@ public:
     virtual void         GroupVisibility(quint32 object, bool visible) override;
     virtual void         paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                                QWidget *widget) override;
+    virtual void         UpdateRenderSettings(const VSceneRenderSettings &settings) override;
     virtual QRectF       boundingRect() const override;
     virtual QPainterPath shape() const override;
 public slots:
@@ -186,11 +190,13 @@ private:
     VTextGraphicsItem     *m_dataLabel;
     VTextGraphicsItem     *m_patternInfo;
     VGrainlineItem        *m_grainLine;
-    QGraphicsPathItem     *m_passmarks;
-    QGraphicsPathItem     *m_placeLabels;
+    VDecorationPathItem   *m_passmarks;
+    VDecorationPathItem   *m_placeLabels;
 
     bool m_acceptHoverEvents;
 
+    VPathLevelOfDetail m_levelOfDetail{};
+
     VToolSeamAllowance(const VToolSeamAllowanceInitData &initData, QGraphicsItem * parent = nullptr);
 
     void UpdateExcludeState();
@@ -59,6 +59,7 @@ void AddPatternPiece::undo()
         QDomElement rootElement = doc->documentElement();
         QDomElement patternPiece = doc->GetPPElement(namePP);
         rootElement.removeChild(patternPiece);
+        StashXml();
         emit NeedFullParsing();
     }
 }
@@ -75,6 +76,7 @@ void AddPatternPiece::redo()
 
     QDomElement rootElement = doc->documentElement();
 
+    UnstashXml();
     rootElement.appendChild(xml);
 
     RedoFullParsing();
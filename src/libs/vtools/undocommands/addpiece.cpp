@@ -73,6 +73,7 @@ void AddPiece::undo()
                 qCDebug(vUndo, "Can't delete node");
                 return;
             }
+            StashXml();
 
             m_tool = qobject_cast<VToolSeamAllowance*>(VAbstractPattern::getTool(nodeId));
             SCASSERT(not m_tool.isNull());
@@ -114,6 +115,7 @@ void AddPiece::redo()
     QDomElement details = GetDetailsSection();
     if (not details.isNull())
     {
+        UnstashXml();
         details.appendChild(xml);
 
         if (not m_tool.isNull())
@@ -63,6 +63,7 @@ void AddToCalc::undo()
                 qCDebug(vUndo, "Can't delete node.");
                 return;
             }
+            StashXml();
         }
         else
         {
@@ -94,6 +95,7 @@ void AddToCalc::redo()
     QDomElement calcElement;
     if (doc->GetActivNodeElement(VAbstractPattern::TagCalculation, calcElement))
     {
+        UnstashXml();
         if (cursor == NULL_ID)
         {
             calcElement.appendChild(xml);
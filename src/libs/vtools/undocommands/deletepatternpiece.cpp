@@ -28,6 +28,7 @@
 
 #include "deletepatternpiece.h"
 
+#include <QDomDocument>
 #include <QDomNode>
 #include <QDomNodeList>
 
@@ -37,13 +38,15 @@
 
 //---------------------------------------------------------------------------------------------------------------------
 DeletePatternPiece::DeletePatternPiece(VAbstractPattern *doc, const QString &namePP, QUndoCommand *parent)
-    : VUndoCommand(QDomElement(), doc, parent), namePP(namePP), patternPiece(QDomElement()),
+    : VUndoCommand(QDomElement(), doc, parent), namePP(namePP), patternPiece(),
       previousPPName(QString())
 {
     setText(tr("delete pattern piece %1").arg(namePP));
 
     const QDomElement patternP = doc->GetPPElement(namePP);
-    patternPiece = patternP.cloneNode().toElement();
+    QDomDocument copy;
+    copy.appendChild(copy.importNode(patternP, true));
+    patternPiece.SetData(copy.toByteArray(-1));
     const QDomElement previousPP = patternP.previousSibling().toElement();//find previous pattern piece
     if (not previousPP.isNull() && previousPP.tagName() == VAbstractPattern::TagDraw)
     {
@@ -62,10 +65,14 @@ void DeletePatternPiece::undo()
 
     QDomElement rootElement = doc->documentElement();
 
+    QDomDocument copy;
+    copy.setContent(patternPiece.Data());
+    const QDomNode restored = doc->importNode(copy.documentElement(), true);
+
     if (not previousPPName.isEmpty())
     { // not first in the list, add after tag draw
         const QDomNode previousPP = doc->GetPPElement(previousPPName);
-        rootElement.insertAfter(patternPiece, previousPP);
+        rootElement.insertAfter(restored, previousPP);
     }
     else
     { // first in the list, add before tag draw
@@ -78,7 +85,7 @@ void DeletePatternPiece::undo()
         }
 
         Q_ASSERT_X(not draw.isNull(), Q_FUNC_INFO, "Couldn't' find tag draw");
-        rootElement.insertBefore(patternPiece, draw);
+        rootElement.insertBefore(restored, draw);
     }
 
     emit NeedFullParsing();
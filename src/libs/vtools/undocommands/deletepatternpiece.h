@@ -37,6 +37,7 @@
 #include <QtGlobal>
 
 #include "vundocommand.h"
+#include "vundopayload.h"
 
 class DeletePatternPiece : public VUndoCommand
 {
@@ -48,9 +49,10 @@ public:
     virtual void redo() override;
 private:
     Q_DISABLE_COPY(DeletePatternPiece)
-    QString     namePP;
-    QDomElement patternPiece;
-    QString     previousPPName;
+    QString      namePP;
+    /** @brief patternPiece serialized copy of the deleted pattern piece. */
+    VUndoPayload patternPiece;
+    QString      previousPPName;
 };
 
 #endif // DELETEPATTERNPIECE_H
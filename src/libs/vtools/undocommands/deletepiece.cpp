@@ -59,6 +59,7 @@ DeletePiece::DeletePiece(VAbstractPattern *doc, quint32 id, const VContainer &da
     if (domElement.isElement())
     {
         xml = domElement.cloneNode().toElement();
+        StashXml();
         m_parentNode = domElement.parentNode();
         QDomNode previousDetail = domElement.previousSibling();
         if (previousDetail.isNull())
@@ -91,6 +92,7 @@ void DeletePiece::undo()
 {
     qCDebug(vUndo, "Undo.");
 
+    UnstashXml();
     UndoDeleteAfterSibling(m_parentNode, m_siblingId, VAbstractPattern::TagDetail);
 
     VAbstractPattern::AddTool(nodeId, m_tool);
@@ -116,6 +118,7 @@ void DeletePiece::redo()
     if (domElement.isElement())
     {
         m_parentNode.removeChild(domElement);
+        StashXml();
 
         m_tool = qobject_cast<VToolSeamAllowance*>(VAbstractPattern::getTool(nodeId));
         SCASSERT(not m_tool.isNull());
@@ -45,6 +45,7 @@ DelTool::DelTool(VAbstractPattern *doc, quint32 id, QUndoCommand *parent)
     siblingId = doc->SiblingNodeId(nodeId);
     parentNode = doc->ParentNodeById(nodeId);
     xml = doc->CloneNodeById(nodeId);
+    StashXml();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -56,6 +57,7 @@ void DelTool::undo()
 {
     qCDebug(vUndo, "Undo.");
 
+    UnstashXml();
     UndoDeleteAfterSibling(parentNode, siblingId);
     emit NeedFullParsing();
 
@@ -76,5 +78,6 @@ void DelTool::redo()
     }
     QDomElement domElement = doc->NodeById(nodeId);
     parentNode.removeChild(domElement);
+    StashXml();
     emit NeedFullParsing();
 }
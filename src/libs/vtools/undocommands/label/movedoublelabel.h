@@ -49,6 +49,7 @@ public:
 
     virtual bool mergeWith(const QUndoCommand *command) override;
     virtual int  id() const override;
+    virtual quint32 ElementId() const override;
 
     quint32     GetToolId() const;
     MoveDoublePoint GetPointType() const;
@@ -74,4 +75,10 @@ inline quint32 MoveDoubleLabel::GetToolId() const
     return m_idTool;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+inline quint32 MoveDoubleLabel::ElementId() const
+{
+    return m_idTool;
+}
+
 #endif // MOVEDOUBLELABEL_H
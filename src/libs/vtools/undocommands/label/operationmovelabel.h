@@ -48,6 +48,7 @@ public:
 
     virtual bool mergeWith(const QUndoCommand *command) override;
     virtual int  id() const override;
+    virtual quint32 ElementId() const override;
 
     quint32 GetToolId() const;
 protected:
@@ -65,4 +66,10 @@ inline quint32 OperationMoveLabel::GetToolId() const
     return m_idTool;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+inline quint32 OperationMoveLabel::ElementId() const
+{
+    return m_idTool;
+}
+
 #endif // OPERATIONMOVELABEL_H
@@ -43,6 +43,7 @@ public:
 
     virtual void undo() override;
     virtual void redo() override;
+    virtual quint32 ElementId() const override;
 
 private:
     Q_DISABLE_COPY(OperationShowLabel)
@@ -55,4 +56,10 @@ private:
     void Do(bool visible);
 };
 
+//---------------------------------------------------------------------------------------------------------------------
+inline quint32 OperationShowLabel::ElementId() const
+{
+    return m_idTool;
+}
+
 #endif // OPERATIONSHOWLABEL_H
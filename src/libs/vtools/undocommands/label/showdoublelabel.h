@@ -45,6 +45,7 @@ public:
 
     virtual void undo() override;
     virtual void redo() override;
+    virtual quint32 ElementId() const override;
 private:
     Q_DISABLE_COPY(ShowDoubleLabel)
     bool m_visible;
@@ -57,4 +58,10 @@ private:
     void Do(bool visible);
 };
 
+//---------------------------------------------------------------------------------------------------------------------
+inline quint32 ShowDoubleLabel::ElementId() const
+{
+    return m_idTool;
+}
+
 #endif // SHOWDOUBLELABEL_H
@@ -40,8 +40,7 @@ SaveToolOptions::SaveToolOptions(const QDomElement &oldXml, const QDomElement &n
                                  const QList<quint32> &oldDependencies, const QList<quint32> &newDependencies,
                                  VAbstractPattern *doc, const quint32 &id, QUndoCommand *parent)
     : VUndoCommand(QDomElement(), doc, parent),
-      oldXml(oldXml),
-      newXml(newXml),
+      m_diff(VDomElementDiff(oldXml, newXml).Data()),
       oldDependencies(oldDependencies),
       newDependencies(newDependencies)
 {
@@ -57,7 +56,7 @@ void SaveToolOptions::undo()
     QDomElement domElement = doc->elementById(nodeId);
     if (domElement.isElement())
     {
-        domElement.parentNode().replaceChild(oldXml, domElement);
+        Diff().Undo(domElement);
 
         DecrementReferences(Missing(newDependencies, oldDependencies));
         IncrementReferences(Missing(oldDependencies, newDependencies));
@@ -78,7 +77,7 @@ void SaveToolOptions::redo()
     QDomElement domElement = doc->elementById(nodeId);
     if (domElement.isElement())
     {
-        domElement.parentNode().replaceChild(newXml, domElement);
+        Diff().Redo(domElement);
 
         DecrementReferences(Missing(oldDependencies, newDependencies));
         IncrementReferences(Missing(newDependencies, oldDependencies));
@@ -117,6 +116,17 @@ bool SaveToolOptions::mergeWith(const QUndoCommand *command)
         }
     }
 
-    newXml = saveCommand->getNewXml();
+    // The candidate is already applied, restore the state before both commands to get one diff
+    QDomElement domElement = doc->elementById(nodeId);
+    if (not domElement.isElement())
+    {
+        return false;
+    }
+
+    QDomElement oldXml = domElement.cloneNode().toElement();
+    saveCommand->Diff().Undo(oldXml);
+    Diff().Undo(oldXml);
+
+    m_diff.SetData(VDomElementDiff(oldXml, domElement).Data());
     return true;
 }
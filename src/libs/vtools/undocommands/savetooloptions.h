@@ -37,6 +37,8 @@
 #include <QtGlobal>
 
 #include "vundocommand.h"
+#include "vundopayload.h"
+#include "../ifc/xml/vdomelementdiff.h"
 
 class SaveToolOptions : public VUndoCommand
 {
@@ -51,13 +53,13 @@ public:
     virtual bool mergeWith(const QUndoCommand *command) override;
     virtual int  id() const override;
 
-    QDomElement    getNewXml() const;
-    quint32        getToolId() const;
-    QList<quint32> NewDependencies() const;
+    VDomElementDiff Diff() const;
+    quint32         getToolId() const;
+    QList<quint32>  NewDependencies() const;
 private:
     Q_DISABLE_COPY(SaveToolOptions)
-    const QDomElement    oldXml;
-    QDomElement          newXml;
+    /** @brief m_diff difference between old and new tool element, see VDomElementDiff. */
+    VUndoPayload         m_diff;
     const QList<quint32> oldDependencies;
     const QList<quint32> newDependencies;
 
@@ -71,9 +73,9 @@ inline int SaveToolOptions::id() const
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-inline QDomElement SaveToolOptions::getNewXml() const
+inline VDomElementDiff SaveToolOptions::Diff() const
 {
-    return newXml;
+    return VDomElementDiff::FromData(m_diff.Data());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -46,6 +46,7 @@ public:
     virtual ~TogglePieceInLayout() = default;
     virtual void undo() override;
     virtual void redo() override;
+    virtual quint32 ElementId() const override;
 signals:
     void Toggled(quint32 id);
 private:
@@ -69,6 +70,7 @@ public:
     virtual ~TogglePieceForceForbidFlipping() = default;
     virtual void undo() override;
     virtual void redo() override;
+    virtual quint32 ElementId() const override;
 private:
     Q_DISABLE_COPY(TogglePieceForceForbidFlipping)
     quint32     m_id;
@@ -80,4 +82,16 @@ private:
     bool        m_newForbidState;
 };
 
+//---------------------------------------------------------------------------------------------------------------------
+inline quint32 TogglePieceInLayout::ElementId() const
+{
+    return m_id;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline quint32 TogglePieceForceForbidFlipping::ElementId() const
+{
+    return m_id;
+}
+
 #endif // TOGGLEDETAILINLAYOUT_H
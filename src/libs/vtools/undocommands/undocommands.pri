@@ -26,7 +26,8 @@ HEADERS += \
     $$PWD/label/showdoublelabel.h \
     $$PWD/label/operationshowlabel.h \
     $$PWD/saveplacelabeloptions.h \
-    $$PWD/togglepiecestate.h
+    $$PWD/togglepiecestate.h \
+    $$PWD/vundopayload.h
 
 SOURCES += \
     $$PWD/addtocalc.cpp \
@@ -53,4 +54,5 @@ SOURCES += \
     $$PWD/label/showdoublelabel.cpp \
     $$PWD/label/operationshowlabel.cpp \
     $$PWD/saveplacelabeloptions.cpp \
-    $$PWD/togglepiecestate.cpp
+    $$PWD/togglepiecestate.cpp \
+    $$PWD/vundopayload.cpp
@@ -61,12 +61,13 @@ void AddGroup::undo()
         if (group.isElement())
         {
             group.setAttribute(VAbstractPattern::AttrVisible, trueStr);
-            doc->ParseGroups(groups);
+            doc->UnindexGroup(nodeId);
             if (groups.removeChild(group).isNull())
             {
                 qCDebug(vUndo, "Can't delete group.");
                 return;
             }
+            StashXml();
             emit UpdateGroups();
         }
         else
@@ -104,8 +105,9 @@ void AddGroup::redo()
     QDomElement groups = doc->CreateGroups();
     if (not groups.isNull())
     {
+        UnstashXml();
         groups.appendChild(xml);
-        doc->ParseGroups(groups);
+        doc->IndexGroup(xml);
         emit UpdateGroups();
     }
     else
@@ -219,13 +221,6 @@ void AddItemToGroup::performUndoRedo(bool isUndo)
                 qCDebug(vUndo, "Can't delete item.");
                 return;
             }
-
-            // set the item visible. Because if the undo is done when unvisible and it's not in any group after the
-            // undo, it stays unvisible until the entire drawing is completly rerendered.
-            quint32 objectId = doc->GetParametrUInt(xml, QStringLiteral("object"), NULL_ID_STR);
-            quint32 toolId = doc->GetParametrUInt(xml, QStringLiteral("tool"), NULL_ID_STR);
-            VDataTool* tool = VAbstractPattern::getTool(toolId);
-            tool->GroupVisibility(objectId,true);
         }
         else // is redo
         {
@@ -240,15 +235,8 @@ void AddItemToGroup::performUndoRedo(bool isUndo)
         doc->SetModified(true);
         emit qApp->getCurrentDocument()->patternChanged(false);
 
-        QDomElement groups = doc->CreateGroups();
-        if (not groups.isNull())
-        {
-            doc->ParseGroups(groups);
-        } else
-        {
-            qCDebug(vUndo, "Can't get tag Groups.");
-            return;
-        }
+        // An item left without a group becomes visible, otherwise it would stay hidden until the next full parse.
+        doc->IndexGroup(group);
 
         emit UpdateGroups();
     }
@@ -312,27 +300,13 @@ void RemoveItemFromGroup::performUndoRedo(bool isUndo)
                 qCDebug(vUndo, "Can't delete item.");
                 return;
             }
-
-            // set the item visible. Because if the undo is done when unvisibile and it's not in any group after the
-            // undo, it stays unvisible until the entire drawing is completly rerendered.
-            quint32 objectId = doc->GetParametrUInt(xml, QStringLiteral("object"), NULL_ID_STR);
-            quint32 toolId = doc->GetParametrUInt(xml, QStringLiteral("tool"), NULL_ID_STR);
-            VDataTool* tool = VAbstractPattern::getTool(toolId);
-            tool->GroupVisibility(objectId,true);
         }
 
         doc->SetModified(true);
         emit qApp->getCurrentDocument()->patternChanged(false);
 
-        QDomElement groups = doc->CreateGroups();
-        if (not groups.isNull())
-        {
-            doc->ParseGroups(groups);
-        } else
-        {
-            qCDebug(vUndo, "Can't get tag Groups.");
-            return;
-        }
+        // An item left without a group becomes visible, otherwise it would stay hidden until the next full parse.
+        doc->IndexGroup(group);
 
         emit UpdateGroups();
     }
@@ -362,7 +336,7 @@ ChangeGroupVisibility::ChangeGroupVisibility(VAbstractPattern *doc, vidtype id,
     QDomElement group = doc->elementById(nodeId, VAbstractPattern::TagGroup);
     if (group.isElement())
     {
-        m_oldVisibility = doc->GetParametrBool(group, VAbstractPattern::AttrVisible, trueStr);
+        m_oldVisibility = doc->GetGroupVisibility(nodeId);
     }
     else
     {
@@ -394,13 +368,7 @@ void ChangeGroupVisibility::Do(bool visible)
     QDomElement group = doc->elementById(nodeId, VAbstractPattern::TagGroup);
     if (group.isElement())
     {
-        doc->SetAttribute(group, VAbstractPattern::AttrVisible, visible);
-
-        QDomElement groups = doc->CreateGroups();
-        if (not groups.isNull())
-        {
-            doc->ParseGroups(groups);
-        }
+        doc->SetGroupsVisibility(QMap<vidtype, bool>{{nodeId, visible}});
 
         emit UpdateGroup(nodeId, visible);
 
@@ -428,7 +396,7 @@ ChangeMultipleGroupsVisibility::ChangeMultipleGroupsVisibility(VAbstractPattern
         QDomElement group = doc->elementById(groupId, VAbstractPattern::TagGroup);
         if (group.isElement())
         {
-            m_oldVisibility.insert(groupId, doc->GetParametrBool(group, VAbstractPattern::AttrVisible, trueStr));
+            m_oldVisibility.insert(groupId, doc->GetGroupVisibility(groupId));
         }
         else
         {
@@ -445,32 +413,10 @@ void ChangeMultipleGroupsVisibility::undo()
 
     doc->ChangeActivPP(m_nameActivDraw);//Without this user will not see this change
 
-    QMap<vidtype, bool> groupsState;
-
-    QMap<vidtype, bool>::const_iterator i = m_oldVisibility.constBegin();
-    while (i != m_oldVisibility.constEnd())
-    {
-        QDomElement group = doc->elementById(i.key(), VAbstractPattern::TagGroup);
-        if (group.isElement())
-        {
-            doc->SetAttribute(group, VAbstractPattern::AttrVisible, i.value());
-            groupsState.insert(i.key(), i.value());
-        }
-        else
-        {
-            qDebug("Can't get group by id = %u.", i.key());
-        }
-        ++i;
-    }
+    const QMap<vidtype, bool> groupsState = doc->SetGroupsVisibility(m_oldVisibility);
 
     if (not groupsState.isEmpty())
     {
-        QDomElement groups = doc->CreateGroups();
-        if (not groups.isNull())
-        {
-            doc->ParseGroups(groups);
-        }
-
         VMainGraphicsView::NewSceneRect(qApp->getCurrentScene(), qApp->getSceneView());
 
         emit UpdateMultipleGroups(groupsState);
@@ -484,30 +430,16 @@ void ChangeMultipleGroupsVisibility::redo()
 
     doc->ChangeActivPP(m_nameActivDraw);//Without this user will not see this change
 
-    QMap<vidtype, bool> groupsState;
-
+    QMap<vidtype, bool> newVisibility;
     for (auto& groupId : m_groups)
     {
-        QDomElement group = doc->elementById(groupId, VAbstractPattern::TagGroup);
-        if (group.isElement())
-        {
-            doc->SetAttribute(group, VAbstractPattern::AttrVisible, m_newVisibility);
-            groupsState.insert(groupId, m_newVisibility);
-        }
-        else
-        {
-            qDebug("Can't get group by id = %u.", groupId);
-        }
+        newVisibility.insert(groupId, m_newVisibility);
     }
 
+    const QMap<vidtype, bool> groupsState = doc->SetGroupsVisibility(newVisibility);
+
     if (not groupsState.isEmpty())
     {
-        QDomElement groups = doc->CreateGroups();
-        if (not groups.isNull())
-        {
-            doc->ParseGroups(groups);
-        }
-
         VMainGraphicsView::NewSceneRect(qApp->getCurrentScene(), qApp->getSceneView());
 
         emit UpdateMultipleGroups(groupsState);
@@ -522,6 +454,7 @@ DelGroup::DelGroup(VAbstractPattern *doc, quint32 id, QUndoCommand *parent)
     setText(tr("delete group"));
     nodeId = id;
     xml = doc->CloneNodeById(nodeId);
+    StashXml();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -537,8 +470,9 @@ void DelGroup::undo()
     QDomElement groups = doc->CreateGroups();
     if (not groups.isNull())
     {
+        UnstashXml();
         groups.appendChild(xml);
-        doc->ParseGroups(groups);
+        doc->IndexGroup(xml);
         emit UpdateGroups();
     }
     else
@@ -566,12 +500,13 @@ void DelGroup::redo()
         if (group.isElement())
         {
             group.setAttribute(VAbstractPattern::AttrVisible, trueStr);
-            doc->ParseGroups(groups);
+            doc->UnindexGroup(nodeId);
             if (groups.removeChild(group).isNull())
             {
                 qCDebug(vUndo, "Can't delete group.");
                 return;
             }
+            StashXml();
             emit UpdateGroups();
 
             if (groups.childNodes().isEmpty())
@@ -28,6 +28,7 @@
 
 #include "vundocommand.h"
 
+#include <QDomDocument>
 #include <QDomNode>
 #include <QApplication>
 
@@ -47,6 +48,16 @@ VUndoCommand::VUndoCommand(const QDomElement &xml, VAbstractPattern *doc, QUndoC
     SCASSERT(doc != nullptr)
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ElementId id of the element the command changes in the pattern file. NULL_ID if the command changes
+ * something else.
+ */
+quint32 VUndoCommand::ElementId() const
+{
+    return nodeId;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VUndoCommand::RedoFullParsing()
 {
@@ -198,3 +209,41 @@ QDomElement VUndoCommand::GetDestinationObject(quint32 idTool, quint32 idPoint)
 
     return QDomElement();
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief StashXml move xml that is out of the document to the undo payload, so old commands don't keep whole DOM
+ * subtrees in memory. Does nothing if xml is still part of the document.
+ */
+void VUndoCommand::StashXml()
+{
+    if (xml.isNull() || not xml.parentNode().isNull())
+    {
+        return;
+    }
+
+    QDomDocument copy;
+    copy.appendChild(copy.importNode(xml, true));
+    m_stashedXml.SetData(copy.toByteArray(-1));
+    xml = QDomElement();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief UnstashXml restore xml stashed by StashXml(). Call before putting xml back to the document.
+ */
+void VUndoCommand::UnstashXml()
+{
+    if (not xml.isNull())
+    {
+        return;
+    }
+
+    const QByteArray data = m_stashedXml.Data();
+    QDomDocument copy;
+    if (not data.isEmpty() && copy.setContent(data))
+    {
+        xml = doc->importNode(copy.documentElement(), true).toElement();
+    }
+    m_stashedXml.SetData(QByteArray());
+}
@@ -39,6 +39,7 @@
 #include <QtGlobal>
 
 #include "../ifc/xml/vabstractpattern.h"
+#include "vundopayload.h"
 
 Q_DECLARE_LOGGING_CATEGORY(vUndo)
 
@@ -71,6 +72,8 @@ class VUndoCommand : public QObject, public QUndoCommand
 public:
     VUndoCommand(const QDomElement &xml, VAbstractPattern *doc, QUndoCommand *parent = nullptr);
     virtual ~VUndoCommand() =default;
+
+    virtual quint32 ElementId() const;
 signals:
     void ClearScene();
     void NeedFullParsing();
@@ -94,8 +97,14 @@ protected:
     void         DecrementReferences(const QVector<VPieceNode> &nodes) const;
 
     QDomElement  GetDestinationObject(quint32 idTool, quint32 idPoint) const;
+
+    void         StashXml();
+    void         UnstashXml();
 private:
     Q_DISABLE_COPY(VUndoCommand)
+
+    /** @brief m_stashedXml serialized xml while it is out of the document. */
+    VUndoPayload m_stashedXml{};
 };
 
 #endif // VUNDOCOMMAND_H
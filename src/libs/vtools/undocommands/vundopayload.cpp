@@ -0,0 +1,308 @@
+/************************************************************************
+ **
+ **  @file   vundopayload.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "vundopayload.h"
+
+#include <QMap>
+#include <QPair>
+#include <QScopedPointer>
+#include <QTemporaryFile>
+#include <QVector>
+#include <QtDebug>
+
+#include "../vmisc/def.h"
+
+namespace
+{
+// Compression of a tiny payload doesn't pay off
+const int minCompressSize = 256;
+// Rewriting a small temporary file doesn't pay off
+const qint64 minCompactSize = 1024 * 1024;
+
+qint64 budget = 32 * 1024 * 1024;
+qint64 memoryUsage = 0;
+quint64 nextSerial = 0;
+int spilledCount = 0;
+qint64 spilledSize = 0;
+QMap<quint64, VUndoPayload *> payloads;
+QScopedPointer<QTemporaryFile> spillFile;
+
+//---------------------------------------------------------------------------------------------------------------------
+QTemporaryFile *SpillFile()
+{
+    if (spillFile.isNull())
+    {
+        spillFile.reset(new QTemporaryFile());
+        if (not spillFile->open())
+        {
+            qWarning() << "Can't open temporary file for undo history:" << spillFile->errorString();
+        }
+    }
+    return spillFile->isOpen() ? spillFile.data() : nullptr;
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+VUndoPayload::VUndoPayload(const QByteArray &data)
+    : m_serial(nextSerial++)
+{
+    SetData(data);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VUndoPayload::~VUndoPayload()
+{
+    Release();
+    payloads.remove(m_serial);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QByteArray VUndoPayload::Data() const
+{
+    switch (m_state)
+    {
+        case State::Compressed:
+            return qUncompress(m_data);
+        case State::Spilled:
+        {
+            QTemporaryFile *file = SpillFile();
+            SCASSERT(file != nullptr)
+            if (file->seek(m_offset))
+            {
+                return qUncompress(file->read(m_spilledSize));
+            }
+            qWarning() << "Can't read undo history from temporary file:" << file->errorString();
+            return QByteArray();
+        }
+        case State::Plain:
+        default:
+            return m_data;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VUndoPayload::SetData(const QByteArray &data)
+{
+    Release();
+    m_data = data;
+    m_state = State::Plain;
+    memoryUsage += m_data.size();
+
+    // Newer data goes to the end of the queue
+    payloads.remove(m_serial);
+    m_serial = nextSerial++;
+    payloads.insert(m_serial, this);
+
+    EnforceBudget();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+qint64 VUndoPayload::Budget()
+{
+    return budget;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VUndoPayload::SetBudget(qint64 bytes)
+{
+    budget = bytes;
+    EnforceBudget();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MemoryUsage return how much memory payloads take now, spilled payloads are not counted.
+ */
+qint64 VUndoPayload::MemoryUsage()
+{
+    return memoryUsage;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SpillFileSize return size of the temporary file, including space of released payloads.
+ */
+qint64 VUndoPayload::SpillFileSize()
+{
+    return spillFile.isNull() ? 0 : spillFile->size();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VUndoPayload::Release()
+{
+    const bool spilled = m_state == State::Spilled;
+    if (spilled)
+    {
+        --spilledCount;
+        spilledSize -= m_spilledSize;
+    }
+    else
+    {
+        memoryUsage -= m_data.size();
+    }
+
+    m_data.clear();
+    m_state = State::Plain;
+    m_offset = -1;
+    m_spilledSize = 0;
+
+    if (spilled && not spillFile.isNull())
+    {
+        if (spilledCount == 0)
+        {
+            // Nothing left in the file, reuse it from the beginning
+            spillFile->resize(0);
+        }
+        else if (spillFile->size() > minCompactSize && spillFile->size() > 2 * spilledSize)
+        {
+            CompactSpillFile();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VUndoPayload::Compress()
+{
+    if (m_state != State::Plain || m_data.size() < minCompressSize)
+    {
+        return false;
+    }
+
+    const QByteArray compressed = qCompress(m_data);
+    if (compressed.size() >= m_data.size())
+    {
+        return false;
+    }
+
+    memoryUsage -= m_data.size() - compressed.size();
+    m_data = compressed;
+    m_state = State::Compressed;
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VUndoPayload::Spill()
+{
+    if (m_state == State::Spilled || m_data.isEmpty())
+    {
+        return false;
+    }
+
+    QTemporaryFile *file = SpillFile();
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    const QByteArray compressed = m_state == State::Compressed ? m_data : qCompress(m_data);
+    const qint64 offset = file->size();
+    if (not file->seek(offset) || file->write(compressed) != compressed.size())
+    {
+        qWarning() << "Can't write undo history to temporary file:" << file->errorString();
+        return false;
+    }
+
+    memoryUsage -= m_data.size();
+    m_data.clear();
+    m_offset = offset;
+    m_spilledSize = compressed.size();
+    m_state = State::Spilled;
+    ++spilledCount;
+    spilledSize += m_spilledSize;
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VUndoPayload::EnforceBudget()
+{
+    if (memoryUsage <= budget || payloads.size() < 2)
+    {
+        return;
+    }
+
+    // The newest payload belongs to the command the user most likely undoes next, leave it as is
+    auto newest = payloads.constEnd();
+    --newest;
+
+    for (auto i = payloads.constBegin(); i != newest && memoryUsage > budget; ++i)
+    {
+        i.value()->Compress();
+    }
+
+    for (auto i = payloads.constBegin(); i != newest && memoryUsage > budget; ++i)
+    {
+        i.value()->Spill();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CompactSpillFile copy spilled payloads that are still alive to a new temporary file. If something goes wrong
+ * the old file stays in use.
+ */
+void VUndoPayload::CompactSpillFile()
+{
+    QScopedPointer<QTemporaryFile> compacted(new QTemporaryFile());
+    if (not compacted->open())
+    {
+        qWarning() << "Can't open temporary file for undo history:" << compacted->errorString();
+        return;
+    }
+
+    QVector<QPair<VUndoPayload *, qint64>> offsets;
+    offsets.reserve(spilledCount);
+
+    for (auto payload : qAsConst(payloads))
+    {
+        if (payload->m_state != State::Spilled)
+        {
+            continue;
+        }
+
+        if (not spillFile->seek(payload->m_offset))
+        {
+            qWarning() << "Can't read undo history from temporary file:" << spillFile->errorString();
+            return;
+        }
+
+        const QByteArray chunk = spillFile->read(payload->m_spilledSize);
+        const qint64 offset = compacted->pos();
+        if (chunk.size() != payload->m_spilledSize || compacted->write(chunk) != chunk.size())
+        {
+            qWarning() << "Can't compact temporary file for undo history.";
+            return;
+        }
+        offsets.append(qMakePair(payload, offset));
+    }
+
+    for (auto &offset : offsets)
+    {
+        offset.first->m_offset = offset.second;
+    }
+    spillFile.swap(compacted);
+}
@@ -0,0 +1,75 @@
+/************************************************************************
+ **
+ **  @file   vundopayload.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VUNDOPAYLOAD_H
+#define VUNDOPAYLOAD_H
+
+#include <QByteArray>
+#include <QtGlobal>
+
+/**
+ * @brief The VUndoPayload class bulky data of an undo command kept under a common memory budget.
+ *
+ * Payloads are ordered by creation. When the budget is exceeded the oldest payloads are compressed first, if that is
+ * not enough they are moved to a temporary file. Data() always returns the original bytes, only slower for old
+ * commands. The temporary file is compacted when most of it belongs to released payloads.
+ */
+class VUndoPayload
+{
+public:
+    explicit VUndoPayload(const QByteArray &data = QByteArray());
+    ~VUndoPayload();
+
+    QByteArray Data() const;
+    void       SetData(const QByteArray &data);
+
+    static qint64 Budget();
+    static void   SetBudget(qint64 bytes);
+    static qint64 MemoryUsage();
+    static qint64 SpillFileSize();
+
+private:
+    Q_DISABLE_COPY(VUndoPayload)
+
+    enum class State : qint8 {Plain, Compressed, Spilled};
+
+    quint64    m_serial;
+    QByteArray m_data{};
+    State      m_state{State::Plain};
+    qint64     m_offset{-1};
+    qint64     m_spilledSize{0};
+
+    void Release();
+    bool Compress();
+    bool Spill();
+
+    static void EnforceBudget();
+    static void CompactSpillFile();
+};
+
+#endif // VUNDOPAYLOAD_H
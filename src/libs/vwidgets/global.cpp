@@ -29,6 +29,7 @@
 #include "global.h"
 #include "../vmisc/def.h"
 #include "../vmisc/vabstractapplication.h"
+#include "vmaingraphicsscene.h"
 
 #include <QGraphicsItem>
 #include <QGraphicsScene>
@@ -59,6 +60,58 @@ qreal SceneScale(QGraphicsScene *scene)
     return scale;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+bool VSceneRenderSettings::LabelsVisible() const
+{
+    return not hideLabels && labelFontSize*scale >= minVisibleFontSize;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool operator==(const VSceneRenderSettings &lhs, const VSceneRenderSettings &rhs)
+{
+    return VFuzzyComparePossibleNulls(lhs.scale, rhs.scale)
+            && VFuzzyComparePossibleNulls(lhs.widthMainLine, rhs.widthMainLine)
+            && VFuzzyComparePossibleNulls(lhs.widthHairLine, rhs.widthHairLine)
+            && lhs.labelFontSize == rhs.labelFontSize
+            && lhs.hideLabels == rhs.hideLabels;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool operator!=(const VSceneRenderSettings &lhs, const VSceneRenderSettings &rhs)
+{
+    return not (lhs == rhs);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MakeSceneRenderSettings collect fresh render settings for the scene.
+ */
+VSceneRenderSettings MakeSceneRenderSettings(QGraphicsScene *scene)
+{
+    VCommonSettings *settings = qApp->Settings();
+
+    VSceneRenderSettings renderSettings;
+    renderSettings.scale = SceneScale(scene);
+    renderSettings.widthMainLine = settings->WidthMainLine();
+    renderSettings.widthHairLine = settings->WidthHairLine();
+    renderSettings.labelFontSize = settings->GetLabelFontSize();
+    renderSettings.hideLabels = settings->GetHideLabels();
+    return renderSettings;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SceneRenderSettings return render settings cached by the main scene. Other scenes get a fresh snapshot.
+ */
+VSceneRenderSettings SceneRenderSettings(QGraphicsScene *scene)
+{
+    if (auto *mainScene = qobject_cast<VMainGraphicsScene *>(scene))
+    {
+        return mainScene->RenderSettings();
+    }
+    return MakeSceneRenderSettings(scene);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QColor CorrectColor(const QGraphicsItem *item, const QColor &color)
 {
@@ -48,6 +48,39 @@ bool IsSelectedByReleaseEvent(QGraphicsItem *item, QGraphicsSceneMouseEvent *eve
 
 qreal SceneScale(QGraphicsScene *scene);
 
+/**
+ * @brief The VSceneRenderSettings struct snapshot of everything scale dependent items need to prepare themselves for
+ * drawing. Items read it instead of asking the view and the settings on each repaint.
+ */
+struct VSceneRenderSettings
+{
+    qreal scale{1};
+    qreal widthMainLine{0};
+    qreal widthHairLine{0};
+    int   labelFontSize{0};
+    bool  hideLabels{false};
+
+    bool LabelsVisible() const;
+};
+
+bool operator==(const VSceneRenderSettings &lhs, const VSceneRenderSettings &rhs);
+bool operator!=(const VSceneRenderSettings &lhs, const VSceneRenderSettings &rhs);
+
+VSceneRenderSettings MakeSceneRenderSettings(QGraphicsScene *scene);
+VSceneRenderSettings SceneRenderSettings(QGraphicsScene *scene);
+
+/**
+ * @brief The VSceneRenderItem class interface for items that keep pens, sizes and labels in sync with the scene scale.
+ *
+ * UpdateRenderSettings is called once per zoom or settings change, paint() must only draw.
+ */
+class VSceneRenderItem
+{
+public:
+    virtual ~VSceneRenderItem() = default;
+    virtual void UpdateRenderSettings(const VSceneRenderSettings &settings) =0;
+};
+
 QColor CorrectColor(const QGraphicsItem *item, const QColor &color);
 
 QRectF PointRect(qreal radius);
@@ -93,18 +93,24 @@ VControlPointSpline::VControlPointSpline(const qint32 &indexSpline, SplinePointP
 
 //---------------------------------------------------------------------------------------------------------------------
 void VControlPointSpline::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+{
+    VScenePoint::paint(painter, option, widget);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VControlPointSpline::UpdateRenderSettings(const VSceneRenderSettings &settings)
 {
     QPen lPen = controlLine->pen();
-    lPen.setColor(CorrectColor(controlLine, Qt::black));
+    lPen.setColor(CorrectColor(this, Qt::black));
     controlLine->setPen(lPen);
 
     QPointF p1, p2;
-    VGObject::LineIntersectCircle(QPointF(), ScaledRadius(SceneScale(scene())),
+    VGObject::LineIntersectCircle(QPointF(), ScaledRadius(settings.scale),
                                   QLineF( QPointF(), controlLine->line().p1()), p1, p2);
     QLineF line(controlLine->line().p1(), p1);
     controlLine->setLine(line);
 
-    VScenePoint::paint(painter, option, widget);
+    VScenePoint::UpdateRenderSettings(settings);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -235,7 +241,6 @@ void VControlPointSpline::contextMenuEvent(QGraphicsSceneContextMenuEvent *event
 void VControlPointSpline::Init()
 {
     m_baseColor = Qt::red;
-    SetOnlyPoint(true);
     this->setBrush(QBrush(Qt::NoBrush));
     this->setZValue(100);
 
@@ -243,6 +248,8 @@ void VControlPointSpline::Init()
     controlLine->SetBoldLine(false);
     //controlLine->setFlag(QGraphicsItem::ItemStacksBehindParent, true);
     controlLine->setVisible(false);
+
+    SetOnlyPoint(true);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -60,6 +60,7 @@ public:
 
     virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                        QWidget *widget = nullptr) override;
+    virtual void UpdateRenderSettings(const VSceneRenderSettings &settings) override;
 signals:
     /**
      * @brief ControlPointChangePosition emit when control point change position.
@@ -75,9 +75,11 @@ void VCurvePathItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *op
 {
     ScalePenWidth();
 
-    const QPainterPath arrowsPath = VAbstractCurve::ShowDirection(m_directionArrows,
-                                                                 ScaleWidth(VAbstractCurve::LengthCurveDirectionArrow(),
-                                                                             SceneScale(scene())));
+    const qreal lod = ItemLevelOfDetail(painter);
+    const qreal arrowLength = ScaleWidth(VAbstractCurve::LengthCurveDirectionArrow(), SceneScale(scene()));
+    const QPainterPath arrowsPath = IsSubPixel(arrowLength, lod) ? QPainterPath()
+                                                                 : VAbstractCurve::ShowDirection(m_directionArrows,
+                                                                                                 arrowLength);
 
     if (arrowsPath != QPainterPath())
     {
@@ -93,7 +95,7 @@ void VCurvePathItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *op
         painter->restore();
     }
 
-    PaintWithFixItemHighlightSelected<QGraphicsPathItem>(this, painter, option, widget);
+    PaintPathWithLevelOfDetail(this, m_levelOfDetail, lod, painter, option, widget);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
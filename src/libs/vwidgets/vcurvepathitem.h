@@ -33,6 +33,7 @@
 #include <QtGlobal>
 
 #include "../vmisc/def.h"
+#include "vlevelofdetail.h"
 
 class VCurvePathItem : public QGraphicsPathItem
 {
@@ -59,6 +60,7 @@ private:
     QVector<QPair<QLineF, QLineF>> m_directionArrows;
     QVector<QPointF> m_points;
     qreal m_defaultWidth;
+    VPathLevelOfDetail m_levelOfDetail{};
 };
 
 #endif // VCURVEPATHITEM_H
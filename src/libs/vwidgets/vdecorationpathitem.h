@@ -0,0 +1,56 @@
+/************************************************************************
+ **
+ **  @file   vdecorationpathitem.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VDECORATIONPATHITEM_H
+#define VDECORATIONPATHITEM_H
+
+#include <QGraphicsPathItem>
+#include <QtGlobal>
+
+#include "vlevelofdetail.h"
+
+/**
+ * @brief The VDecorationPathItem class path of small marks (passmarks, place labels) that are not worth drawing once
+ * they get smaller than a pixel.
+ */
+class VDecorationPathItem : public QGraphicsPathItem
+{
+public:
+    explicit VDecorationPathItem(QGraphicsItem *parent = nullptr);
+    virtual ~VDecorationPathItem() = default;
+
+    virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
+                       QWidget *widget = nullptr) override;
+
+private:
+    Q_DISABLE_COPY(VDecorationPathItem)
+
+    VPathLevelOfDetail m_levelOfDetail{};
+};
+
+#endif // VDECORATIONPATHITEM_H
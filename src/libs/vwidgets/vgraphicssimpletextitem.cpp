@@ -82,43 +82,41 @@ VGraphicsSimpleTextItem::VGraphicsSimpleTextItem( const QString & text, QGraphic
 //---------------------------------------------------------------------------------------------------------------------
 void VGraphicsSimpleTextItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    auto UpdateLine = [this]()
-    {
-        if (VScenePoint *parent = dynamic_cast<VScenePoint *>(parentItem()))
-        {
-            parent->RefreshLine();
-        }
-    };
+    PaintWithFixItemHighlightSelected<QGraphicsSimpleTextItem>(this, painter, option, widget);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief UpdateRenderSettings apply label font size and keep the label the same size on screen for any zoom.
+ */
+void VGraphicsSimpleTextItem::UpdateRenderSettings(const VSceneRenderSettings &settings)
+{
+    bool changed = false;
 
     QFont font = this->font();
-    if (font.pointSize() != qApp->Settings()->GetLabelFontSize())
+    if (font.pointSize() != settings.labelFontSize)
     {
-        font.setPointSize(qApp->Settings()->GetLabelFontSize());
+        font.setPointSize(settings.labelFontSize);
         setFont(font);
+        changed = true;
     }
 
-    QGraphicsScene *scene = this->scene();
-    const qreal scale = SceneScale(scene);
-    if (scale > 1 && not VFuzzyComparePossibleNulls(m_oldScale, scale))
+    const qreal scale = qMax(1.0, settings.scale);
+    if (not VFuzzyComparePossibleNulls(m_oldScale, scale))
     {
-        setScale(1/scale);
-        CorrectLabelPosition();
-        UpdateLine();
         m_oldScale = scale;
-    }
-    else if (scale <= 1 && not VFuzzyComparePossibleNulls(m_oldScale, 1.0))
-    {
-        setScale(1);
+        setScale(1/scale);
         CorrectLabelPosition();
-        UpdateLine();
-        m_oldScale = 1;
+        changed = true;
     }
 
-    if (QGraphicsView *view = scene->views().at(0))
+    if (changed)
     {
-        VMainGraphicsView::NewSceneRect(scene, view, this);
+        if (VScenePoint *parent = dynamic_cast<VScenePoint *>(parentItem()))
+        {
+            parent->RefreshLine();
+        }
     }
-    PaintWithFixItemHighlightSelected<QGraphicsSimpleTextItem>(this, painter, option, widget);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -160,13 +158,12 @@ void VGraphicsSimpleTextItem::SetRealPos(QPointF pos)
 //---------------------------------------------------------------------------------------------------------------------
 void VGraphicsSimpleTextItem::CorrectLabelPosition()
 {
-    const qreal scale = SceneScale(scene());
     QPointF newPos = m_realPos;
 
-    if (scale > 1)
+    if (m_oldScale > 1)
     {
         QLineF line(m_destination, m_realPos);
-        line.setLength(line.length() / scale);
+        line.setLength(line.length() / m_oldScale);
         newPos = line.p2();
     }
 
@@ -175,6 +172,15 @@ void VGraphicsSimpleTextItem::CorrectLabelPosition()
     setPos(newPos);
     setFlag(QGraphicsItem::ItemSendsGeometryChanges, true);
     blockSignals(false);
+
+    if (QGraphicsScene *scene = this->scene())
+    {
+        const QList<QGraphicsView *> viewList = scene->views();
+        if (not viewList.isEmpty())
+        {
+            VMainGraphicsView::NewSceneRect(scene, viewList.first(), this);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -224,6 +230,17 @@ QVariant VGraphicsSimpleTextItem::itemChange(GraphicsItemChange change, const QV
          setFlag(QGraphicsItem::ItemIsFocusable, value.toBool());
          emit PointSelected(value.toBool());
      }
+     if (change == QGraphicsItem::ItemPositionHasChanged)
+     {
+         if (VScenePoint *parent = dynamic_cast<VScenePoint *>(parentItem()))
+         {
+             parent->RefreshLine();
+         }
+     }
+     if (change == QGraphicsItem::ItemSceneHasChanged)
+     {
+         UpdateRenderSettings(SceneRenderSettings(scene()));
+     }
      return QGraphicsSimpleTextItem::itemChange(change, value);
 }
 
@@ -40,11 +40,12 @@
 #include <QtGlobal>
 
 #include "../vmisc/def.h"
+#include "global.h"
 
 /**
  * @brief The VGraphicsSimpleTextItem class pointer label.
  */
-class VGraphicsSimpleTextItem : public QObject, public QGraphicsSimpleTextItem
+class VGraphicsSimpleTextItem : public QObject, public QGraphicsSimpleTextItem, public VSceneRenderItem
 {
     Q_OBJECT
 public:
@@ -57,6 +58,7 @@ public:
 
     virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                        QWidget *widget = nullptr) override;
+    virtual void UpdateRenderSettings(const VSceneRenderSettings &settings) override;
 
     void setEnabled(bool enabled);
     void LabelSelectionType(const SelectionType &type);
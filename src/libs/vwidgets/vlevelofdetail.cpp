@@ -0,0 +1,229 @@
+/************************************************************************
+ **
+ **  @file   vlevelofdetail.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "vlevelofdetail.h"
+#include "../vmisc/def.h"
+
+#include <QRectF>
+#include <QtMath>
+#include <cmath>
+
+namespace
+{
+// Zooming out more than 2^12 times changes nothing visible anymore.
+const int maxBucket = 12;
+
+//---------------------------------------------------------------------------------------------------------------------
+inline qreal SquaredDistance(const QPointF &p1, const QPointF &p2)
+{
+    const QPointF d = p2 - p1;
+    return QPointF::dotProduct(d, d);
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ItemLevelOfDetail return how many device pixels take one unit of item coordinates.
+ */
+qreal ItemLevelOfDetail(const QPainter *painter)
+{
+    SCASSERT(painter != nullptr)
+    return QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsSubPixel check if a detail of this size takes less than one device pixel. Never true at 100% zoom and
+ * above.
+ */
+bool IsSubPixel(qreal size, qreal lod)
+{
+    return lod < 1 && size * lod < 1;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief DecimatePath drop line points closer than tolerance to the previous kept point.
+ *
+ * The first and the last point of each subpath and all curve segments are kept, so subpaths never change their ends.
+ */
+QPainterPath DecimatePath(const QPainterPath &path, qreal tolerance)
+{
+    QPainterPath simplified;
+    simplified.setFillRule(path.fillRule());
+
+    const qreal squaredTolerance = tolerance * tolerance;
+    QPointF last;
+    QPointF skipped;
+    bool hasSkipped = false;
+
+    auto FlushSkipped = [&simplified, &skipped, &hasSkipped]()
+    {
+        if (hasSkipped)
+        {
+            simplified.lineTo(skipped);
+            hasSkipped = false;
+        }
+    };
+
+    for (int i = 0; i < path.elementCount(); ++i)
+    {
+        const QPainterPath::Element element = path.elementAt(i);
+        switch (element.type)
+        {
+            case QPainterPath::MoveToElement:
+                FlushSkipped();
+                simplified.moveTo(element);
+                last = element;
+                break;
+            case QPainterPath::LineToElement:
+                if (SquaredDistance(last, element) < squaredTolerance)
+                {
+                    skipped = element;
+                    hasSkipped = true;
+                }
+                else
+                {
+                    simplified.lineTo(element);
+                    last = element;
+                    hasSkipped = false;
+                }
+                break;
+            case QPainterPath::CurveToElement:
+                if (i + 2 < path.elementCount())
+                {
+                    FlushSkipped();
+                    const QPointF endPoint = path.elementAt(i + 2);
+                    simplified.cubicTo(element, path.elementAt(i + 1), endPoint);
+                    last = endPoint;
+                    i += 2;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    FlushSkipped();
+
+    return simplified;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VPathLevelOfDetail::Bucket(qreal lod)
+{
+    if (lod >= 1 || lod <= 0)
+    {
+        return 0;
+    }
+
+    return qBound(1, qCeil(-std::log2(lod)), maxBucket);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Path return the path to draw for this level of detail.
+ *
+ * Simplification error stays under half of a device pixel for the whole bucket.
+ */
+const QPainterPath &VPathLevelOfDetail::Path(const QPainterPath &path, qreal lod)
+{
+    Sync(path);
+
+    const int bucket = Bucket(lod);
+    if (bucket == 0)
+    {
+        return m_source;
+    }
+
+    if (m_variants.isEmpty())
+    {
+        m_variants.resize(maxBucket);
+    }
+
+    QPainterPath &variant = m_variants[bucket - 1];
+    if (variant.isEmpty() && not m_source.isEmpty())
+    {
+        // The largest lod of the bucket is 2^(1-bucket), half of a pixel there is 2^(bucket-2) item units.
+        variant = DecimatePath(m_source, qPow(2, bucket - 2));
+    }
+    return variant;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LargestSubpathSize return the biggest side of subpath bounding rects. Decoration paths are made of small
+ * independent marks, once the largest mark is sub-pixel the whole path can be skipped.
+ */
+qreal VPathLevelOfDetail::LargestSubpathSize(const QPainterPath &path)
+{
+    Sync(path);
+
+    if (m_largestSubpathSize < 0)
+    {
+        m_largestSubpathSize = 0;
+        QRectF subpathRect;
+
+        auto UpdateSize = [this, &subpathRect]()
+        {
+            m_largestSubpathSize = qMax(m_largestSubpathSize, qMax(subpathRect.width(), subpathRect.height()));
+        };
+
+        for (int i = 0; i < m_source.elementCount(); ++i)
+        {
+            const QPainterPath::Element element = m_source.elementAt(i);
+            const QPointF point = element;
+            if (element.isMoveTo())
+            {
+                UpdateSize();
+                subpathRect = QRectF(point, point);
+            }
+            else
+            {
+                subpathRect.setLeft(qMin(subpathRect.left(), point.x()));
+                subpathRect.setRight(qMax(subpathRect.right(), point.x()));
+                subpathRect.setTop(qMin(subpathRect.top(), point.y()));
+                subpathRect.setBottom(qMax(subpathRect.bottom(), point.y()));
+            }
+        }
+        UpdateSize();
+    }
+
+    return m_largestSubpathSize;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VPathLevelOfDetail::Sync(const QPainterPath &path)
+{
+    if (not (m_source == path))
+    {
+        m_variants.clear();
+        m_largestSubpathSize = -1;
+    }
+    // Share data with the item path, next comparison is a pointer check
+    m_source = path;
+}
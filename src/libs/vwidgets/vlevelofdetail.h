@@ -0,0 +1,95 @@
+/************************************************************************
+ **
+ **  @file   vlevelofdetail.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef VLEVELOFDETAIL_H
+#define VLEVELOFDETAIL_H
+
+#include <QGraphicsPathItem>
+#include <QPainter>
+#include <QPainterPath>
+#include <QStyleOptionGraphicsItem>
+#include <QVector>
+#include <QtGlobal>
+
+#include "global.h"
+
+qreal ItemLevelOfDetail(const QPainter *painter);
+bool  IsSubPixel(qreal size, qreal lod);
+
+QPainterPath DecimatePath(const QPainterPath &path, qreal tolerance);
+
+/**
+ * @brief The VPathLevelOfDetail class keeps simplified variants of an item path for zoomed out views.
+ *
+ * Level of detail is split in buckets by powers of two. Bucket 0 means 100% zoom and above and always returns the
+ * original path. Variants are dropped as soon as the item gets a different path.
+ */
+class VPathLevelOfDetail
+{
+public:
+    VPathLevelOfDetail() = default;
+
+    static int Bucket(qreal lod);
+
+    const QPainterPath &Path(const QPainterPath &path, qreal lod);
+    qreal               LargestSubpathSize(const QPainterPath &path);
+
+private:
+    Q_DISABLE_COPY(VPathLevelOfDetail)
+
+    QPainterPath          m_source{};
+    QVector<QPainterPath> m_variants{};
+    qreal                 m_largestSubpathSize{-1};
+
+    void Sync(const QPainterPath &path);
+};
+
+/* Same as QGraphicsPathItem::paint, but draws a simplified path when zoomed out.
+ * At 100% zoom and above the result is identical to PaintWithFixItemHighlightSelected.
+ */
+template<class Item>
+void PaintPathWithLevelOfDetail(Item *item, VPathLevelOfDetail &levelOfDetail, qreal lod, QPainter *painter,
+                                const QStyleOptionGraphicsItem *option, QWidget *widget)
+{
+    if (VPathLevelOfDetail::Bucket(lod) == 0)
+    {
+        PaintWithFixItemHighlightSelected<QGraphicsPathItem>(item, painter, option, widget);
+        return;
+    }
+
+    painter->setPen(item->pen());
+    painter->setBrush(item->brush());
+    painter->drawPath(levelOfDetail.Path(item->path(), lod));
+
+    if (option->state & QStyle::State_Selected)
+    {
+        GraphicsItemHighlightSelected(item->boundingRect(), item->pen().widthF(), painter, option);
+    }
+}
+
+#endif // VLEVELOFDETAIL_H
@@ -40,10 +40,21 @@
 #include <QStringData>
 #include <QStringDataPtr>
 #include <Qt>
+#include <functional>
 
 #include "global.h"
+#include "vmaingraphicsview.h"
 #include "../vmisc/vabstractapplication.h"
 
+namespace
+{
+// Scene coordinates no item can reach. Used to query everything outside of the cached rect.
+const qreal farAway = 1e9;
+
+// Precision of checking that an item still lies on the edge of the cached rect.
+const qreal edgeTolerance = 0.01;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief VMainGraphicsScene default constructor.
@@ -54,7 +65,8 @@ VMainGraphicsScene::VMainGraphicsScene(QObject *parent)
       verScrollBar(0),
       _transform(QTransform()),
       scenePos(QPointF()),
-      origins()
+      origins(),
+      m_renderSettings(MakeSceneRenderSettings(nullptr))
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -69,7 +81,8 @@ VMainGraphicsScene::VMainGraphicsScene(const QRectF & sceneRect, QObject * paren
       verScrollBar(0),
       _transform(QTransform()),
       scenePos(),
-      origins()
+      origins(),
+      m_renderSettings(MakeSceneRenderSettings(nullptr))
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -237,7 +250,38 @@ QPointF VMainGraphicsScene::getScenePos() const
 }
 
 //---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief VisibleItemsBoundingRect return bounding rect of all visible items.
+ *
+ * The rect is cached. The scene index is asked only about items outside of the cached rect and items on its edges,
+ * so adding, moving and showing items only grows the rect. Items are walked again only when an edge lost all its items.
+ *
+ * The scene is not notified about changes. QGraphicsScene::removeItem() is not virtual and item changes reach only
+ * the items, which are of many unrelated classes. Instead each call asks the BSP index at most eight times: four
+ * queries for areas outside the rect and four for thin strips along its edges, so only new items and items on the
+ * edges are visited.
+ */
 QRectF VMainGraphicsScene::VisibleItemsBoundingRect() const
+{
+    if (not m_visibleItemsRectValid || m_visibleItemsRect.isNull())
+    {
+        m_visibleItemsRect = CalcVisibleItemsBoundingRect();
+        m_visibleItemsRectValid = true;
+        return m_visibleItemsRect;
+    }
+
+    GrowVisibleItemsRect();
+
+    if (not IsVisibleItemsRectTight())
+    {
+        m_visibleItemsRect = CalcVisibleItemsBoundingRect();
+    }
+
+    return m_visibleItemsRect;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QRectF VMainGraphicsScene::CalcVisibleItemsBoundingRect() const
 {
     QRectF rect;
     const QList<QGraphicsItem *> qItems = items();
@@ -252,6 +296,110 @@ QRectF VMainGraphicsScene::VisibleItemsBoundingRect() const
     return rect;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GrowVisibleItemsRect unite the cached rect with visible items that are outside of it.
+ */
+void VMainGraphicsScene::GrowVisibleItemsRect() const
+{
+    const QRectF r = m_visibleItemsRect;
+    const QVector<QRectF> outside
+    {
+        QRectF(QPointF(-farAway, -farAway), QPointF(r.left(), farAway)), // left
+        QRectF(QPointF(r.right(), -farAway), QPointF(farAway, farAway)), // right
+        QRectF(QPointF(r.left(), -farAway), QPointF(r.right(), r.top())), // top
+        QRectF(QPointF(r.left(), r.bottom()), QPointF(r.right(), farAway)) // bottom
+    };
+
+    for (auto &area : outside)
+    {
+        const QList<QGraphicsItem *> qItems = items(area, Qt::IntersectsItemBoundingRect);
+        for (auto item : qItems)
+        {
+            if (item->isVisible())
+            {
+                const QRectF itemRect = item->sceneBoundingRect();
+                if (not m_visibleItemsRect.contains(itemRect))
+                {
+                    m_visibleItemsRect = m_visibleItemsRect.united(itemRect);
+                }
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsVisibleItemsRectTight check that each edge of the cached rect still touches at least one visible item.
+ *
+ * The cached rect always contains all visible items after growing. If one of its edges is not supported by an item
+ * some item on the edge has shrunk, moved inside, was hidden or removed.
+ */
+bool VMainGraphicsScene::IsVisibleItemsRectTight() const
+{
+    const QRectF r = m_visibleItemsRect;
+
+    auto EdgeSupported = [this](const QRectF &strip, const std::function<bool(const QRectF &)> &onEdge)
+    {
+        const QList<QGraphicsItem *> qItems = items(strip, Qt::IntersectsItemBoundingRect);
+        for (auto item : qItems)
+        {
+            if (item->isVisible() && onEdge(item->sceneBoundingRect()))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    const qreal t = edgeTolerance;
+
+    return EdgeSupported(QRectF(r.left() - t, r.top() - t, 2*t, r.height() + 2*t),
+                         [r, t](const QRectF &rect){return rect.left() <= r.left() + t;})
+            && EdgeSupported(QRectF(r.right() - t, r.top() - t, 2*t, r.height() + 2*t),
+                             [r, t](const QRectF &rect){return rect.right() >= r.right() - t;})
+            && EdgeSupported(QRectF(r.left() - t, r.top() - t, r.width() + 2*t, 2*t),
+                             [r, t](const QRectF &rect){return rect.top() <= r.top() + t;})
+            && EdgeSupported(QRectF(r.left() - t, r.bottom() - t, r.width() + 2*t, 2*t),
+                             [r, t](const QRectF &rect){return rect.bottom() >= r.bottom() - t;});
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief UpdateRenderSettings take a new render settings snapshot and, if it differs from the previous one, pass it to
+ * all scale dependent items. Call it after zooming or changing settings that affect drawing.
+ */
+void VMainGraphicsScene::UpdateRenderSettings()
+{
+    VSceneRenderSettings settings = MakeSceneRenderSettings(this);
+    if (views().isEmpty())
+    {
+        // Scene is not shown right now, use the transform saved for it
+        settings.scale = _transform.m11();
+    }
+
+    if (settings == m_renderSettings)
+    {
+        return;
+    }
+    m_renderSettings = settings;
+
+    const QList<QGraphicsItem *> qItems = items();
+    for (auto item : qItems)
+    {
+        if (auto *renderItem = dynamic_cast<VSceneRenderItem *>(item))
+        {
+            renderItem->UpdateRenderSettings(m_renderSettings);
+        }
+    }
+
+    const QList<QGraphicsView *> viewList = views();
+    if (not viewList.isEmpty())
+    {
+        VMainGraphicsView::NewSceneRect(this, viewList.first());
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief transform return view transformation.
@@ -41,6 +41,7 @@
 #include <QtGlobal>
 
 #include "../vmisc/def.h"
+#include "global.h"
 
 /**
  * @brief The VMainGraphicsScene class main scene.
@@ -67,6 +68,8 @@ public:
     bool          IsNonInteractive() const;
     void          SetNonInteractive(bool nonInteractive);
 
+    VSceneRenderSettings RenderSettings() const;
+
 public slots:
     void          ChoosedItem(quint32 id, const SceneObject &type);
     void          SelectedItem(bool selected, quint32 object, quint32 tool);
@@ -74,6 +77,7 @@ public slots:
     void          EnableDetailsMode(bool mode);
     void          ItemsSelection(const SelectionType &type);
     void          HighlightItem(quint32 id);
+    void          UpdateRenderSettings();
 
     void          ToggleLabelSelection(bool enabled);
     void          TogglePointSelection(bool enabled);
@@ -163,8 +167,25 @@ private:
 
     /** @brief m_nonInteractive all item on scene in non interactive. */
     bool          m_nonInteractive{false};
+
+    /** @brief m_renderSettings snapshot scale dependent items were last updated with. */
+    VSceneRenderSettings m_renderSettings;
+
+    /** @brief m_visibleItemsRect cached bounding rect of all visible items. */
+    mutable QRectF m_visibleItemsRect{};
+    mutable bool   m_visibleItemsRectValid{false};
+
+    QRectF        CalcVisibleItemsBoundingRect() const;
+    void          GrowVisibleItemsRect() const;
+    bool          IsVisibleItemsRectTight() const;
 };
 
+//---------------------------------------------------------------------------------------------------------------------
+inline VSceneRenderSettings VMainGraphicsScene::RenderSettings() const
+{
+    return m_renderSettings;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief getHorScrollBar return scene horizontal scrollbar.
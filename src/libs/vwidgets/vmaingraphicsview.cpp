@@ -448,6 +448,15 @@ VMainGraphicsView::VMainGraphicsView(QWidget *parent)
     SetAntialiasing(true);
 
     connect(zoom, &GraphicsViewZoom::zoomed, this,  [this](){emit ScaleChanged(transform().m11());});
+
+    // Scale dependent items are updated once per zoom step instead of on each repaint
+    connect(this, &VMainGraphicsView::ScaleChanged, this, [this]()
+    {
+        if (VMainGraphicsScene *currentScene = qobject_cast<VMainGraphicsScene *>(scene()))
+        {
+            currentScene->UpdateRenderSettings();
+        }
+    });
 }
 
 //---------------------------------------------------------------------------------------------------------------------
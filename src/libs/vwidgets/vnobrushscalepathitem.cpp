@@ -70,5 +70,5 @@ void VNoBrushScalePathItem::paint(QPainter *painter, const QStyleOptionGraphicsI
     toolPen.setWidthF(ScaleWidth(m_defaultWidth, SceneScale(scene())));
     setPen(toolPen);
 
-    PaintWithFixItemHighlightSelected<QGraphicsPathItem>(this, painter, option, widget);
+    PaintPathWithLevelOfDetail(this, m_levelOfDetail, ItemLevelOfDetail(painter), painter, option, widget);
 }
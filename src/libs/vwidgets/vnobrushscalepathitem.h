@@ -34,6 +34,7 @@
 #include <QtGlobal>
 
 #include "../vmisc/def.h"
+#include "vlevelofdetail.h"
 
 class VNoBrushScalePathItem : public QGraphicsPathItem
 {
@@ -52,6 +53,7 @@ protected:
 private:
     Q_DISABLE_COPY(VNoBrushScalePathItem)
     qreal m_defaultWidth;
+    VPathLevelOfDetail m_levelOfDetail{};
 };
 
 #endif // VNOBRUSHSCALEPATHITEM_H
@@ -33,6 +33,7 @@
 #include "global.h"
 #include "vgraphicssimpletextitem.h"
 #include "scalesceneitems.h"
+#include "vlevelofdetail.h"
 
 #include <QBrush>
 #include <QFont>
@@ -64,33 +65,42 @@ VScenePoint::VScenePoint(QGraphicsItem *parent)
 //---------------------------------------------------------------------------------------------------------------------
 void VScenePoint::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    const qreal scale = SceneScale(scene());
-
-    if (qApp->Settings()->GetLabelFontSize()*scale < minVisibleFontSize || qApp->Settings()->GetHideLabels())
+    // Zoomed out so far that the circle is smaller than a pixel, the shape is given by lines and curves
+    if (IsSubPixel(rect().width(), ItemLevelOfDetail(painter)))
     {
-        m_namePoint->setVisible(false);
-        m_lineName->setVisible(false);
+        return;
     }
-    else
-    {
-        ScaleMainPenWidth(scale);
-        ScaleCircleSize(this, scale);
 
-        if (not m_onlyPoint)
-        {
-            m_namePoint->setVisible(m_showLabel);
+    PaintWithFixItemHighlightSelected<QGraphicsEllipseItem>(this, painter, option, widget);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief UpdateRenderSettings scale pen, circle and label for the current zoom and decide if the label is visible.
+ */
+void VScenePoint::UpdateRenderSettings(const VSceneRenderSettings &settings)
+{
+    ScaleMainPenWidth(settings);
+    ScaleCircleSize(this, settings.scale);
 
-            QPen lPen = m_lineName->pen();
-            QColor color = CorrectColor(m_lineName, Qt::black);
-            color.setAlpha(50);
-            lPen.setColor(color);
-            m_lineName->setPen(lPen);
+    if (not m_onlyPoint && settings.LabelsVisible())
+    {
+        m_namePoint->UpdateRenderSettings(settings);
+        m_namePoint->setVisible(m_showLabel);
 
-            RefreshLine();
-        }
-    }
+        QPen lPen = m_lineName->pen();
+        QColor color = CorrectColor(this, Qt::black);
+        color.setAlpha(50);
+        lPen.setColor(color);
+        m_lineName->setPen(lPen);
 
-    PaintWithFixItemHighlightSelected<QGraphicsEllipseItem>(this, painter, option, widget);
+        RefreshLine();
+    }
+    else
+    {
+        m_namePoint->setVisible(false);
+        m_lineName->setVisible(false);
+    }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -109,17 +119,15 @@ void VScenePoint::RefreshPointGeometry(const VPointF &point)
     m_namePoint->blockSignals(false);
 
     m_namePoint->setText(point.name());
-    m_namePoint->setVisible(m_showLabel);
 
-    RefreshLine();
+    ApplyRenderSettings();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VScenePoint::SetOnlyPoint(bool value)
 {
     m_onlyPoint = value;
-    m_namePoint->setVisible(not m_onlyPoint);
-    m_lineName->setVisible(not m_onlyPoint);
+    ApplyRenderSettings();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -128,10 +136,26 @@ bool VScenePoint::IsOnlyPoint() const
     return m_onlyPoint;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void VScenePoint::ApplyRenderSettings()
+{
+    UpdateRenderSettings(SceneRenderSettings(scene()));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RefreshPen update only the pen, enough after hover and color changes.
+ */
+void VScenePoint::RefreshPen()
+{
+    ScaleMainPenWidth(SceneRenderSettings(scene()));
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VScenePoint::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
 {
     m_isHovered = true;
+    RefreshPen();
     QGraphicsEllipseItem::hoverEnterEvent(event);
 }
 
@@ -139,12 +163,29 @@ void VScenePoint::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
 void VScenePoint::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
 {
     m_isHovered = false;
+    RefreshPen();
     QGraphicsEllipseItem::hoverLeaveEvent(event);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+QVariant VScenePoint::itemChange(QGraphicsItem::GraphicsItemChange change, const QVariant &value)
+{
+    if (change == QGraphicsItem::ItemSceneHasChanged || change == QGraphicsItem::ItemEnabledHasChanged)
+    {
+        ApplyRenderSettings();
+    }
+    return QGraphicsEllipseItem::itemChange(change, value);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VScenePoint::RefreshLine()
 {
+    if (not m_namePoint->isVisibleTo(this))
+    {
+        m_lineName->setVisible(false);
+        return;
+    }
+
     QRectF nRec = m_namePoint->sceneBoundingRect();
     nRec.translate(- scenePos());
     if (not rect().intersects(nRec))
@@ -173,10 +214,9 @@ void VScenePoint::RefreshLine()
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void VScenePoint::ScaleMainPenWidth(qreal scale)
+void VScenePoint::ScaleMainPenWidth(const VSceneRenderSettings &settings)
 {
-    const qreal width = ScaleWidth(m_isHovered ? qApp->Settings()->WidthMainLine() : qApp->Settings()->WidthHairLine(),
-                                   scale);
+    const qreal width = ScaleWidth(m_isHovered ? settings.widthMainLine : settings.widthHairLine, settings.scale);
 
     setPen(QPen(CorrectColor(this, m_baseColor), width));
 }
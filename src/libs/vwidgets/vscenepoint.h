@@ -33,12 +33,13 @@
 #include <QGraphicsEllipseItem>
 
 #include "../vmisc/def.h"
+#include "global.h"
 
 class VGraphicsSimpleTextItem;
 class VPointF;
 class VScaledLine;
 
-class VScenePoint: public QGraphicsEllipseItem
+class VScenePoint: public QGraphicsEllipseItem, public VSceneRenderItem
 {
 public:
     explicit VScenePoint(QGraphicsItem *parent = nullptr);
@@ -50,6 +51,7 @@ public:
     virtual void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
                        QWidget *widget = nullptr) override;
     virtual void RefreshPointGeometry(const VPointF &point);
+    virtual void UpdateRenderSettings(const VSceneRenderSettings &settings) override;
 
     void RefreshLine();
 
@@ -71,13 +73,17 @@ protected:
 
     virtual void hoverEnterEvent(QGraphicsSceneHoverEvent *event) override;
     virtual void hoverLeaveEvent(QGraphicsSceneHoverEvent *event) override;
+    virtual QVariant itemChange(GraphicsItemChange change, const QVariant &value) override;
 
     void SetOnlyPoint(bool value);
     bool IsOnlyPoint() const;
+
+    void ApplyRenderSettings();
+    void RefreshPen();
 private:
     Q_DISABLE_COPY(VScenePoint)
 
-    void ScaleMainPenWidth(qreal scale);
+    void ScaleMainPenWidth(const VSceneRenderSettings &settings);
 };
 
 #endif // VSCENEPOINT_H
@@ -80,6 +80,7 @@ void VSimplePoint::SetPointHighlight(bool value)
 {
     m_alwaysHovered = value;
     m_isHovered = value;
+    RefreshPen();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -188,6 +189,7 @@ void VSimplePoint::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
 void VSimplePoint::hoverEnterEvent(QGraphicsSceneHoverEvent *event)
 {
     m_isHovered = true;
+    RefreshPen();
     QGraphicsEllipseItem::hoverEnterEvent(event);
 }
 
@@ -197,6 +199,7 @@ void VSimplePoint::hoverLeaveEvent(QGraphicsSceneHoverEvent *event)
     if (not m_alwaysHovered)
     {
         m_isHovered = false;
+        RefreshPen();
     }
     QGraphicsEllipseItem::hoverLeaveEvent(event);
 }
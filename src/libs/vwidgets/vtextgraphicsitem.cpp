@@ -42,6 +42,7 @@
 #include "../vmisc/def.h"
 #include "../vmisc/vmath.h"
 #include "vtextgraphicsitem.h"
+#include "vlevelofdetail.h"
 
 const qreal resizeSquare = (3./*mm*/ / 25.4) * PrintDPI;
 const qreal rotateCircle = (2./*mm*/ / 25.4) * PrintDPI;
@@ -157,9 +158,10 @@ void VTextGraphicsItem::paint(QPainter *painter, const QStyleOptionGraphicsItem
     painter->setPen(Qt::black);
     QFont fnt = m_tm.GetFont();
     int iW = qFloor(boundingRect().width());
-    // draw text lines
+    // draw text lines, text smaller than a pixel is only noise
+    const int linesCount = IsSubPixel(fnt.pixelSize(), ItemLevelOfDetail(painter)) ? 0 : m_tm.GetSourceLinesCount();
     int iY = 0;
-    for (int i = 0; i < m_tm.GetSourceLinesCount(); ++i)
+    for (int i = 0; i < linesCount; ++i)
     {
         const TextLine& tl = m_tm.GetSourceLine(i);
 
@@ -26,7 +26,9 @@ SOURCES += \
     $$PWD/scalesceneitems.cpp \
     $$PWD/vlineedit.cpp \
     $$PWD/vplaintextedit.cpp \
-    $$PWD/vhighlighter.cpp
+    $$PWD/vhighlighter.cpp \
+    $$PWD/vlevelofdetail.cpp \
+    $$PWD/vdecorationpathitem.cpp
 
 *msvc*:SOURCES += $$PWD/stable.cpp
 
@@ -56,4 +58,6 @@ HEADERS += \
     $$PWD/scalesceneitems.h \
     $$PWD/vlineedit.h \
     $$PWD/vplaintextedit.h \
-    $$PWD/vhighlighter.h
+    $$PWD/vhighlighter.h \
+    $$PWD/vlevelofdetail.h \
+    $$PWD/vdecorationpathitem.h
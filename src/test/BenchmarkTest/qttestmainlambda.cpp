@@ -0,0 +1,101 @@
+/************************************************************************
+ **
+ **  @file   qttestmainlambda.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include <QtTest>
+
+#include "tst_vgeometrybenchmark.h"
+#include "tst_vabstractpiecebenchmark.h"
+#include "tst_qmuparserbenchmark.h"
+
+#include "../vmisc/testvapplication.h"
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BenchmarkArguments give each test class its own output file.
+ *
+ * QTest overwrites the output file of -o file,format on each call of qExec. Add the class name to the file name, so
+ * results.xml becomes results_TST_VGeometryBenchmark.xml.
+ */
+QStringList BenchmarkArguments(const QStringList &arguments, const QObject *obj)
+{
+    QStringList benchmarkArguments = arguments;
+    for (int i = 1; i < benchmarkArguments.size() - 1; ++i)
+    {
+        if (benchmarkArguments.at(i) == QLatin1String("-o"))
+        {
+            QString &output = benchmarkArguments[++i];
+            const int formatPosition = output.lastIndexOf(QChar(','));
+            const QString file = formatPosition < 0 ? output : output.left(formatPosition);
+            if (file == QLatin1String("-"))
+            {
+                continue; // stdout
+            }
+
+            const QFileInfo info(file);
+            QString name = info.completeBaseName() + QChar('_') + QString::fromLatin1(obj->metaObject()->className());
+            if (not info.suffix().isEmpty())
+            {
+                name += QChar('.') + info.suffix();
+            }
+            output.replace(0, file.size(), info.dir().filePath(name));
+        }
+    }
+    return benchmarkArguments;
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+    // Build machines have no display
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    TestVApplication app( argc, argv );
+
+    QResource::registerResource(QCoreApplication::applicationDirPath() + QStringLiteral("/test_data.rcc"));
+
+    const QStringList arguments = QCoreApplication::arguments();
+
+    int status = 0;
+    auto ASSERT_TEST = [&status, arguments](QObject* obj)
+    {
+        status |= QTest::qExec(obj, BenchmarkArguments(arguments, obj));
+        delete obj;
+    };
+
+    ASSERT_TEST(new TST_VGeometryBenchmark());
+    ASSERT_TEST(new TST_VAbstractPieceBenchmark());
+    ASSERT_TEST(new TST_QmuParserBenchmark());
+
+    return status;
+}
@@ -0,0 +1,145 @@
+/************************************************************************
+ **
+ **  @file   tst_qmuparserbenchmark.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_qmuparserbenchmark.h"
+#include "../vmisc/def.h"
+#include "../vpatterndb/calculator.h"
+#include "../vpatterndb/vcontainer.h"
+#include "../vpatterndb/variables/vmeasurement.h"
+#include "../vpatterndb/variables/vvariable.h"
+
+#include <QtTest>
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_QmuParserBenchmark::TST_QmuParserBenchmark(QObject *parent)
+    :AbstractTest(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_QmuParserBenchmark::initTestCase()
+{
+    const Unit unit = Unit::Cm;
+    m_data = QSharedPointer<VContainer>(new VContainer(nullptr, &unit, VContainer::UniqueNamespace()));
+
+    // Typical values of a measurements file. Line and curve lengths are not calculated here, they are just variables
+    // for the parser.
+    const QVector<QPair<QString, qreal>> variables
+    {
+        {QStringLiteral("waist_circ"), 80},
+        {QStringLiteral("highbust_circ"), 88},
+        {QStringLiteral("bust_circ"), 92},
+        {QStringLiteral("waist_arc_b"), 19},
+        {QStringLiteral("leg_crotch_to_floor"), 78},
+        {QStringLiteral("height_waist_side_to_hip"), 20},
+        {QStringLiteral("height_knee"), 49},
+        {QStringLiteral("leg_thigh_upper_circ"), 56},
+        {QStringLiteral("Line_A3_A7"), 12.5},
+        {QStringLiteral("Line_A2_A17"), 11},
+        {QStringLiteral("Line_A93_A94"), 2.5},
+        {QStringLiteral("Spl_L_J"), 24}
+    };
+
+    quint32 index = 0;
+    for (auto &variable : variables)
+    {
+        m_data->AddVariable(new VMeasurement(m_data.data(), index++, variable.first, variable.second, QString(), true));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_QmuParserBenchmark::EvalFormula_data() const
+{
+    AddFormulaRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_QmuParserBenchmark::EvalFormula() const
+{
+    QFETCH(QString, formula);
+
+    const QHash<QString, QSharedPointer<VInternalVariable> > *vars = m_data->DataVariables();
+    qreal result = 0;
+
+    QBENCHMARK
+    {
+        Calculator cal;
+        result = cal.EvalFormula(vars, formula);
+    }
+
+    QVERIFY(not qIsInf(result) && not qIsNaN(result));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_QmuParserBenchmark::EvalBytecode_data() const
+{
+    AddFormulaRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_QmuParserBenchmark::EvalBytecode() const
+{
+    QFETCH(QString, formula);
+
+    Calculator cal;
+    const qreal expected = cal.EvalFormula(m_data->DataVariables(), formula);
+    qreal result = 0;
+
+    QBENCHMARK
+    {
+        result = cal.Eval();
+    }
+
+    QCOMPARE(result, expected);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_QmuParserBenchmark::AddFormulaRows() const
+{
+    QTest::addColumn<QString>("formula");
+
+    // Formulas are taken from patterns of the collection, they are stored in the internal look. Increments are not
+    // defined, the parser treats them as zero.
+    QTest::newRow("Arithmetic") << QStringLiteral("(highbust_circ-waist_circ)/2/2");
+    QTest::newRow("Line length") << QStringLiteral("leg_thigh_upper_circ/2 - Line_A3_A7");
+    QTest::newRow("Curve length") << QStringLiteral("(Spl_L_J - (waist_circ/4))/2");
+    QTest::newRow("Increment") << QStringLiteral("waist_arc_b/2 + 2*#CM_WIDTH");
+    QTest::newRow("Several measurements")
+            << QStringLiteral("(leg_crotch_to_floor*1.25) + height_waist_side_to_hip - (height_knee * 1.2)");
+    QTest::newRow("Function") << QStringLiteral("-180/3.14*atan(0.5/Line_A93_A94)");
+    QTest::newRow("Ternary operators") << QStringLiteral("#CG/4+6-(#CG>96?1:0)-(#CG>116?1:0)");
+    QTest::newRow("Ternary operator with repeated expression")
+            << QStringLiteral("(bust_circ-waist_circ)/2/2/2<0?0:(bust_circ-waist_circ)/2/2/2");
+    QTest::newRow("Nested functions")
+            << QStringLiteral("#Ktl+4-max(0;min(3;#Rl+#Ktl+4+Line_A2_A17-(#Ly/2+#Lhem)))");
+}
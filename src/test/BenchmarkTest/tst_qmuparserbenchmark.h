@@ -0,0 +1,62 @@
+/************************************************************************
+ **
+ **  @file   tst_qmuparserbenchmark.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef TST_QMUPARSERBENCHMARK_H
+#define TST_QMUPARSERBENCHMARK_H
+
+#include "../vtest/abstracttest.h"
+
+class VContainer;
+
+/**
+ * @brief The TST_QmuParserBenchmark class measures evaluation of formulas used in patterns of the collection.
+ *
+ * EvalFormula includes parsing of an expression, EvalBytecode measures only evaluation of already parsed bytecode.
+ */
+class TST_QmuParserBenchmark : public AbstractTest
+{
+    Q_OBJECT
+public:
+    explicit TST_QmuParserBenchmark(QObject *parent = nullptr);
+
+private slots:
+    void initTestCase();
+    void EvalFormula_data() const;
+    void EvalFormula() const;
+    void EvalBytecode_data() const;
+    void EvalBytecode() const;
+
+private:
+    Q_DISABLE_COPY(TST_QmuParserBenchmark)
+
+    QSharedPointer<VContainer> m_data{};
+
+    void AddFormulaRows() const;
+};
+
+#endif // TST_QMUPARSERBENCHMARK_H
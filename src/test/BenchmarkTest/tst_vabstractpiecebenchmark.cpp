@@ -0,0 +1,160 @@
+/************************************************************************
+ **
+ **  @file   tst_vabstractpiecebenchmark.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_vabstractpiecebenchmark.h"
+#include "../vlayout/vabstractpiece.h"
+#include "../vmisc/vabstractapplication.h"
+#include "../vpatterndb/vcontainer.h"
+#include "../vpatterndb/vpiece.h"
+
+#include <QtTest>
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VAbstractPieceBenchmark::TST_VAbstractPieceBenchmark(QObject *parent)
+    :AbstractTest(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VAbstractPieceBenchmark::MainPathPoints()
+{
+    // See file <root>/src/app/share/collection/bugs/Issue_#620.vit
+    const Unit unit = Unit::Cm;
+    QSharedPointer<VContainer> data(new VContainer(nullptr, &unit, VContainer::UniqueNamespace()));
+    qApp->setPatternUnit(unit);
+
+    VPiece detail;
+    AbstractTest::PieceFromJson(QStringLiteral("://Issue_620/input.json"), detail, data);
+
+    QVector<QPointF> points;
+
+    QBENCHMARK
+    {
+        points = detail.MainPathPoints(data.data());
+    }
+
+    QVERIFY(not points.isEmpty());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VAbstractPieceBenchmark::Equidistant_data()
+{
+    AddPieceRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VAbstractPieceBenchmark::Equidistant() const
+{
+    QFETCH(QVector<VSAPoint>, points);
+    QFETCH(qreal, width);
+
+    QVector<QPointF> ekv;
+
+    QBENCHMARK
+    {
+        ekv = VAbstractPiece::Equidistant(points, width, QString());
+    }
+
+    QVERIFY(not ekv.isEmpty());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VAbstractPieceBenchmark::CheckLoops_data()
+{
+    AddPieceRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VAbstractPieceBenchmark::CheckLoops() const
+{
+    QFETCH(QVector<VSAPoint>, points);
+
+    QVector<QPointF> path;
+    path.reserve(points.size());
+    for (auto &point : points)
+    {
+        path.append(point);
+    }
+
+    QVector<QPointF> result;
+
+    QBENCHMARK
+    {
+        result = VAbstractPiece::CheckLoops(path);
+    }
+
+    QVERIFY(not result.isEmpty());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VAbstractPieceBenchmark::AddPieceRows()
+{
+    QTest::addColumn<QVector<VSAPoint>>("points");
+    QTest::addColumn<qreal>("width");
+
+    auto ASSERT_TEST_CASE = [this](const char *title, const QString &input, qreal width)
+    {
+        QVector<VSAPoint> inputPoints;
+        AbstractTest::VectorFromJson(input, inputPoints);
+
+        QTest::newRow(title) << inputPoints << width;
+    };
+
+    // See file src/app/share/collection/test/seamtest1.val
+    ASSERT_TEST_CASE("Seam test 1", QStringLiteral("://seamtest1_by_angle/input.json"),
+                     37.795275590551185 /*seam allowance width (1.0 cm)*/);
+
+    // See file src/app/share/collection/bugs/Issue_#646.val
+    ASSERT_TEST_CASE("Issue 646", QStringLiteral("://Issue_646/input.json"),
+                     37.795275590551185 /*seam allowance width (1.0 cm)*/);
+
+    // See file src/app/share/collection/bugs/loop_by_intersection.val
+    ASSERT_TEST_CASE("Loop by intersection", QStringLiteral("://loop_by_intersection/input.json"),
+                     39.685039370078741 /*seam allowance width (1.05 cm)*/);
+
+    // See file src/app/share/collection/bugs/DP_6.val (private collection)
+    ASSERT_TEST_CASE("DP 6", QStringLiteral("://DP_6/input.json"),
+                     37.795275590551185 /*seam allowance width (1.0 cm)*/);
+
+    // See file src/app/share/collection/bugs/smart_pattern_#36.val
+    ASSERT_TEST_CASE("Smart pattern 36", QStringLiteral("://smart_pattern_#36/input.json"),
+                     30.236220472440944 /*seam allowance width (0.8 cm)*/);
+
+    // See the file "collection/bugs/doll.val" (private collection)
+    ASSERT_TEST_CASE("Doll", QStringLiteral("://doll/input.json"),
+                     26.45669291338583 /*seam allowance width 0.7 cm*/);
+
+    // See the file "collection/bugs/Issue_#880.val"
+    ASSERT_TEST_CASE("Issue 880", QStringLiteral("://Issue_880_Detail/input.json"),
+                     37.795275590551185 /*seam allowance width*/);
+}
@@ -0,0 +1,58 @@
+/************************************************************************
+ **
+ **  @file   tst_vabstractpiecebenchmark.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef TST_VABSTRACTPIECEBENCHMARK_H
+#define TST_VABSTRACTPIECEBENCHMARK_H
+
+#include "../vtest/abstracttest.h"
+
+/**
+ * @brief The TST_VAbstractPieceBenchmark class measures building of a piece main path and its seam allowance.
+ *
+ * Pieces are taken from real patterns of the collection, the same inputs check correctness in ValentinaTest.
+ */
+class TST_VAbstractPieceBenchmark : public AbstractTest
+{
+    Q_OBJECT
+public:
+    explicit TST_VAbstractPieceBenchmark(QObject *parent = nullptr);
+
+private slots:
+    void MainPathPoints();
+    void Equidistant_data();
+    void Equidistant() const;
+    void CheckLoops_data();
+    void CheckLoops() const;
+
+private:
+    Q_DISABLE_COPY(TST_VAbstractPieceBenchmark)
+
+    void AddPieceRows();
+};
+
+#endif // TST_VABSTRACTPIECEBENCHMARK_H
@@ -0,0 +1,190 @@
+/************************************************************************
+ **
+ **  @file   tst_vgeometrybenchmark.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_vgeometrybenchmark.h"
+#include "../vgeometry/varc.h"
+#include "../vgeometry/vcurveindex.h"
+#include "../vgeometry/vellipticalarc.h"
+#include "../vgeometry/vspline.h"
+#include "../vmisc/def.h"
+#include "../vmisc/vabstractapplication.h"
+#include "../vpatterndb/vcontainer.h"
+#include "../vpatterndb/vpiece.h"
+
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CrossLine return a horizontal line through the middle of the curve's bounding rect.
+ */
+QLineF CrossLine(const QVector<QPointF> &points)
+{
+    const QRectF rect = QPolygonF(points).boundingRect();
+    const qreal y = rect.center().y();
+    return QLineF(rect.left() - 10, y, rect.right() + 10, y);
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VGeometryBenchmark::TST_VGeometryBenchmark(QObject *parent)
+    :AbstractTest(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VGeometryBenchmark::initTestCase()
+{
+    // See the file <root>/src/app/share/collection/TestPuzzle.val
+    VPointF p1(1168.8582803149607, 39.999874015748034, "p1", 5.0000125984251973, 9.9999874015748045);
+    VPointF p4(681.33729132409951, 1815.7969526662778, "p4", 5.0000125984251973, 9.9999874015748045);
+    auto *spline = new VSpline(p1, p4, 229.381, 41.6325, 0.96294100000000005, 1.00054, 1);
+    spline->setName(QStringLiteral("TestPuzzle spline"));
+    m_curves.append(QSharedPointer<VAbstractCurve>(spline));
+
+    // See file <root>/src/app/share/collection/bugs/Issue_#957.val
+    const VPointF center(QPointF(189.13625196850393, 344.1267401574803));
+    auto *arc = new VArc(center, ToPixel(10, Unit::Cm), 135, 315);
+    arc->setName(QStringLiteral("Issue #957 arc"));
+    m_curves.append(QSharedPointer<VAbstractCurve>(arc));
+
+    auto *ellipticalArc = new VEllipticalArc(VPointF(QPointF(10, 10)), 100, 200, 0, 270, 80);
+    ellipticalArc->setName(QStringLiteral("Elliptical arc"));
+    m_curves.append(QSharedPointer<VAbstractCurve>(ellipticalArc));
+
+    // See file <root>/src/app/share/collection/bugs/Issue_#620.vit
+    const Unit unit = Unit::Cm;
+    QSharedPointer<VContainer> data(new VContainer(nullptr, &unit, VContainer::UniqueNamespace()));
+    qApp->setPatternUnit(unit);
+    VPiece detail;
+    AbstractTest::PieceFromJson(QStringLiteral("://Issue_620/input.json"), detail, data);
+
+    // Keep the order of rows stable between runs
+    QMap<QString, QSharedPointer<VAbstractCurve>> curves;
+    const QHash<quint32, QSharedPointer<VGObject>> *objects = data->CalculationGObjects();
+    auto i = objects->constBegin();
+    while (i != objects->constEnd())
+    {
+        const QSharedPointer<VAbstractCurve> curve = qSharedPointerDynamicCast<VAbstractCurve>(i.value());
+        if (not curve.isNull())
+        {
+            curve->setName(QStringLiteral("Issue #620 ") + curve->name());
+            curves.insert(curve->name(), curve);
+        }
+        ++i;
+    }
+
+    m_curves.append(curves.values().toVector());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VGeometryBenchmark::CurveFlattening_data() const
+{
+    AddCurveRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VGeometryBenchmark::CurveFlattening() const
+{
+    QFETCH(int, curve);
+
+    const QSharedPointer<VAbstractCurve> &object = m_curves.at(curve);
+    QVector<QPointF> points;
+
+    QBENCHMARK
+    {
+        points = object->GetPoints();
+    }
+
+    QVERIFY(points.size() > 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VGeometryBenchmark::CurveIntersectLine_data() const
+{
+    AddCurveRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VGeometryBenchmark::CurveIntersectLine() const
+{
+    QFETCH(int, curve);
+
+    const QVector<QPointF> points = m_curves.at(curve)->GetPoints();
+    const QLineF line = CrossLine(points);
+    QVector<QPointF> intersections;
+
+    QBENCHMARK
+    {
+        intersections = VAbstractCurve::CurveIntersectLine(points, line);
+    }
+
+    QVERIFY(not intersections.isEmpty());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VGeometryBenchmark::CurveIndexIntersectLine_data() const
+{
+    AddCurveRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VGeometryBenchmark::CurveIndexIntersectLine() const
+{
+    QFETCH(int, curve);
+
+    const VCurveIndex index(m_curves.at(curve)->GetPoints());
+    const QLineF line = CrossLine(index.GetPoints());
+    QVector<QPointF> intersections;
+
+    QBENCHMARK
+    {
+        intersections = index.IntersectLine(line);
+    }
+
+    QVERIFY(not intersections.isEmpty());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VGeometryBenchmark::AddCurveRows() const
+{
+    QTest::addColumn<int>("curve");
+
+    for (int i = 0; i < m_curves.size(); ++i)
+    {
+        QTest::newRow(qUtf8Printable(m_curves.at(i)->name())) << i;
+    }
+}
@@ -0,0 +1,67 @@
+/************************************************************************
+ **
+ **  @file   tst_vgeometrybenchmark.h
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#ifndef TST_VGEOMETRYBENCHMARK_H
+#define TST_VGEOMETRYBENCHMARK_H
+
+#include <QSharedPointer>
+#include <QVector>
+
+#include "../vtest/abstracttest.h"
+
+class VAbstractCurve;
+
+/**
+ * @brief The TST_VGeometryBenchmark class measures flattening of curves and intersection of a curve with a line.
+ *
+ * Curves are taken from real patterns of the collection.
+ */
+class TST_VGeometryBenchmark : public AbstractTest
+{
+    Q_OBJECT
+public:
+    explicit TST_VGeometryBenchmark(QObject *parent = nullptr);
+
+private slots:
+    void initTestCase();
+    void CurveFlattening_data() const;
+    void CurveFlattening() const;
+    void CurveIntersectLine_data() const;
+    void CurveIntersectLine() const;
+    void CurveIndexIntersectLine_data() const;
+    void CurveIndexIntersectLine() const;
+
+private:
+    Q_DISABLE_COPY(TST_VGeometryBenchmark)
+
+    QVector<QSharedPointer<VAbstractCurve>> m_curves{};
+
+    void AddCurveRows() const;
+};
+
+#endif // TST_VGEOMETRYBENCHMARK_H
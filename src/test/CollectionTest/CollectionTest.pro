@@ -55,14 +55,16 @@ DEFINES += SRCDIR=\\\"$$PWD/\\\"
 SOURCES += \
     qttestmainlambda.cpp \
     tst_tapecommandline.cpp \
-    tst_valentinacommandline.cpp
+    tst_valentinacommandline.cpp \
+    tst_nestingbenchmark.cpp
 
 *msvc*:SOURCES += stable.cpp
 
 HEADERS += \
     stable.h \
     tst_tapecommandline.h \
-    tst_valentinacommandline.h
+    tst_valentinacommandline.h \
+    tst_nestingbenchmark.h
 
 # Set using ccache. Function enable_ccache() defined in common.pri.
 $$enable_ccache()
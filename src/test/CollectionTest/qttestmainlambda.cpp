@@ -30,6 +30,7 @@
 
 #include "tst_tapecommandline.h"
 #include "tst_valentinacommandline.h"
+#include "tst_nestingbenchmark.h"
 
 int main(int argc, char** argv)
 {
@@ -44,6 +45,7 @@ int main(int argc, char** argv)
 
     ASSERT_TEST(new TST_TapeCommandLine());
     ASSERT_TEST(new TST_ValentinaCommandLine());
+    ASSERT_TEST(new TST_NestingBenchmark());
 
     return status;
 }
@@ -0,0 +1,214 @@
+/************************************************************************
+ **
+ **  @file   tst_nestingbenchmark.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_nestingbenchmark.h"
+#include "../vmisc/vsysexits.h"
+
+#include <QtTest>
+#include <QElapsedTimer>
+#include <QGlobalStatic>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <climits>
+
+namespace
+{
+Q_GLOBAL_STATIC_WITH_ARGS(const QString, tmpBenchmarkFolder, (QLatin1String("tst_nesting_benchmark_tmp")))
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_NestingBenchmark::TST_NestingBenchmark(QObject *parent)
+    :AbstractTest(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_NestingBenchmark::initTestCase()
+{
+    QDir tmpDir(*tmpBenchmarkFolder);
+    if (not tmpDir.removeRecursively())
+    {
+        QFAIL("Fail to remove benchmark temp directory.");
+    }
+
+    if (not CopyRecursively(QCoreApplication::applicationDirPath() + QDir::separator() +
+                            QLatin1String("tst_valentina_collection"),
+                            QCoreApplication::applicationDirPath() + QDir::separator() + *tmpBenchmarkFolder))
+    {
+        QFAIL("Fail to prepare collection files for benchmark.");
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_NestingBenchmark::NestCollection_data() const
+{
+    QTest::addColumn<QString>("file");
+    QTest::addColumn<QString>("arguments");
+
+    const QString tmp = QCoreApplication::applicationDirPath() + QDir::separator() + *tmpBenchmarkFolder;
+    const QString gost = QString("-m;;%1").arg(tmp + QDir::separator() + QLatin1String("GOST_man_ru.vst"));
+
+    // Coefficient 1 stops nesting on the first layout, so each case measures one pass of the generator.
+    const QString settings = QString("-p;;0;;-d;;%1;;--time;;1;;--coefficient;;1;;--noLayoutCache").arg(tmp);
+    const QString greedy = settings;
+    const QString optimizer = settings + QStringLiteral(";;--nestOptimizer;;--nestSeed;;1");
+
+    auto AddCase = [greedy, optimizer](const QString &name, const QString &file, const QString &arguments)
+    {
+        QTest::newRow(qUtf8Printable(name + QStringLiteral(" greedy"))) << file << greedy + arguments;
+        QTest::newRow(qUtf8Printable(name + QStringLiteral(" optimizer"))) << file << optimizer + arguments;
+    };
+
+    AddCase(QStringLiteral("TShirt_test"), QStringLiteral("TShirt_test.val"), QString());
+    AddCase(QStringLiteral("Basic block women"), QStringLiteral("Basic_block_women-2016.val"), QString());
+    AddCase(QStringLiteral("MaleShirt"), QStringLiteral("MaleShirt.val"), QString());
+    AddCase(QStringLiteral("Gent Jacket with tummy"), QStringLiteral("Gent_Jacket_with_tummy.val"), QString());
+#ifdef Q_OS_WIN
+    Q_UNUSED(gost)
+#else
+    AddCase(QStringLiteral("jacketM1_52-176"), QStringLiteral("jacketM1_52-176.val"), QStringLiteral(";;") + gost);
+#endif
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_NestingBenchmark::NestCollection()
+{
+    QFETCH(QString, file);
+    QFETCH(QString, arguments);
+
+    const QString tmp = QCoreApplication::applicationDirPath() + QDir::separator() + *tmpBenchmarkFolder;
+    const QString name = QString::number(m_report.size());
+    const QString tracePath = tmp + QDir::separator() + name + QStringLiteral(".json");
+
+    const QStringList arg = QStringList() << tmp + QDir::separator() + file
+                                          << arguments.split(";;")
+                                          << QStringLiteral("-b") << name
+                                          << QStringLiteral("--trace") << tracePath;
+
+    QString error;
+    QElapsedTimer timer;
+    timer.start();
+    const int exit = Run(V_EX_OK, ValentinaPath(), arg, error);
+    const qint64 wallTime = timer.elapsed();
+
+    QVERIFY2(exit == V_EX_OK, qUtf8Printable(error.right(350)));
+
+    QFile traceFile(tracePath);
+    QVERIFY2(traceFile.open(QIODevice::ReadOnly), qUtf8Printable(traceFile.errorString()));
+    const QJsonArray events = QJsonDocument::fromJson(traceFile.readAll()).object()
+            .value(QLatin1String("traceEvents")).toArray();
+    QVERIFY2(not events.isEmpty(), "Trace is empty.");
+
+    qint64 placements = 0;
+    qint64 candidateTests = 0;
+    qreal nestingTime = 0; // in microseconds
+    int papers = INT_MAX;
+    qreal efficiency = 0;
+
+    for (const auto &value : events)
+    {
+        const QJsonObject event = value.toObject();
+        const QString eventName = event.value(QLatin1String("name")).toString();
+        const QJsonObject args = event.value(QLatin1String("args")).toObject();
+
+        if (eventName == QLatin1String("Arrange piece"))
+        {
+            ++placements;
+        }
+        else if (eventName == QLatin1String("Find position"))
+        {
+            candidateTests += args.value(QLatin1String("candidates")).toString().toLongLong();
+        }
+        else if (eventName == QLatin1String("Generate layout"))
+        {
+            nestingTime += event.value(QLatin1String("dur")).toDouble();
+
+            // Like the layout generation, prefer fewer sheets, then higher efficiency
+            if (args.contains(QLatin1String("papers")))
+            {
+                const int layoutPapers = args.value(QLatin1String("papers")).toString().toInt();
+                const qreal layoutEfficiency = args.value(QLatin1String("efficiency")).toString().toDouble();
+                if (layoutPapers < papers || (layoutPapers == papers && layoutEfficiency > efficiency))
+                {
+                    papers = layoutPapers;
+                    efficiency = layoutEfficiency;
+                }
+            }
+        }
+    }
+
+    QVERIFY2(papers != INT_MAX, "Trace has no finished layout.");
+
+    const qreal nestingSeconds = qMax(nestingTime / 1000000.0, 1e-6);
+
+    QJsonObject result;
+    result[QLatin1String("case")] = QString::fromUtf8(QTest::currentDataTag());
+    result[QLatin1String("wallTimeMs")] = static_cast<double>(wallTime);
+    result[QLatin1String("nestingTimeMs")] = nestingTime / 1000.0;
+    result[QLatin1String("placements")] = static_cast<double>(placements);
+    result[QLatin1String("placementsPerSecond")] = placements / nestingSeconds;
+    result[QLatin1String("candidateTests")] = static_cast<double>(candidateTests);
+    result[QLatin1String("candidateTestsPerSecond")] = candidateTests / nestingSeconds;
+    result[QLatin1String("papers")] = papers;
+    result[QLatin1String("efficiency")] = efficiency;
+    m_report.append(result);
+
+    qDebug().noquote() << QJsonDocument(result).toJson(QJsonDocument::Compact);
+    QTest::setBenchmarkResult(nestingTime / 1000.0, QTest::WalltimeMilliseconds);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_NestingBenchmark::cleanupTestCase()
+{
+    QString reportPath = QString::fromLocal8Bit(qgetenv("NESTING_BENCHMARK_REPORT"));
+    if (reportPath.isEmpty())
+    {
+        reportPath = QCoreApplication::applicationDirPath() + QDir::separator() +
+                QLatin1String("nesting_benchmark.json");
+    }
+
+    QFile report(reportPath);
+    if (report.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        report.write(QJsonDocument(m_report).toJson());
+    }
+    else
+    {
+        QWARN(qUtf8Printable(QStringLiteral("Can't save benchmark report to %1.").arg(reportPath)));
+    }
+
+    QDir tmpDir(*tmpBenchmarkFolder);
+    if (not tmpDir.removeRecursively())
+    {
+        QWARN("Fail to remove benchmark temp directory.");
+    }
+}
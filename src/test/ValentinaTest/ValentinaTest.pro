@@ -58,6 +58,7 @@ SOURCES += \
     tst_vspline.cpp \
     tst_nameregexp.cpp \
     tst_vlayoutdetail.cpp \
+    tst_vlayoutgenerator.cpp \
     tst_varc.cpp \
     tst_qmutokenparser.cpp \
     tst_vmeasurements.cpp \
@@ -75,7 +76,12 @@ SOURCES += \
     tst_readval.cpp \
     tst_vtranslatevars.cpp \
     tst_vabstractpiece.cpp \
-    tst_vtooluniondetails.cpp
+    tst_vtooluniondetails.cpp \
+    tst_vautosavejournal.cpp \
+    tst_vundopayload.cpp \
+    tst_vlevelofdetail.cpp \
+    tst_vgroupindex.cpp \
+    tst_vmaingraphicsscene.cpp
 
 *msvc*:SOURCES += stable.cpp
 
@@ -86,6 +92,7 @@ HEADERS += \
     tst_vspline.h \
     tst_nameregexp.h \
     tst_vlayoutdetail.h \
+    tst_vlayoutgenerator.h \
     tst_varc.h \
     stable.h \
     tst_qmutokenparser.h \
@@ -104,7 +111,12 @@ HEADERS += \
     tst_readval.h \
     tst_vtranslatevars.h \
     tst_vabstractpiece.h \
-    tst_vtooluniondetails.h
+    tst_vtooluniondetails.h \
+    tst_vautosavejournal.h \
+    tst_vundopayload.h \
+    tst_vlevelofdetail.h \
+    tst_vgroupindex.h \
+    tst_vmaingraphicsscene.h
 
 # Set using ccache. Function enable_ccache() defined in common.pri.
 $$enable_ccache()
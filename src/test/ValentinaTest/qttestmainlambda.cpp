@@ -33,6 +33,7 @@
 #include "tst_vspline.h"
 #include "tst_nameregexp.h"
 #include "tst_vlayoutdetail.h"
+#include "tst_vlayoutgenerator.h"
 #include "tst_varc.h"
 #include "tst_vellipticalarc.h"
 #include "tst_qmutokenparser.h"
@@ -52,6 +53,11 @@
 #include "tst_vtooluniondetails.h"
 #include "tst_vdomdocument.h"
 #include "tst_dxf.h"
+#include "tst_vautosavejournal.h"
+#include "tst_vundopayload.h"
+#include "tst_vlevelofdetail.h"
+#include "tst_vgroupindex.h"
+#include "tst_vmaingraphicsscene.h"
 
 #include "../vmisc/def.h"
 #include "../qmuparser/qmudef.h"
@@ -81,6 +87,7 @@ int main(int argc, char** argv)
     ASSERT_TEST(new TST_VSplinePath());
     ASSERT_TEST(new TST_NameRegExp());
     ASSERT_TEST(new TST_VLayoutDetail());
+    ASSERT_TEST(new TST_VLayoutGenerator());
     ASSERT_TEST(new TST_VArc());
     ASSERT_TEST(new TST_VEllipticalArc());
     ASSERT_TEST(new TST_QmuTokenParser());
@@ -96,6 +103,11 @@ int main(int argc, char** argv)
     ASSERT_TEST(new TST_VTranslateVars());
     ASSERT_TEST(new TST_VToolUnionDetails());
     ASSERT_TEST(new TST_DXF());
+    ASSERT_TEST(new TST_VAutoSaveJournal());
+    ASSERT_TEST(new TST_VUndoPayload());
+    ASSERT_TEST(new TST_VLevelOfDetail());
+    ASSERT_TEST(new TST_VGroupIndex());
+    ASSERT_TEST(new TST_VMainGraphicsScene());
 
     return status;
 }
@@ -28,7 +28,10 @@
 
 #include "tst_vabstractcurve.h"
 #include "../vgeometry/vabstractcurve.h"
+#include "../vgeometry/vcurveindex.h"
+#include "../vmisc/compatibility.h"
 
+#include <QtMath>
 #include <QtTest>
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -170,3 +173,72 @@ void TST_VAbstractCurve::IsPointOnCurve() const
     bool result = VAbstractCurve::IsPointOnCurve(points, point);
     QCOMPARE(result, expectedResult);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VAbstractCurve::CurveIndexIntersections_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("curve1");
+    QTest::addColumn<QVector<QPointF>>("curve2");
+
+    auto Wave = [](int count, qreal amplitude, qreal periods, qreal shift)
+    {
+        QVector<QPointF> points;
+        points.reserve(count);
+        for (int i = 0; i < count; ++i)
+        {
+            const qreal x = 1000.0 * i / (count - 1);
+            points.append(QPointF(x, shift + amplitude * qSin(2 * M_PI * periods * i / (count - 1))));
+        }
+        return points;
+    };
+
+    auto Circle = [](int count, qreal radius, const QPointF &center)
+    {
+        QVector<QPointF> points;
+        points.reserve(count + 1);
+        for (int i = 0; i <= count; ++i)
+        {
+            const qreal angle = 2 * M_PI * i / count;
+            points.append(center + QPointF(radius * qCos(angle), radius * qSin(angle)));
+        }
+        return points;
+    };
+
+    QTest::newRow("Two waves") << Wave(500, 100, 3, 0) << Wave(700, 80, 5, 10);
+    QTest::newRow("Wave and circle") << Wave(1000, 200, 7, 0) << Circle(360, 300, QPointF(500, 0));
+    QTest::newRow("Circle and wave") << Circle(360, 300, QPointF(500, 0)) << Wave(1000, 200, 7, 0);
+    // One leaf of the first curve crosses many leaves of the second one
+    QTest::newRow("Long segments across wave")
+            << (QVector<QPointF>() << QPointF(0, -300) << QPointF(1000, 300) << QPointF(0, 250))
+            << Wave(1000, 200, 7, 0);
+    QTest::newRow("No intersections") << Wave(300, 50, 2, 0) << Wave(300, 50, 2, 500);
+    QTest::newRow("Short curves") << (QVector<QPointF>() << QPointF(0, 0) << QPointF(100, 100))
+                                  << (QVector<QPointF>() << QPointF(0, 100) << QPointF(100, 0));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VAbstractCurve::CurveIndexIntersections() const
+{
+    QFETCH(QVector<QPointF>, curve1);
+    QFETCH(QVector<QPointF>, curve2);
+
+    // Index must give exactly what the plain scan gives, in the same order.
+    QVector<QPointF> expected;
+    for (int i = 0; i < curve1.size()-1; ++i)
+    {
+        expected << VAbstractCurve::CurveIntersectLine(curve2, QLineF(curve1.at(i), curve1.at(i+1)));
+    }
+
+    const VCurveIndex index1(curve1);
+    const VCurveIndex index2(curve2);
+    QCOMPARE(index1.IntersectCurve(index2), expected);
+
+    const QLineF line(QPointF(-10, -400), QPointF(1010, 400));
+    QCOMPARE(index2.IntersectLine(line), VAbstractCurve::CurveIntersectLine(curve2, line));
+
+    for (auto &p : qAsConst(expected))
+    {
+        QVERIFY(index1.IsPointOnCurve(p));
+        QVERIFY(index2.IsPointOnCurve(p));
+    }
+}
@@ -40,6 +40,8 @@ public:
 private slots:
     void IsPointOnCurve_data() const;
     void IsPointOnCurve() const;
+    void CurveIndexIntersections_data() const;
+    void CurveIndexIntersections() const;
 };
 
 #endif // TST_VABSTRACTCURVE_H
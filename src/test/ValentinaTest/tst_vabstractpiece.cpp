@@ -29,8 +29,12 @@
 #include "tst_vabstractpiece.h"
 #include "../vlayout/vabstractpiece.h"
 
+#include <QPainterPath>
 #include <QPointF>
 #include <QVector>
+#include <QtMath>
+#include <algorithm>
+#include <limits>
 
 #include <QtTest>
 
@@ -330,6 +334,73 @@ void TST_VAbstractPiece::SumTrapezoids() const
     Case5();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VAbstractPiece::SimplifyOutward_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("points");
+    QTest::addColumn<qreal>("tolerance");
+
+    // Wavy contour has both convex and reflex vertices
+    QVector<QPointF> wave;
+    const int count = 2000;
+    for (int i = 0; i < count; ++i)
+    {
+        const qreal t = 2 * M_PI * i / count;
+        const qreal r = 100 + 20 * qSin(5 * t);
+        wave.append(QPointF(r * qCos(t), r * qSin(t)));
+    }
+
+    QTest::newRow("Counterclockwise, small tolerance") << wave << 0.1;
+    QTest::newRow("Counterclockwise, big tolerance") << wave << 2.0;
+
+    QVector<QPointF> reversed = wave;
+    std::reverse(reversed.begin(), reversed.end());
+    QTest::newRow("Clockwise") << reversed << 0.5;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VAbstractPiece::SimplifyOutward() const
+{
+    QFETCH(QVector<QPointF>, points);
+    QFETCH(qreal, tolerance);
+
+    const QVector<QPointF> simplified = VAbstractPiece::SimplifyOutward(points, tolerance);
+    QVERIFY2(simplified.size() < points.size() / 4, "Contour was not simplified enough.");
+
+    QPainterPath path;
+    path.addPolygon(QPolygonF(simplified));
+    path.closeSubpath();
+    path.setFillRule(Qt::WindingFill);
+
+    // Grow the path a bit to include points lying exactly on edges
+    QPainterPathStroker stroker;
+    stroker.setWidth(0.02);
+    const QPainterPath test = path.united(stroker.createStroke(path));
+
+    for (auto &p : qAsConst(points))
+    {
+        QVERIFY2(test.contains(p), "Simplified contour doesn't enclose the original contour.");
+    }
+
+    auto DistanceToContour = [&points](const QPointF &p)
+    {
+        qreal distance = std::numeric_limits<qreal>::max();
+        for (int i = 0; i < points.size(); ++i)
+        {
+            const QPointF a = points.at(i);
+            const QPointF ab = points.at((i+1) % points.size()) - a;
+            const qreal t = qBound(0.0, QPointF::dotProduct(p - a, ab) / QPointF::dotProduct(ab, ab), 1.0);
+            distance = qMin(distance, QLineF(p, a + ab*t).length());
+        }
+        return distance;
+    };
+
+    for (auto &p : simplified)
+    {
+        QVERIFY2(DistanceToContour(p) <= tolerance + 0.01, "Simplified contour is too far.");
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void TST_VAbstractPiece::PathRemoveLoop_data() const
 {
@@ -43,6 +43,8 @@ private slots:
     void EquidistantRemoveLoop_data();
     void EquidistantRemoveLoop() const;
     void SumTrapezoids() const;
+    void SimplifyOutward_data() const;
+    void SimplifyOutward() const;
     void PathRemoveLoop_data() const;
     void PathRemoveLoop() const;
     void PathLoopsCase_data() const;
@@ -0,0 +1,270 @@
+/************************************************************************
+ **
+ **  @file   tst_vautosavejournal.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_vautosavejournal.h"
+#include "../ifc/xml/vautosavejournal.h"
+#include "../ifc/xml/vdomdocument.h"
+
+#include <QFile>
+#include <QTemporaryDir>
+#include <QtTest>
+
+namespace
+{
+const QString pattern = QStringLiteral("<pattern>"
+                                       "<draw name=\"A\"><point id=\"1\" x=\"0\"/><point id=\"2\" x=\"1\"/></draw>"
+                                       "<draw name=\"B\"><point id=\"3\" x=\"2\"/></draw>"
+                                       "</pattern>");
+
+//---------------------------------------------------------------------------------------------------------------------
+QString PointX(VDomDocument &doc, quint32 id)
+{
+    return doc.elementById(id, QString(), false).attribute(QStringLiteral("x"));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AppendLine(const QString &fileName, const QByteArray &line)
+{
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Append));
+    file.write(line);
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VAutoSaveJournal::TST_VAutoSaveJournal(QObject *parent)
+    : AbstractTest(parent)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VAutoSaveJournal::RestoreReplay()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString snapshotPath = dir.filePath(QStringLiteral("pattern.val.autosave"));
+
+    VDomDocument doc;
+    VAutoSaveJournal journal;
+    Start(journal, doc, snapshotPath);
+
+    // Changed attribute
+    doc.elementById(1, QString(), false).setAttribute(QStringLiteral("x"), 5);
+    journal.Record({1});
+
+    // Removed element
+    QDomElement point2 = doc.elementById(2, QString(), false);
+    point2.parentNode().removeChild(point2);
+    journal.Record({2});
+
+    // New element in the middle of the second draw, the changed one is recorded together with its neighbor
+    QDomElement point4 = doc.createElement(QStringLiteral("point"));
+    point4.setAttribute(VDomDocument::AttrId, 4);
+    point4.setAttribute(QStringLiteral("x"), 3);
+    QDomElement point3 = doc.elementById(3, QString(), false);
+    point3.parentNode().insertBefore(point4, point3);
+    point3.setAttribute(QStringLiteral("x"), 6);
+    journal.Record({4, 3});
+
+    journal.Stop();
+
+    VDomDocument restored;
+    Restored(snapshotPath, restored);
+
+    QCOMPARE(PointX(restored, 1), QStringLiteral("5"));
+    QVERIFY(restored.elementById(2, QString(), false).isNull());
+    QCOMPARE(PointX(restored, 3), QStringLiteral("6"));
+    QCOMPARE(PointX(restored, 4), QStringLiteral("3"));
+    QVERIFY(restored.elementById(4, QString(), false).nextSiblingElement()
+            == restored.elementById(3, QString(), false));
+    QCOMPARE(restored.elementById(4, QString(), false).parentNode().toElement().attribute(QStringLiteral("name")),
+             QStringLiteral("B"));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VAutoSaveJournal::RestoreStopsAtGap()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString snapshotPath = dir.filePath(QStringLiteral("pattern.val.autosave"));
+
+    VDomDocument doc;
+    VAutoSaveJournal journal;
+    Start(journal, doc, snapshotPath);
+
+    doc.elementById(1, QString(), false).setAttribute(QStringLiteral("x"), 5);
+    journal.Record({1});
+
+    journal.Invalidate();
+    QVERIFY(journal.NeedSnapshot());
+
+    // Not recorded after a gap
+    doc.elementById(1, QString(), false).setAttribute(QStringLiteral("x"), 7);
+    journal.Record({1});
+    journal.Stop();
+
+    // A record behind the gap must not be replayed even if it is valid
+    AppendLine(VAutoSaveJournal::JournalPath(snapshotPath),
+               QByteArrayLiteral("{\"seq\":10,\"removed\":[\"2\"]}\n"));
+
+    VDomDocument restored;
+    Restored(snapshotPath, restored);
+
+    QCOMPARE(PointX(restored, 1), QStringLiteral("5"));
+    QVERIFY(not restored.elementById(2, QString(), false).isNull());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VAutoSaveJournal::RestoreSkipsCoveredGap()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString snapshotPath = dir.filePath(QStringLiteral("pattern.val.autosave"));
+
+    VDomDocument doc;
+    VAutoSaveJournal journal;
+    Start(journal, doc, snapshotPath);
+
+    doc.elementById(1, QString(), false).setAttribute(QStringLiteral("x"), 5);
+    journal.Record({1});
+    journal.Invalidate();
+
+    // The new snapshot covers the gap
+    QVERIFY(journal.NeedSnapshot());
+    QTRY_VERIFY(journal.Snapshot()); // The first snapshot may still be finishing
+
+    doc.elementById(1, QString(), false).setAttribute(QStringLiteral("x"), 8);
+    journal.Record({1});
+
+    // Stop before the journal is truncated, like a crash right after the snapshot was written
+    journal.Stop();
+
+    QFile file(VAutoSaveJournal::JournalPath(snapshotPath));
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QVERIFY(file.readAll().contains("\"gap\":true"));
+    file.close();
+
+    VDomDocument restored;
+    Restored(snapshotPath, restored);
+
+    QCOMPARE(PointX(restored, 1), QStringLiteral("8"));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VAutoSaveJournal::RestoreTornRecord()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString snapshotPath = dir.filePath(QStringLiteral("pattern.val.autosave"));
+
+    VDomDocument doc;
+    VAutoSaveJournal journal;
+    Start(journal, doc, snapshotPath);
+
+    doc.elementById(1, QString(), false).setAttribute(QStringLiteral("x"), 5);
+    journal.Record({1});
+    journal.Stop();
+
+    // Crash in the middle of writing
+    AppendLine(VAutoSaveJournal::JournalPath(snapshotPath), QByteArrayLiteral("{\"seq\":2,\"removed\":[\"3"));
+
+    VDomDocument restored;
+    Restored(snapshotPath, restored);
+
+    QCOMPARE(PointX(restored, 1), QStringLiteral("5"));
+    QVERIFY(not restored.elementById(3, QString(), false).isNull());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VAutoSaveJournal::RestoreOtherSession()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString snapshotPath = dir.filePath(QStringLiteral("pattern.val.autosave"));
+
+    VDomDocument doc;
+    VAutoSaveJournal journal;
+    Start(journal, doc, snapshotPath);
+
+    doc.elementById(1, QString(), false).setAttribute(QStringLiteral("x"), 5);
+    journal.Record({1});
+    journal.Stop();
+
+    // Journal of a newer session with an old snapshot
+    const QString journalPath = VAutoSaveJournal::JournalPath(snapshotPath);
+    QFile file(journalPath);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QByteArray content = file.readAll();
+    file.close();
+    content.replace(0, content.indexOf('\n'), QByteArrayLiteral("{\"session\":\"other\"}"));
+    QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write(content);
+    file.close();
+
+    VDomDocument restored;
+    Restored(snapshotPath, restored);
+    QCOMPARE(PointX(restored, 1), QStringLiteral("0"));
+
+    // Without journal the snapshot is restored as is
+    QVERIFY(QFile::remove(journalPath));
+    Restored(snapshotPath, restored);
+    QCOMPARE(PointX(restored, 1), QStringLiteral("0"));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Start load test pattern and begin a session with the first snapshot on disk.
+ */
+void TST_VAutoSaveJournal::Start(VAutoSaveJournal &journal, VDomDocument &doc, const QString &snapshotPath)
+{
+    QVERIFY(doc.setContent(pattern));
+
+    journal.Start(&doc, snapshotPath);
+    QVERIFY(journal.NeedSnapshot());
+    QVERIFY(journal.Snapshot());
+    QVERIFY(not journal.NeedSnapshot());
+    QTRY_VERIFY(QFile::exists(snapshotPath));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VAutoSaveJournal::Restored(const QString &snapshotPath, VDomDocument &restored)
+{
+    const QString destination = snapshotPath + QLatin1String(".restored");
+    QFile::remove(destination);
+
+    QString error;
+    QVERIFY2(VAutoSaveJournal::Restore(snapshotPath, destination, error), qUtf8Printable(error));
+
+    QFile file(destination);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QVERIFY(restored.setContent(&file));
+}
@@ -29,6 +29,8 @@
 
 #include <QtTest>
 #include "../ifc/xml/vdomdocument.h"
+#include "../ifc/xml/vdomelementdiff.h"
+#include "../ifc/exception/vexceptionconversionerror.h"
 
 //---------------------------------------------------------------------------------------------------------------------
 TST_VDomDocument::TST_VDomDocument(QObject *parent)
@@ -155,3 +157,118 @@ void TST_VDomDocument::TestCompareDomElements()
     const bool result = VDomDocument::Compare(element1, element2);
     QCOMPARE(compare, result);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDomDocument::TestAttributeDouble_data()
+{
+    QTest::addColumn<QString>("content");
+    QTest::addColumn<qreal>("value");
+    QTest::addColumn<bool>("ok");
+
+    QTest::newRow("Dot") << "<point mx=\"1.5\"/>" << 1.5 << true;
+    QTest::newRow("Comma") << "<point mx=\"1,5\"/>" << 1.5 << true;
+    QTest::newRow("Exponent") << "<point mx=\"-2.5e-1\"/>" << -0.25 << true;
+    QTest::newRow("Empty") << "<point mx=\"\"/>" << 7.0 << true;
+    QTest::newRow("Missing") << "<point/>" << 7.0 << true;
+    QTest::newRow("Broken") << "<point mx=\"1.5cm\"/>" << 7.0 << false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDomDocument::TestAttributeDouble()
+{
+    QFETCH(QString, content);
+    QFETCH(qreal, value);
+    QFETCH(bool, ok);
+
+    QDomDocument xmlDoc;
+    QVERIFY(xmlDoc.setContent(content));
+    const QDomElement element = xmlDoc.documentElement();
+
+    bool converted = not ok;
+    QCOMPARE(VDomDocument::AttributeDouble(element, QStringLiteral("mx"), 7.0, &converted), value);
+    QCOMPARE(converted, ok);
+
+    if (ok)
+    {
+        QCOMPARE(VDomDocument::GetParametrDouble(element, QStringLiteral("mx"), QStringLiteral("7")), value);
+    }
+    else
+    {
+        QVERIFY_EXCEPTION_THROWN(VDomDocument::GetParametrDouble(element, QStringLiteral("mx"), QStringLiteral("7")),
+                                 VExceptionConversionError);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDomDocument::TestAttributeBool()
+{
+    QDomDocument xmlDoc;
+    QVERIFY(xmlDoc.setContent(QStringLiteral("<node a=\"true\" b=\"0\" c=\"yes\"/>")));
+    const QDomElement element = xmlDoc.documentElement();
+
+    bool ok = false;
+    QCOMPARE(VDomDocument::AttributeBool(element, QStringLiteral("a"), false, &ok), true);
+    QVERIFY(ok);
+    QCOMPARE(VDomDocument::AttributeBool(element, QStringLiteral("b"), true, &ok), false);
+    QVERIFY(ok);
+    QCOMPARE(VDomDocument::AttributeBool(element, QStringLiteral("c"), true, &ok), true);
+    QVERIFY(not ok);
+    QCOMPARE(VDomDocument::AttributeBool(element, QStringLiteral("d"), false, &ok), false);
+    QVERIFY(ok);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDomDocument::TestElementDiff_data()
+{
+    QTest::addColumn<QString>("oldContent");
+    QTest::addColumn<QString>("newContent");
+
+    QTest::newRow("Same element")
+            << "<point id=\"1\" name=\"A\" x=\"1\"/>"
+            << "<point id=\"1\" name=\"A\" x=\"1\"/>";
+
+    QTest::newRow("Changed, added and removed attributes")
+            << "<point id=\"1\" name=\"A\" x=\"1\" typeLine=\"hair\"/>"
+            << "<point id=\"1\" name=\"B\" x=\"1\" lineColor=\"red\"/>";
+
+    QTest::newRow("Attribute of a child")
+            << "<operation id=\"5\"><source><item idObject=\"1\"/><item idObject=\"2\"/></source></operation>"
+            << "<operation id=\"5\"><source><item idObject=\"1\"/><item idObject=\"3\"/></source></operation>";
+
+    QTest::newRow("Added child")
+            << "<operation id=\"5\"><source><item idObject=\"1\"/></source><destination/></operation>"
+            << "<operation id=\"5\" suffix=\"a\"><source><item idObject=\"1\"/><item idObject=\"2\"/></source>"
+               "<destination/></operation>";
+
+    QTest::newRow("Removed all children")
+            << "<operation id=\"5\"><source><item idObject=\"1\"/></source></operation>"
+            << "<operation id=\"5\"/>";
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDomDocument::TestElementDiff()
+{
+    QFETCH(QString, oldContent);
+    QFETCH(QString, newContent);
+
+    QDomDocument oldDoc;
+    QVERIFY(oldDoc.setContent(oldContent));
+    const QDomElement oldElement = oldDoc.documentElement();
+
+    QDomDocument newDoc;
+    QVERIFY(newDoc.setContent(newContent));
+    const QDomElement newElement = newDoc.documentElement();
+
+    const VDomElementDiff diff = VDomElementDiff::FromData(VDomElementDiff(oldElement, newElement).Data());
+    QCOMPARE(diff.IsEmpty(), VDomDocument::Compare(oldElement, newElement));
+
+    QDomDocument xmlDoc;
+    QVERIFY(xmlDoc.setContent(oldContent));
+    QDomElement element = xmlDoc.documentElement();
+
+    diff.Redo(element);
+    QVERIFY(VDomDocument::Compare(element, newElement));
+
+    diff.Undo(element);
+    QVERIFY(VDomDocument::Compare(element, oldElement));
+}
@@ -39,6 +39,11 @@ public:
 private slots:
     void TestCompareDomElements_data();
     void TestCompareDomElements();
+    void TestAttributeDouble_data();
+    void TestAttributeDouble();
+    void TestAttributeBool();
+    void TestElementDiff_data();
+    void TestElementDiff();
 private:
     Q_DISABLE_COPY(TST_VDomDocument)
 };
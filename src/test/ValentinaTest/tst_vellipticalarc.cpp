@@ -462,6 +462,49 @@ void TST_VEllipticalArc::TestGetPoints5()
     QCOMPARE(f2, enAngle);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VEllipticalArc::TestGetPoints6_data()
+{
+    TestData();
+
+    // Values from collection file bugs/Issue_#963.val
+    QTest::newRow("Issue #963, radiuses 8, 8, rotation 360") << 8.0 << 8.0 << 0.0 << 0.0 << 360.0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VEllipticalArc::TestGetPoints6()
+{
+    // Flattened arc must run from the start angle to the end angle as angles of rays from the center
+    QFETCH(qreal, radius1);
+    QFETCH(qreal, radius2);
+    QFETCH(qreal, startAngle);
+    QFETCH(qreal, endAngle);
+    QFETCH(qreal, rotationAngle);
+
+    const VPointF center;
+    VEllipticalArc arc(center, radius1, radius2, startAngle, endAngle, rotationAngle);
+    const QVector<QPointF> points = arc.GetPoints();
+
+    QVERIFY(points.size() >= 2);
+    QCOMPARE(points.first(), arc.GetP1());
+    QCOMPARE(points.last(), arc.GetP2());
+
+    const qreal angleEps = 0.001;
+    const qreal sweep = arc.AngleArc();
+    qreal previous = 0;
+    for (int i = 1; i < points.size() - 1; ++i)
+    {
+        const qreal angle = QLineF(static_cast<QPointF>(center), points.at(i)).angle() - rotationAngle;
+        const qreal fromStart = VEllipticalArc::OptimizeAngle(angle - startAngle);
+
+        const QString errorMsg = QString("Point %1 has angle %2 from the start, previous %3, arc %4.")
+                .arg(i).arg(fromStart).arg(previous).arg(sweep);
+        QVERIFY2(fromStart >= previous - angleEps && fromStart <= sweep + angleEps, qUtf8Printable(errorMsg));
+        previous = fromStart;
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void TST_VEllipticalArc::TestRotation_data()
 {
@@ -560,3 +603,40 @@ void TST_VEllipticalArc::TestFlip()
     QCOMPARE(elArc.GetRadius1(), res.GetRadius1());
     QCOMPARE(elArc.GetRadius2(), res.GetRadius2());
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VEllipticalArc::TestCutArc_data()
+{
+    QTest::addColumn<VEllipticalArc>("elArc");
+    QTest::addColumn<qreal>("cutLength");
+
+    QTest::newRow("Half of ellipse") << VEllipticalArc(VPointF(), 100., 200., 0., 360., 0.) << 300.;
+    QTest::newRow("Flat ellipse") << VEllipticalArc(VPointF(), 1500., 15., 10., 200., 30.) << 700.;
+    QTest::newRow("Rotated arc") << VEllipticalArc(VPointF(10, 10), 150., 400., 20., 120., 80.) << 100.;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VEllipticalArc::TestCutArc()
+{
+    QFETCH(VEllipticalArc, elArc);
+    QFETCH(qreal, cutLength);
+
+    VEllipticalArc arc1;
+    VEllipticalArc arc2;
+    const QPointF p = elArc.CutArc(cutLength, arc1, arc2);
+
+    const qreal eps = ToPixel(0.01, Unit::Mm);
+    QVERIFY2(qAbs(arc1.GetLength() - cutLength) <= eps,
+             qUtf8Printable(QString("First arc length %1, expected %2.").arg(arc1.GetLength()).arg(cutLength)));
+    QVERIFY2(qAbs(arc1.GetLength() + arc2.GetLength() - elArc.GetLength()) <= eps,
+             qUtf8Printable(QString("Sum of lengths %1, expected %2.")
+                            .arg(arc1.GetLength() + arc2.GetLength()).arg(elArc.GetLength())));
+
+    QVERIFY(VFuzzyComparePoints(p, arc1.GetP2()));
+    QVERIFY(VFuzzyComparePoints(p, arc2.GetP1()));
+
+    // Flattened arc must start and end exactly where the arc does
+    const QVector<QPointF> points = elArc.GetPoints();
+    QCOMPARE(points.first(), elArc.GetP1());
+    QCOMPARE(points.last(), elArc.GetP2());
+}
@@ -51,10 +51,14 @@ private slots:
     void TestGetPoints4();
     void TestGetPoints5_data();
     void TestGetPoints5();
+    void TestGetPoints6_data();
+    void TestGetPoints6();
     void TestRotation_data();
     void TestRotation();
     void TestFlip_data();
     void TestFlip();
+    void TestCutArc_data();
+    void TestCutArc();
 
 private:
     Q_DISABLE_COPY(TST_VEllipticalArc)
@@ -0,0 +1,348 @@
+/************************************************************************
+ **
+ **  @file   tst_vgroupindex.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_vgroupindex.h"
+#include "../ifc/xml/vgroupindex.h"
+
+#include <QMap>
+#include <QSet>
+#include <QStringList>
+#include <QtTest>
+
+namespace
+{
+/**
+ * @brief GroupModel straightforward model of groups the index must agree with.
+ */
+struct GroupModel
+{
+    QMap<vidtype, VGroupIndex::Group> groups{};
+    QSet<VGroupIndex::Item>           items{};
+    QSet<QString>                     draws{};
+
+    //-----------------------------------------------------------------------------------------------------------------
+    bool IsItemVisible(const VGroupIndex::Item &item) const
+    {
+        bool grouped = false;
+        for (auto &group : groups)
+        {
+            if (group.items.contains(item))
+            {
+                if (group.visible)
+                {
+                    return true;
+                }
+                grouped = true;
+            }
+        }
+        return not grouped;
+    }
+
+    //-----------------------------------------------------------------------------------------------------------------
+    vidtype LinkedGroup(vidtype tool) const
+    {
+        for (auto i = groups.constBegin(); i != groups.constEnd(); ++i)
+        {
+            if (i->tool == tool)
+            {
+                return i.key();
+            }
+        }
+        return null_id;
+    }
+
+    //-----------------------------------------------------------------------------------------------------------------
+    QList<vidtype> DrawGroups(const QString &draw) const
+    {
+        QList<vidtype> ids;
+        for (auto i = groups.constBegin(); i != groups.constEnd(); ++i)
+        {
+            if (i->draw == draw)
+            {
+                ids.append(i.key());
+            }
+        }
+        return ids;
+    }
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+vidtype Id(const QStringList &args, int i)
+{
+    return args.at(i).toUInt();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Apply run one operation on both the index and the model.
+ *
+ * Operations:
+ * insert <id> <draw> <tool> <visible> [<tool>:<object> ...]
+ * remove <id>
+ * add <id> <tool> <object>
+ * take <id> <tool> <object>
+ * visible <id> <0|1>
+ * cleardraw <draw>
+ * rename <old draw> <new draw>
+ */
+void Apply(const QString &operation, VGroupIndex &index, GroupModel &model)
+{
+    const QStringList args = operation.split(QChar(' '));
+    const QString &name = args.first();
+
+    if (name == QLatin1String("insert"))
+    {
+        VGroupIndex::Group group;
+        group.draw = args.at(2);
+        group.name = QStringLiteral("Group %1").arg(args.at(1));
+        group.tool = Id(args, 3);
+        group.visible = args.at(4) == QLatin1String("1");
+        for (int i = 5; i < args.size(); ++i)
+        {
+            const QStringList ids = args.at(i).split(QChar(':'));
+            const VGroupIndex::Item item(ids.at(0).toUInt(), ids.at(1).toUInt());
+            group.items.insert(item);
+            model.items.insert(item);
+        }
+        model.draws.insert(group.draw);
+
+        index.Insert(Id(args, 1), group);
+        model.groups.insert(Id(args, 1), group);
+    }
+    else if (name == QLatin1String("remove"))
+    {
+        index.Remove(Id(args, 1));
+        model.groups.remove(Id(args, 1));
+    }
+    else if (name == QLatin1String("add") || name == QLatin1String("take"))
+    {
+        const vidtype id = Id(args, 1);
+        const VGroupIndex::Item item(Id(args, 2), Id(args, 3));
+        model.items.insert(item);
+
+        const bool exists = model.groups.contains(id);
+        if (name == QLatin1String("add"))
+        {
+            const bool expected = exists && not model.groups.value(id).items.contains(item);
+            QCOMPARE(index.AddItem(id, item.first, item.second), expected);
+            if (expected)
+            {
+                model.groups[id].items.insert(item);
+            }
+        }
+        else
+        {
+            const bool expected = exists && model.groups.value(id).items.contains(item);
+            QCOMPARE(index.RemoveItem(id, item.first, item.second), expected);
+            if (expected)
+            {
+                model.groups[id].items.remove(item);
+            }
+        }
+    }
+    else if (name == QLatin1String("visible"))
+    {
+        const bool visible = args.at(2) == QLatin1String("1");
+        index.SetVisible(Id(args, 1), visible);
+        if (model.groups.contains(Id(args, 1)))
+        {
+            model.groups[Id(args, 1)].visible = visible;
+        }
+    }
+    else if (name == QLatin1String("cleardraw"))
+    {
+        index.ClearDraw(args.at(1));
+        const QList<vidtype> ids = model.DrawGroups(args.at(1));
+        for (auto id : ids)
+        {
+            model.groups.remove(id);
+        }
+    }
+    else if (name == QLatin1String("rename"))
+    {
+        index.RenameDraw(args.at(1), args.at(2));
+        for (auto &group : model.groups)
+        {
+            if (group.draw == args.at(1))
+            {
+                group.draw = args.at(2);
+            }
+        }
+        model.draws.insert(args.at(2));
+    }
+    else
+    {
+        QFAIL(qUtf8Printable(QStringLiteral("Unknown operation '%1'.").arg(operation)));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void Compare(const VGroupIndex &index, const GroupModel &model, const QSet<vidtype> &knownIds)
+{
+    for (auto id : knownIds)
+    {
+        QCOMPARE(index.Contains(id), model.groups.contains(id));
+    }
+
+    for (auto i = model.groups.constBegin(); i != model.groups.constEnd(); ++i)
+    {
+        const VGroupIndex::Group group = index.Value(i.key());
+        QCOMPARE(group.draw, i->draw);
+        QCOMPARE(group.visible, i->visible);
+        QCOMPARE(group.tool, i->tool);
+        QVERIFY(group.items == i->items);
+
+        if (i->tool != null_id)
+        {
+            QCOMPARE(index.LinkedGroup(i->tool), model.LinkedGroup(i->tool));
+        }
+    }
+
+    for (auto &draw : model.draws)
+    {
+        QCOMPARE(index.DrawGroups(draw), model.DrawGroups(draw));
+    }
+
+    for (auto &item : model.items)
+    {
+        QCOMPARE(index.IsItemVisible(item), model.IsItemVisible(item));
+
+        for (auto id : knownIds)
+        {
+            const bool expected = model.groups.contains(id) && model.groups.value(id).items.contains(item);
+            QCOMPARE(index.HasItem(id, item.first, item.second), expected);
+        }
+    }
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VGroupIndex::TST_VGroupIndex(QObject *parent)
+    : AbstractTest(parent)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VGroupIndex::Consistency_data()
+{
+    QTest::addColumn<QStringList>("operations");
+    QTest::addColumn<QList<vidtype>>("unlinkedTools");
+
+    QTest::newRow("Single group")
+            << QStringList{"insert 1 A 0 1 10:11 12:13",
+                           "visible 1 0",
+                           "add 1 14 15",
+                           "take 1 10 11",
+                           "visible 1 1",
+                           "remove 1"}
+            << QList<vidtype>();
+
+    QTest::newRow("Shared items")
+            << QStringList{"insert 1 A 0 1 10:11 12:13",
+                           "insert 2 A 0 1 12:13 14:15",
+                           "visible 1 0",
+                           "visible 2 0",
+                           "visible 1 1",
+                           "take 1 12 13",
+                           "remove 2",
+                           "add 1 12 13"}
+            << QList<vidtype>();
+
+    QTest::newRow("Replace group")
+            << QStringList{"insert 1 A 0 1 10:11 12:13",
+                           "insert 1 A 0 0 12:13 14:15",
+                           "insert 1 B 0 1"}
+            << QList<vidtype>();
+
+    QTest::newRow("Rejected changes")
+            << QStringList{"insert 1 A 0 1 10:11",
+                           "add 1 10 11",
+                           "take 1 12 13",
+                           "add 2 10 11",
+                           "take 2 10 11",
+                           "visible 2 0",
+                           "remove 2"}
+            << QList<vidtype>();
+
+    QTest::newRow("Object of other tool")
+            << QStringList{"insert 1 A 0 0 10:11",
+                           "add 1 11 10",
+                           "take 1 11 10"}
+            << QList<vidtype>();
+
+    QTest::newRow("Pattern pieces")
+            << QStringList{"insert 1 A 0 1 10:11",
+                           "insert 2 B 0 0 10:11 12:13",
+                           "insert 3 A 0 0 12:13",
+                           "rename A C",
+                           "cleardraw B",
+                           "cleardraw C"}
+            << QList<vidtype>();
+
+    QTest::newRow("Linked groups")
+            << QStringList{"insert 1 A 20 1 10:11",
+                           "insert 2 A 21 0 12:13",
+                           "insert 2 A 22 0 12:13",
+                           "remove 1"}
+            << QList<vidtype>{20, 21};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VGroupIndex::Consistency()
+{
+    QFETCH(QStringList, operations);
+    QFETCH(QList<vidtype>, unlinkedTools);
+
+    VGroupIndex index;
+    GroupModel model;
+    QSet<vidtype> knownIds;
+
+    for (auto &operation : qAsConst(operations))
+    {
+        knownIds.insert(operation.section(QChar(' '), 1, 1).toUInt());
+
+        Apply(operation, index, model);
+        if (QTest::currentTestFailed())
+        {
+            QFAIL(qUtf8Printable(QStringLiteral("Failed operation '%1'.").arg(operation)));
+        }
+
+        Compare(index, model, knownIds);
+        if (QTest::currentTestFailed())
+        {
+            QFAIL(qUtf8Printable(QStringLiteral("Index differs from model after '%1'.").arg(operation)));
+        }
+    }
+
+    // Tools of removed or replaced groups are not linked anymore
+    for (auto tool : unlinkedTools)
+    {
+        QCOMPARE(index.LinkedGroup(tool), null_id);
+    }
+}
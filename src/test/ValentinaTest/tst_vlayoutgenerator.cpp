@@ -0,0 +1,347 @@
+/************************************************************************
+ **
+ **  @file   tst_vlayoutgenerator.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_vlayoutgenerator.h"
+#include "../vlayout/vlayoutcache.h"
+#include "../vlayout/vlayoutgenerator.h"
+#include "../vlayout/vlayoutoptimizer.h"
+#include "../vlayout/vlayoutpiece.h"
+#include "../vmisc/def.h"
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QThread>
+#include <QtTest>
+#include <limits>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QSizeF> PieceSizes()
+{
+    return QVector<QSizeF>{QSizeF(200, 300), QSizeF(150, 150), QSizeF(300, 100), QSizeF(100, 250), QSizeF(120, 80),
+                           QSizeF(250, 180)};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<VLayoutPiece> Pieces(const QVector<QSizeF> &sizes = PieceSizes())
+{
+    QVector<VLayoutPiece> pieces;
+    pieces.reserve(sizes.size());
+    for (int i = 0; i < sizes.size(); ++i)
+    {
+        const QRectF rect(QPointF(), sizes.at(i));
+        const QVector<QPointF> contour{rect.topLeft(), rect.topRight(), rect.bottomRight(), rect.bottomLeft(),
+                                       rect.topLeft()};
+
+        VLayoutPiece piece;
+        piece.SetName(QStringLiteral("Piece %1").arg(i + 1));
+        piece.SetId(static_cast<vidtype>(i + 1));
+        piece.SetCountourPoints(contour);
+        pieces.append(piece);
+    }
+    return pieces;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ChangedPieces return the same pieces, but the fifth one is smaller.
+ */
+QVector<VLayoutPiece> ChangedPieces()
+{
+    QVector<QSizeF> sizes = PieceSizes();
+    sizes[4] = QSizeF(100, 70);
+    return Pieces(sizes);
+}
+
+const vidtype changedPieceId = 5;
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VLayoutGenerator::TST_VLayoutGenerator(QObject *parent)
+    : AbstractTest(parent)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VLayoutGenerator::CacheRoundTrip()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    VLayoutCache::SetCacheDir(dir.path());
+
+    VLayoutGenerator generator;
+    Setup(generator, Pieces());
+    Run(generator);
+    QCOMPARE(generator.State(), LayoutErrors::NoError);
+
+    const QByteArray result = generator.SerializeResult();
+    QVERIFY(VLayoutCache::Save(generator, result));
+
+    // The same problem with the same budget is the answer
+    {
+        VLayoutGenerator same;
+        Setup(same, Pieces());
+
+        QByteArray loaded;
+        bool exactMatch = false;
+        QVERIFY(VLayoutCache::Load(same, loaded, exactMatch));
+        QVERIFY(exactMatch);
+        QCOMPARE(loaded, result);
+        QCOMPARE(same.PapersCount(), generator.PapersCount());
+        QCOMPARE(same.LayoutEfficiency(), generator.LayoutEfficiency());
+    }
+
+    // Another budget continues the saved search
+    {
+        VLayoutGenerator longer;
+        Setup(longer, Pieces());
+        longer.SetNestingTime(generator.GetNestingTime() + 1);
+
+        QByteArray loaded;
+        bool exactMatch = true;
+        QVERIFY(VLayoutCache::Load(longer, loaded, exactMatch));
+        QVERIFY(not exactMatch);
+        QCOMPARE(loaded, result);
+        QCOMPARE(longer.GetStartShift(), generator.GetShift());
+        QCOMPARE(longer.GetRotationNumber(), generator.GetRotationNumber());
+    }
+
+    // Another paper is another problem
+    {
+        VLayoutGenerator other;
+        Setup(other, Pieces());
+        other.SetPaperWidth(generator.GetPaperWidth() + 100);
+
+        QByteArray loaded;
+        bool exactMatch = false;
+        QVERIFY(not VLayoutCache::Load(other, loaded, exactMatch));
+        QVERIFY(loaded.isEmpty());
+    }
+
+    VLayoutCache::SetCacheDir(QString());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VLayoutGenerator::CacheEviction()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    auto WriteFile = [&dir](const QString &name)
+    {
+        QFile file(dir.filePath(name));
+        return file.open(QIODevice::WriteOnly) && file.write(QByteArray(100, 'x')) == 100;
+    };
+
+    QVERIFY(WriteFile(QStringLiteral("1.layout")));
+    QVERIFY(WriteFile(QStringLiteral("2.layout")));
+    QVERIFY(WriteFile(QStringLiteral("3.layout")));
+    QVERIFY(WriteFile(QStringLiteral("other.txt")));
+
+    // Over the size limit
+    VLayoutCache::Evict(dir.path(), 250, 30);
+    QCOMPARE(QDir(dir.path()).entryList(QStringList(QStringLiteral("*.layout")), QDir::Files).size(), 2);
+
+    // Too old, every entry was written before now
+    VLayoutCache::Evict(dir.path(), 250, -1);
+    QVERIFY(QDir(dir.path()).entryList(QStringList(QStringLiteral("*.layout")), QDir::Files).isEmpty());
+
+    // Not a cache entry
+    QVERIFY(QFile::exists(dir.filePath(QStringLiteral("other.txt"))));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutGenerator::OptimizerDeterminism_data()
+{
+    QTest::addColumn<quint32>("seed");
+    QTest::addColumn<int>("rounds");
+
+    QTest::newRow("Seed 1, 4 rounds") << 1U << 4;
+    QTest::newRow("Seed 42, 8 rounds") << 42U << 8;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VLayoutGenerator::OptimizerDeterminism()
+{
+    // The same seed and the same number of rounds give the same layout. Time must not stop the search.
+    QFETCH(quint32, seed);
+    QFETCH(int, rounds);
+
+    QVector<VLayoutPiece> details = Pieces();
+    for (auto &detail : details)
+    {
+        detail.SetLayoutWidth(10);
+        detail.SetLayoutAllowancePoints();
+    }
+
+    VLayoutPaper paper(1000, 800, 10);
+    paper.SetShift(ToPixel(1, Unit::Cm));
+
+    auto NoTimeLimit = []()
+    {
+        return std::numeric_limits<qint64>::max();
+    };
+
+    QVector<QByteArray> results;
+    QVector<VLayoutGenome> genomes;
+    for (int i = 0; i < 2; ++i)
+    {
+        std::atomic_bool stop(false);
+        VLayoutOptimizer optimizer(details, paper, stop);
+        optimizer.SetSeed(seed);
+        QCOMPARE(optimizer.Run(rounds, NoTimeLimit), LayoutErrors::NoError);
+
+        QByteArray data;
+        QDataStream dataStream(&data, QIODevice::WriteOnly);
+        dataStream.setVersion(QDataStream::Qt_5_4);
+        dataStream << optimizer.BestResult();
+
+        results.append(data);
+        genomes.append(optimizer.BestGenome());
+    }
+
+    QVERIFY(genomes.first().IsValid(details.size()));
+    QCOMPARE(genomes.first().order, genomes.last().order);
+    QCOMPARE(genomes.first().orientation, genomes.last().orientation);
+    QCOMPARE(genomes.first().mirror, genomes.last().mirror);
+    QCOMPARE(results.first(), results.last());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VLayoutGenerator::RepairLayout()
+{
+    VLayoutGenerator previous;
+    Setup(previous, Pieces());
+    Run(previous);
+    QCOMPARE(previous.State(), LayoutErrors::NoError);
+    const QVector<QVector<VLayoutPiece>> previousLayout = previous.GetAllDetails();
+
+    const QVector<VLayoutPiece> changed = ChangedPieces();
+
+    VLayoutGenerator generator;
+    Setup(generator, changed);
+    generator.SetPreviousLayout(previousLayout);
+    generator.SetShift(-1);
+    generator.SetRotate(false);
+
+    QElapsedTimer timer;
+    timer.start();
+    QVERIFY(generator.Repair(timer, generator.GetNestingTimeMSecs()));
+    QCOMPARE(generator.State(), LayoutErrors::NoError);
+
+    QHash<vidtype, QTransform> previousPlaces;
+    for (auto &sheet : previousLayout)
+    {
+        for (auto &detail : sheet)
+        {
+            previousPlaces.insert(detail.GetId(), detail.GetMatrix());
+        }
+    }
+
+    // Unchanged pieces stay where they were, the changed one is placed again
+    int placed = 0;
+    const QVector<QVector<VLayoutPiece>> layout = generator.GetAllDetails();
+    for (auto &sheet : layout)
+    {
+        for (auto &detail : sheet)
+        {
+            ++placed;
+            if (detail.GetId() != changedPieceId)
+            {
+                QCOMPARE(detail.GetMatrix(), previousPlaces.value(detail.GetId()));
+            }
+        }
+    }
+    QCOMPARE(placed, changed.size());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VLayoutGenerator::RepairFallback()
+{
+    // A failed repair must leave the generator ready for the same full nesting as without repair
+    VLayoutGenerator previous;
+    Setup(previous, Pieces());
+    Run(previous);
+    QCOMPARE(previous.State(), LayoutErrors::NoError);
+
+    VLayoutGenerator reference;
+    Setup(reference, ChangedPieces());
+    reference.SetStripOptimization(true);
+    Run(reference);
+    QCOMPARE(reference.State(), LayoutErrors::NoError);
+
+    VLayoutGenerator generator;
+    Setup(generator, ChangedPieces());
+    generator.SetStripOptimization(true);
+    generator.SetPreviousLayout(previous.GetAllDetails());
+    generator.SetShift(-1);
+    generator.SetRotate(false);
+
+    // No time left for the changed piece
+    QElapsedTimer timer;
+    timer.start();
+    QThread::msleep(5);
+    QVERIFY(not generator.Repair(timer, 1));
+    QCOMPARE(generator.PapersCount(), 0);
+
+    timer.restart();
+    generator.Generate(timer, generator.GetNestingTimeMSecs());
+    QCOMPARE(generator.State(), LayoutErrors::NoError);
+    QCOMPARE(generator.PapersCount(), reference.PapersCount());
+    QCOMPARE(generator.LayoutEfficiency(), reference.LayoutEfficiency());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutGenerator::Setup(VLayoutGenerator &generator, const QVector<VLayoutPiece> &details)
+{
+    generator.SetDetails(details);
+    generator.SetLayoutWidth(10);
+    generator.SetCaseType(Cases::CaseDesc);
+    generator.SetPaperWidth(800);
+    generator.SetPaperHeight(1000);
+    generator.SetPrinterFields(false, QMarginsF());
+    generator.SetNestingTime(1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutGenerator::Run(VLayoutGenerator &generator)
+{
+    generator.SetShift(-1); // Trigger first shift calulation
+    generator.SetRotate(false);
+
+    QElapsedTimer timer;
+    timer.start();
+    generator.Generate(timer, generator.GetNestingTimeMSecs());
+}
@@ -0,0 +1,271 @@
+/************************************************************************
+ **
+ **  @file   tst_vlevelofdetail.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_vlevelofdetail.h"
+#include "../vwidgets/vlevelofdetail.h"
+
+#include <QLineF>
+#include <QPainterPath>
+#include <QPolygonF>
+#include <QVector>
+#include <QtMath>
+#include <QtTest>
+#include <limits>
+
+namespace
+{
+// Simplified path may differ from the original one not more than half of a device pixel
+const qreal maxErrorPx = 0.5;
+
+//---------------------------------------------------------------------------------------------------------------------
+QPainterPath PathFromSubpaths(const QVector<QPolygonF> &subpaths)
+{
+    QPainterPath path;
+    for (auto &subpath : subpaths)
+    {
+        path.addPolygon(subpath);
+    }
+    return path;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QPolygonF Wave(const QPointF &start, int count, qreal step, qreal amplitude)
+{
+    QPolygonF wave;
+    wave.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+        wave.append(start + QPointF(i * step, amplitude * qSin(i * step / 10.)));
+    }
+    return wave;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QPolygonF ZigZag(const QPointF &start, int count, qreal step, qreal amplitude)
+{
+    QPolygonF zigZag;
+    zigZag.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+        zigZag.append(start + QPointF(i * step, i % 2 == 0 ? 0 : amplitude));
+    }
+    return zigZag;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+qreal DistanceToSegment(const QPointF &point, const QPointF &p1, const QPointF &p2)
+{
+    const QPointF d = p2 - p1;
+    const qreal squaredLength = QPointF::dotProduct(d, d);
+    if (qFuzzyIsNull(squaredLength))
+    {
+        return QLineF(point, p1).length();
+    }
+
+    const qreal t = qBound(0., QPointF::dotProduct(point - p1, d) / squaredLength, 1.);
+    return QLineF(point, p1 + t * d).length();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+qreal DistanceToPolyline(const QPointF &point, const QPolygonF &polyline)
+{
+    if (polyline.size() == 1)
+    {
+        return QLineF(point, polyline.first()).length();
+    }
+
+    qreal distance = std::numeric_limits<qreal>::max();
+    for (int i = 1; i < polyline.size(); ++i)
+    {
+        distance = qMin(distance, DistanceToSegment(point, polyline.at(i - 1), polyline.at(i)));
+    }
+    return distance;
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VLevelOfDetail::TST_VLevelOfDetail(QObject *parent)
+    : AbstractTest(parent)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VLevelOfDetail::Bucket_data()
+{
+    QTest::addColumn<qreal>("lod");
+    QTest::addColumn<int>("bucket");
+
+    QTest::newRow("Zoom in") << 4. << 0;
+    QTest::newRow("100%") << 1. << 0;
+    QTest::newRow("Zero") << 0. << 0;
+    QTest::newRow("Negative") << -0.5 << 0;
+    QTest::newRow("Just below 100%") << 0.999 << 1;
+    QTest::newRow("50%") << 0.5 << 1;
+    QTest::newRow("Just below 50%") << 0.499 << 2;
+    QTest::newRow("25%") << 0.25 << 2;
+    QTest::newRow("10%") << 0.1 << 4;
+    QTest::newRow("1/4096") << 1. / 4096. << 12;
+    QTest::newRow("Below 1/4096") << 1. / 5000. << 12;
+    QTest::newRow("Tiny") << 1e-9 << 12;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VLevelOfDetail::Bucket()
+{
+    QFETCH(qreal, lod);
+    QFETCH(int, bucket);
+
+    QCOMPARE(VPathLevelOfDetail::Bucket(lod), bucket);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BucketBounds bucket n takes level of detail from 2^-n up to, but not including, 2^(1-n).
+ */
+// cppcheck-suppress unusedFunction
+void TST_VLevelOfDetail::BucketBounds()
+{
+    for (int bucket = 1; bucket <= 12; ++bucket)
+    {
+        const qreal lower = qPow(2, -bucket);
+        const qreal upper = qPow(2, 1 - bucket);
+
+        QCOMPARE(VPathLevelOfDetail::Bucket(lower), bucket);
+        QCOMPARE(VPathLevelOfDetail::Bucket(upper * 0.999), bucket);
+        QCOMPARE(VPathLevelOfDetail::Bucket(upper), bucket - 1);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VLevelOfDetail::Decimate_data()
+{
+    QTest::addColumn<QVector<QPolygonF>>("subpaths");
+    QTest::addColumn<qreal>("lod");
+
+    const QVector<QPolygonF> wave{Wave(QPointF(), 2000, 0.1, 50)};
+    const QVector<QPolygonF> zigZag{ZigZag(QPointF(), 1000, 0.3, 2)};
+    const QVector<QPolygonF> marks{ZigZag(QPointF(), 20, 0.05, 0.05),
+                                   Wave(QPointF(0, 100), 500, 0.2, 10),
+                                   QPolygonF(QVector<QPointF>{QPointF(300, 300), QPointF(300.01, 300.01)}),
+                                   ZigZag(QPointF(0, 200), 300, 1, 3)};
+
+    const QVector<qreal> lods{0.9, 0.5, 0.3, 0.1, 0.01, 0.001};
+    for (auto lod : lods)
+    {
+        QTest::newRow(qUtf8Printable(QStringLiteral("Wave, lod %1").arg(lod))) << wave << lod;
+        QTest::newRow(qUtf8Printable(QStringLiteral("Zigzag, lod %1").arg(lod))) << zigZag << lod;
+        QTest::newRow(qUtf8Printable(QStringLiteral("Subpaths, lod %1").arg(lod))) << marks << lod;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VLevelOfDetail::Decimate()
+{
+    QFETCH(QVector<QPolygonF>, subpaths);
+    QFETCH(qreal, lod);
+
+    const QPainterPath path = PathFromSubpaths(subpaths);
+
+    VPathLevelOfDetail levelOfDetail;
+    const QPainterPath simplified = levelOfDetail.Path(path, lod);
+
+    QVERIFY(simplified.elementCount() <= path.elementCount());
+    QCOMPARE(simplified.fillRule(), path.fillRule());
+
+    const QList<QPolygonF> original = path.toSubpathPolygons();
+    const QList<QPolygonF> result = simplified.toSubpathPolygons();
+    QCOMPARE(result.size(), original.size());
+
+    for (int i = 0; i < original.size(); ++i)
+    {
+        // Subpath ends never move
+        QCOMPARE(result.at(i).first(), original.at(i).first());
+        QCOMPARE(result.at(i).last(), original.at(i).last());
+
+        for (auto &point : original.at(i))
+        {
+            const qreal error = DistanceToPolyline(point, result.at(i)) * lod;
+            QVERIFY2(error <= maxErrorPx + 1e-9,
+                     qUtf8Printable(QStringLiteral("Point (%1; %2) is %3 px away.")
+                                    .arg(point.x()).arg(point.y()).arg(error)));
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VLevelOfDetail::DecimateKeepsCurves()
+{
+    QPainterPath path;
+    path.addPolygon(ZigZag(QPointF(), 100, 0.1, 0.1));
+    path.cubicTo(QPointF(20, 20), QPointF(30, -20), QPointF(40, 0));
+    path.lineTo(40.05, 0.05);
+    path.lineTo(40.1, 0);
+
+    const QPainterPath simplified = DecimatePath(path, 1);
+
+    int curves = 0;
+    for (int i = 0; i < simplified.elementCount(); ++i)
+    {
+        if (simplified.elementAt(i).isCurveTo())
+        {
+            ++curves;
+            QCOMPARE(QPointF(simplified.elementAt(i)), QPointF(20, 20));
+            QCOMPARE(QPointF(simplified.elementAt(i + 1)), QPointF(30, -20));
+            QCOMPARE(QPointF(simplified.elementAt(i + 2)), QPointF(40, 0));
+        }
+    }
+    QCOMPARE(curves, 1);
+    QCOMPARE(simplified.currentPosition(), path.currentPosition());
+    QVERIFY(simplified.elementCount() < path.elementCount());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VLevelOfDetail::PathVariants()
+{
+    const QPainterPath path = PathFromSubpaths({Wave(QPointF(), 1000, 0.1, 20)});
+
+    VPathLevelOfDetail levelOfDetail;
+
+    // At 100% zoom and above the original path is drawn
+    QCOMPARE(levelOfDetail.Path(path, 1), path);
+    QCOMPARE(levelOfDetail.Path(path, 2), path);
+
+    const QPainterPath simplified = levelOfDetail.Path(path, 0.1);
+    QVERIFY(simplified.elementCount() < path.elementCount());
+    QCOMPARE(levelOfDetail.Path(path, 0.07), simplified); // Same bucket
+
+    // New path drops old variants
+    const QPainterPath other = PathFromSubpaths({Wave(QPointF(0, 50), 1000, 0.1, 20)});
+    QVERIFY(not (levelOfDetail.Path(other, 0.1) == simplified));
+    QCOMPARE(levelOfDetail.Path(other, 0.1).currentPosition(), other.currentPosition());
+}
@@ -0,0 +1,147 @@
+/************************************************************************
+ **
+ **  @file   tst_vmaingraphicsscene.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_vmaingraphicsscene.h"
+#include "../vwidgets/vmaingraphicsscene.h"
+
+#include <QGraphicsRectItem>
+#include <QtTest>
+
+namespace
+{
+// Bounding rect of the two items that stay untouched by the tests
+const QRectF innerRect(0, 0, 50, 50);
+
+// Bounding rect of all items before the item on the edge changes
+const QRectF outerRect(0, 0, 110, 110);
+
+//---------------------------------------------------------------------------------------------------------------------
+QGraphicsRectItem *AddRect(VMainGraphicsScene &scene, const QRectF &rect)
+{
+    auto *item = new QGraphicsRectItem(rect);
+    item->setPen(Qt::NoPen);
+    scene.addItem(item);
+    return item;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FillScene add two inner items and one item on the right bottom edge. Fills the cached rect.
+ */
+QGraphicsRectItem *FillScene(VMainGraphicsScene &scene)
+{
+    AddRect(scene, QRectF(0, 0, 10, 10));
+    AddRect(scene, QRectF(40, 40, 10, 10));
+    QGraphicsRectItem *edgeItem = AddRect(scene, QRectF(100, 100, 10, 10));
+
+    const QRectF rect = scene.VisibleItemsBoundingRect();
+    if (rect != outerRect)
+    {
+        qWarning("Unexpected initial visible items rect.");
+    }
+    return edgeItem;
+}
+}  // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VMainGraphicsScene::TST_VMainGraphicsScene(QObject *parent)
+    : AbstractTest(parent)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VMainGraphicsScene::GrowVisibleItemsRect()
+{
+    VMainGraphicsScene scene;
+    QGraphicsRectItem *edgeItem = FillScene(scene);
+    QCOMPARE(scene.VisibleItemsBoundingRect(), outerRect);
+
+    AddRect(scene, QRectF(-20, 60, 10, 10));
+    QCOMPARE(scene.VisibleItemsBoundingRect(), QRectF(-20, 0, 130, 110));
+
+    edgeItem->setPos(100, 0);
+    QCOMPARE(scene.VisibleItemsBoundingRect(), QRectF(-20, 0, 230, 110));
+
+    auto *hidden = AddRect(scene, QRectF(0, -300, 10, 10));
+    hidden->setVisible(false);
+    QCOMPARE(scene.VisibleItemsBoundingRect(), QRectF(-20, 0, 230, 110));
+
+    hidden->setVisible(true);
+    QCOMPARE(scene.VisibleItemsBoundingRect(), QRectF(-20, -300, 230, 410));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VMainGraphicsScene::MoveEdgeItemInside()
+{
+    VMainGraphicsScene scene;
+    QGraphicsRectItem *edgeItem = FillScene(scene);
+
+    edgeItem->setPos(-80, -80);
+    QCOMPARE(scene.VisibleItemsBoundingRect(), innerRect);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VMainGraphicsScene::HideEdgeItem()
+{
+    VMainGraphicsScene scene;
+    QGraphicsRectItem *edgeItem = FillScene(scene);
+
+    edgeItem->setVisible(false);
+    QCOMPARE(scene.VisibleItemsBoundingRect(), innerRect);
+
+    edgeItem->setVisible(true);
+    QCOMPARE(scene.VisibleItemsBoundingRect(), outerRect);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VMainGraphicsScene::ShrinkEdgeItem()
+{
+    VMainGraphicsScene scene;
+    QGraphicsRectItem *edgeItem = FillScene(scene);
+
+    edgeItem->setRect(QRectF(100, 100, 5, 5));
+    QCOMPARE(scene.VisibleItemsBoundingRect(), QRectF(0, 0, 105, 105));
+
+    edgeItem->setRect(QRectF(20, 20, 5, 5));
+    QCOMPARE(scene.VisibleItemsBoundingRect(), innerRect);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VMainGraphicsScene::RemoveEdgeItem()
+{
+    VMainGraphicsScene scene;
+    QGraphicsRectItem *edgeItem = FillScene(scene);
+
+    scene.removeItem(edgeItem);
+    delete edgeItem;
+    QCOMPARE(scene.VisibleItemsBoundingRect(), innerRect);
+}
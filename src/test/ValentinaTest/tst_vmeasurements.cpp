@@ -32,6 +32,7 @@
 #include "../ifc/xml/vvitconverter.h"
 #include "../vpatterndb/vcontainer.h"
 #include "../vpatterndb/pmsystems.h"
+#include "../vpatterndb/variables/vmeasurement.h"
 
 #include <QtTest>
 
@@ -237,3 +238,98 @@ void TST_VMeasurements::ValidPMCodesIndividualFile()
         }
     }
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ForwardReferences check that formula can reference measurement defined below it.
+ */
+void TST_VMeasurements::ForwardReferences()
+{
+    Unit mUnit = Unit::Cm;
+
+    QSharedPointer<VContainer> data = QSharedPointer<VContainer>(new VContainer(nullptr, &mUnit,
+                                                                                VContainer::UniqueNamespace()));
+
+    QSharedPointer<VMeasurements> m =
+            QSharedPointer<VMeasurements>(new VMeasurements(mUnit, data.data()));
+
+    m->AddEmpty(QStringLiteral("@a"), QStringLiteral("@b*2"));
+    m->AddEmpty(QStringLiteral("@b"), QStringLiteral("10"));
+    m->AddEmpty(QStringLiteral("@c"), QStringLiteral("@a+1"));
+    m->ReadMeasurements(0, 0);
+
+    const QSharedPointer<VMeasurement> a = data->GetVariable<VMeasurement>(QStringLiteral("@a"));
+    QVERIFY(a->IsFormulaOk());
+    QCOMPARE(*a->GetValue(), 20.0);
+    QCOMPARE(a->Index(), 0);
+
+    const QSharedPointer<VMeasurement> c = data->GetVariable<VMeasurement>(QStringLiteral("@c"));
+    QVERIFY(c->IsFormulaOk());
+    QCOMPARE(*c->GetValue(), 21.0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IncrementalUpdate check that after edit only dependent measurements are evaluated again.
+ */
+void TST_VMeasurements::IncrementalUpdate()
+{
+    Unit mUnit = Unit::Cm;
+
+    QSharedPointer<VContainer> data = QSharedPointer<VContainer>(new VContainer(nullptr, &mUnit,
+                                                                                VContainer::UniqueNamespace()));
+
+    QSharedPointer<VMeasurements> m =
+            QSharedPointer<VMeasurements>(new VMeasurements(mUnit, data.data()));
+
+    m->AddEmpty(QStringLiteral("@a"), QStringLiteral("10"));
+    m->AddEmpty(QStringLiteral("@b"), QStringLiteral("@a*2"));
+    m->AddEmpty(QStringLiteral("@c"), QStringLiteral("5"));
+    m->AddEmpty(QStringLiteral("@d"), QStringLiteral("@b+@c"));
+    m->ReadMeasurements(0, 0);
+
+    m->SetMValue(QStringLiteral("@a"), QStringLiteral("20"));
+    const QStringList updated = m->ReadMeasurement(QStringLiteral("@a"), 0, 0);
+
+    const QStringList expected{QStringLiteral("@a"), QStringLiteral("@b"), QStringLiteral("@d")};
+    QCOMPARE(updated, expected);
+    QCOMPARE(*data->GetVariable<VMeasurement>(QStringLiteral("@b"))->GetValue(), 40.0);
+    QCOMPARE(*data->GetVariable<VMeasurement>(QStringLiteral("@d"))->GetValue(), 45.0);
+
+    // Same value. Nothing to propagate.
+    const QStringList same = m->ReadMeasurement(QStringLiteral("@c"), 0, 0);
+    QCOMPARE(same, QStringList{QStringLiteral("@c")});
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief DuplicateNames check that every measurement of a file with duplicate names is read once in file order.
+ */
+void TST_VMeasurements::DuplicateNames()
+{
+    Unit mUnit = Unit::Cm;
+
+    QSharedPointer<VContainer> data = QSharedPointer<VContainer>(new VContainer(nullptr, &mUnit,
+                                                                                VContainer::UniqueNamespace()));
+
+    QSharedPointer<VMeasurements> m =
+            QSharedPointer<VMeasurements>(new VMeasurements(mUnit, data.data()));
+
+    m->AddEmpty(QStringLiteral("@a"), QStringLiteral("10"));
+    m->AddEmpty(QStringLiteral("@b"), QStringLiteral("@a*2"));
+    m->AddEmpty(QStringLiteral("@a"), QStringLiteral("30"));
+    m->ReadMeasurements(0, 0);
+
+    // @b sees the first @a, the second one wins at the end
+    QCOMPARE(*data->GetVariable<VMeasurement>(QStringLiteral("@b"))->GetValue(), 20.0);
+
+    const QSharedPointer<VMeasurement> a = data->GetVariable<VMeasurement>(QStringLiteral("@a"));
+    QCOMPARE(*a->GetValue(), 30.0);
+    QCOMPARE(a->Index(), 2);
+
+    // Incremental update falls back to full read
+    const QStringList updated = m->ReadMeasurement(QStringLiteral("@b"), 0, 0);
+    QVERIFY(updated.contains(QStringLiteral("@a")));
+    QVERIFY(updated.contains(QStringLiteral("@b")));
+    QCOMPARE(*data->GetVariable<VMeasurement>(QStringLiteral("@b"))->GetValue(), 20.0);
+}
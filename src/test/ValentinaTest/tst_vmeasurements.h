@@ -43,6 +43,10 @@ private slots:
 
     void ValidPMCodesMultisizeFile();
     void ValidPMCodesIndividualFile();
+
+    void ForwardReferences();
+    void IncrementalUpdate();
+    void DuplicateNames();
 };
 
 #endif // TST_VMEASUREMENTS_H
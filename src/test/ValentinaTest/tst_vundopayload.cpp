@@ -0,0 +1,190 @@
+/************************************************************************
+ **
+ **  @file   tst_vundopayload.cpp
+ **  @author Roman Telezhynskyi <dismine(at)gmail.com>
+ **  @date   18 10, 2026
+ **
+ **  @brief
+ **  @copyright
+ **  This source code is part of the Valentina project, a pattern making
+ **  program, whose allow create and modeling patterns of clothing.
+ **  Copyright (C) 2026 Valentina project
+ **  <https://gitlab.com/smart-pattern/valentina> All Rights Reserved.
+ **
+ **  Valentina is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Valentina is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Valentina.  If not, see <http://www.gnu.org/licenses/>.
+ **
+ *************************************************************************/
+
+#include "tst_vundopayload.h"
+#include "../vtools/undocommands/vundopayload.h"
+
+#include <QVector>
+#include <QtTest>
+
+namespace
+{
+const int payloadSize = 64 * 1024;
+
+//---------------------------------------------------------------------------------------------------------------------
+QByteArray TextData(int size = payloadSize)
+{
+    QByteArray data;
+    data.reserve(size);
+    while (data.size() < size)
+    {
+        data.append("<point id=\"").append(QByteArray::number(data.size())).append("\" type=\"single\"/>");
+    }
+    data.truncate(size);
+    return data;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RandomData bytes that can't be compressed.
+ */
+QByteArray RandomData(quint32 seed, int size = payloadSize)
+{
+    QByteArray data(size, Qt::Uninitialized);
+    quint32 state = seed == 0 ? 1 : seed;
+    for (int i = 0; i < size; ++i)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        data[i] = static_cast<char>(state & 0xFF);
+    }
+    return data;
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VUndoPayload::TST_VUndoPayload(QObject *parent)
+    : AbstractTest(parent)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VUndoPayload::init()
+{
+    m_budget = VUndoPayload::Budget();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VUndoPayload::cleanup()
+{
+    VUndoPayload::SetBudget(m_budget);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VUndoPayload::RoundTrip_data()
+{
+    QTest::addColumn<QByteArray>("data");
+
+    QTest::newRow("Empty") << QByteArray();
+    QTest::newRow("Tiny") << QByteArray("<line id=\"1\"/>");
+    QTest::newRow("Text") << TextData();
+    QTest::newRow("Random") << RandomData(1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VUndoPayload::RoundTrip()
+{
+    QFETCH(QByteArray, data);
+
+    // Nothing but the newest payload may stay in memory
+    VUndoPayload::SetBudget(0);
+    const qint64 memoryUsage = VUndoPayload::MemoryUsage();
+
+    VUndoPayload oldest(data);
+    VUndoPayload older(data);
+    VUndoPayload newest(data);
+
+    QVERIFY(VUndoPayload::MemoryUsage() <= memoryUsage + data.size());
+    QCOMPARE(oldest.Data(), data);
+    QCOMPARE(older.Data(), data);
+    QCOMPARE(newest.Data(), data);
+
+    // New data makes a payload the newest one
+    const QByteArray changed = data + QByteArray("<changed/>");
+    oldest.SetData(changed);
+    QCOMPARE(oldest.Data(), changed);
+    QCOMPARE(older.Data(), data);
+    QCOMPARE(newest.Data(), data);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VUndoPayload::Compression()
+{
+    const QByteArray data = TextData();
+
+    VUndoPayload::SetBudget(VUndoPayload::MemoryUsage() + data.size() + data.size() / 2);
+    const qint64 spillFileSize = VUndoPayload::SpillFileSize();
+
+    VUndoPayload oldest(data);
+    VUndoPayload older(data);
+    VUndoPayload newest(data);
+
+    // Compressed copies fit the budget, nothing goes to the disk
+    QVERIFY(VUndoPayload::MemoryUsage() <= VUndoPayload::Budget());
+    QCOMPARE(VUndoPayload::SpillFileSize(), spillFileSize);
+
+    QCOMPARE(oldest.Data(), data);
+    QCOMPARE(older.Data(), data);
+    QCOMPARE(newest.Data(), data);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// cppcheck-suppress unusedFunction
+void TST_VUndoPayload::SpillCompaction()
+{
+    VUndoPayload::SetBudget(0);
+
+    const int count = 40;
+    QVector<VUndoPayload *> payloads;
+    payloads.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+        payloads.append(new VUndoPayload(RandomData(static_cast<quint32>(i + 1))));
+    }
+
+    const qint64 spillFileSize = VUndoPayload::SpillFileSize();
+    QVERIFY(spillFileSize >= static_cast<qint64>(count - 1) * payloadSize);
+
+    // Release all but a few, space of released payloads must be given back
+    const QVector<int> kept{0, count / 2, count - 1};
+    for (int i = 0; i < count; ++i)
+    {
+        if (not kept.contains(i))
+        {
+            delete payloads.at(i);
+            payloads[i] = nullptr;
+        }
+    }
+
+    QVERIFY2(VUndoPayload::SpillFileSize() < spillFileSize / 2,
+             qUtf8Printable(QStringLiteral("Temporary file size %1, was %2.")
+                            .arg(VUndoPayload::SpillFileSize()).arg(spillFileSize)));
+
+    for (auto i : kept)
+    {
+        QCOMPARE(payloads.at(i)->Data(), RandomData(static_cast<quint32>(i + 1)));
+    }
+
+    qDeleteAll(payloads);
+    QCOMPARE(VUndoPayload::SpillFileSize(), static_cast<qint64>(0));
+}
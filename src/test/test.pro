@@ -2,5 +2,6 @@ TEMPLATE = subdirs
 SUBDIRS = \
     ParserTest \
     ValentinaTest \
+    BenchmarkTest \
     TranslationsTest \
     CollectionTest